@@ -128,29 +128,24 @@ class DesignerController() : Controller() {
             )
         }
 
-        // HACK: we are using moving targets as fixed point clutter maps
-        scenario.movingTargets
-            ?.filter { it.type == MovingTargetType.Cloud1 || it.type == MovingTargetType.Cloud2 }
-            ?.forEach {
+        // clouds are not part of the clutter map, the simulator renders them as weather cells
+    }
+
+    /**
+     * Clouds of the scenario, for the simulator to fly them over the clutter.
+     */
+    fun weatherCells(): List<WeatherCell> {
+        val cParams = CalculationParameters(simulationController.radarParameters)
+
+        return scenario.movingTargets
+            ?.mapNotNull {
                 when (it.type) {
-                    MovingTargetType.Cloud1 -> buff.calculateClutterMapHits(
-                        hitRaster = cloudOneImage.getRasterHitMap(),
-                        cParams = cParams,
-                        origin = it.initialPosition,
-                        scale = 1.0
-                    )
-                    MovingTargetType.Cloud2 -> buff.calculateClutterMapHits(
-                        hitRaster = cloudTwoImage.getRasterHitMap(),
-                        cParams = cParams,
-                        origin = it.initialPosition,
-                        scale = 1.0
-                    )
-                    else -> {
-                        // no op
-                        // no other moving target is clutter
-                    }
+                    MovingTargetType.Cloud1 -> it.toWeatherCell(cloudOneImage, cParams)
+                    MovingTargetType.Cloud2 -> it.toWeatherCell(cloudTwoImage, cParams)
+                    else -> null
                 }
             }
+            ?: emptyList()
     }
 
     /**
@@ -353,6 +348,9 @@ class DesignerController() : Controller() {
                     updateMessage("Writing target projection")
                 }
 
+                updateMessage("Compacting target sim")
+                targetsBinFile.compactRepeatedRotations(cParams.arpByteCnt.toInt())
+
                 simulationController.uploadClutterFile(
                     FileSystemFile(clutterBinFile),
                     { progress, _ ->
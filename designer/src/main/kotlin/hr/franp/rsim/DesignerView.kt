@@ -119,6 +119,7 @@ class DesignerView : View() {
                             runAsync {
                                 simulationController.startSimulation(
                                     radarScreen.simulatedCurrentTimeSecProperty.get(),
+                                    designerController.weatherCells(),
                                     { progress, message ->
                                         updateMessage(message)
                                         val max = simulationController.radarParameters.azimuthChangePulse * designerController.scenario.simulationDurationMin * MIN_TO_S / simulationController.radarParameters.seekTimeSec
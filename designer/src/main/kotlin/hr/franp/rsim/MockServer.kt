@@ -4,6 +4,7 @@ import org.apache.thrift.server.*
 import org.apache.thrift.transport.*
 import java.lang.Math.*
 import java.lang.Thread.*
+import java.nio.*
 import kotlin.concurrent.*
 
 
@@ -13,11 +14,14 @@ val processor = Simulator.Processor(handler)
 
 fun main(args: Array<String>) {
 
+    // several mocks on one machine stand in for a cluster of boards
+    val port = args.getOrNull(0)?.toInt() ?: 9090
+
     try {
 
         val simple = Runnable {
             try {
-                val serverTransport = TServerSocket(9090)
+                val serverTransport = TServerSocket(port)
                 val server = TSimpleServer(TServer.Args(serverTransport).processor(processor))
                 println("Starting the simple server...")
                 server.serve()
@@ -38,6 +42,13 @@ class SimulatorMock : Simulator.Iface, AutoCloseable {
 
     private val simState = SimState()
 
+    /** Free running ACP count of the mocked radar, its ARP every acpCnt ACPs **/
+    private var radarAcpIdx = 0L
+
+    /** Queued commands by ACP, and the schedule ACP counting on from the simulation ACP index **/
+    private val schedule = sortedMapOf<Long, MutableList<ScheduledCommand>>()
+    private var scheduleAcpIdx = 0L
+
     init {
         simState.arpUs = 12_000_000
         simState.acpCnt = 8_196
@@ -54,10 +65,45 @@ class SimulatorMock : Simulator.Iface, AutoCloseable {
                 (acpNs % 1e6).toInt()
             )
 
-            if (simState.isEnabled) {
+            radarAcpIdx++
+            simState.currAcpIdx = (radarAcpIdx % max(simState.acpCnt, 1)).toInt()
+
+            // like the board, the simulation starts counting with the first ARP after the enable
+            if (simState.isEnabled && (simState.simAcpIdx > 0 || simState.currAcpIdx == 0)) {
                 simState.time = (System.currentTimeMillis() / 1000L).toInt()
                 simState.simAcpIdx++
             }
+
+            fireScheduledCommands()
+        }
+    }
+
+    private fun fireScheduledCommands() {
+        val due = synchronized(schedule) {
+            if (schedule.isEmpty()) {
+                scheduleAcpIdx = simState.simAcpIdx.toLong()
+                return
+            }
+            scheduleAcpIdx++
+
+            val dueAcps = schedule.headMap(scheduleAcpIdx + 1)
+            val commands = dueAcps.values.flatten()
+            dueAcps.clear()
+            commands
+        }
+
+        due.forEach {
+            when (it.action) {
+                CommandAction.ENABLE -> enable()
+                CommandAction.DISABLE -> disable()
+                CommandAction.ENABLE_MTI -> enableMti()
+                CommandAction.DISABLE_MTI -> disableMti()
+                CommandAction.ENABLE_NORM -> enableNorm()
+                CommandAction.DISABLE_NORM -> disableNorm()
+                else -> {
+                    // maps and layers are not mocked
+                }
+            }
         }
     }
 
@@ -92,6 +138,7 @@ class SimulatorMock : Simulator.Iface, AutoCloseable {
 
     override fun disable() {
         simState.isEnabled = false
+        simState.simAcpIdx = 0
     }
 
     override fun disableMti() {
@@ -102,10 +149,125 @@ class SimulatorMock : Simulator.Iface, AutoCloseable {
         simState.isNormEnabled = false
     }
 
-    override fun loadMap(arpPosition: Int) {
+    override fun loadMap(arpPosition: Int, acpOffset: Int) {
         // noop
     }
 
     override fun getState() = simState
 
+    override fun listScenarios(): List<ScenarioInfo> = emptyList()
+
+    override fun preloadScenario(name: String?) {
+        // noop
+    }
+
+    override fun activateScenario(name: String?, arpPosition: Int) {
+        // noop
+    }
+
+    override fun evictScenario(name: String?) {
+        // noop
+    }
+
+    override fun beginUpload(name: String?, subSystem: SubSystem?, header: ByteBuffer?, rotationHashes: List<Long>?): List<Int> =
+        rotationHashes?.indices?.toList() ?: emptyList()
+
+    override fun uploadRotation(name: String?, subSystem: SubSystem?, rotation: Int, data: ByteBuffer?) {
+        // noop
+    }
+
+    override fun commitUpload(name: String?, subSystem: SubSystem?) {
+        // noop
+    }
+
+    override fun beginIngest(name: String?, subSystem: SubSystem?, fileByteSize: Long, chunkByteSize: Int) = IngestState().apply {
+        this.name = name
+        this.subSystem = subSystem
+        this.fileByteSize = fileByteSize
+        this.chunkByteSize = chunkByteSize
+        this.missingChunks = mutableListOf()
+        this.isComplete = true
+    }
+
+    override fun getIngestState(name: String?, subSystem: SubSystem?) = beginIngest(name, subSystem, 0, 0)
+
+    override fun addTarget(target: LiveTarget?) {
+        // noop
+    }
+
+    override fun modifyTarget(target: LiveTarget?) {
+        // noop
+    }
+
+    override fun removeTarget(name: String?) {
+        // noop
+    }
+
+    override fun setWeatherCells(cells: MutableList<WeatherCell>?) {
+        // noop
+    }
+
+    override fun setNoise(seed: Long, regions: MutableList<NoiseRegion>?) {
+        // noop
+    }
+
+    override fun setSeaClutter(seaClutter: SeaClutter?) {
+        // noop
+    }
+
+    override fun listTargetLayers(): MutableList<TargetLayer> = mutableListOf()
+
+    override fun addTargetLayer(layer: TargetLayer?) {
+        // noop
+    }
+
+    override fun enableTargetLayer(scenario: String?, enabled: Boolean) {
+        // noop
+    }
+
+    override fun removeTargetLayer(scenario: String?) {
+        // noop
+    }
+
+    override fun setBlanking(subSystem: SubSystem?, sectors: MutableList<BlankingSector>?) {
+        // noop
+    }
+
+    override fun scheduleCommands(commands: MutableList<ScheduledCommand>?) {
+        synchronized(schedule) {
+            commands?.forEach {
+                schedule.getOrPut(it.acpIdx) { mutableListOf() }.add(it)
+            }
+        }
+    }
+
+    override fun listScheduledCommands(): MutableList<ScheduledCommand> = synchronized(schedule) {
+        schedule.values.flatten().toMutableList()
+    }
+
+    override fun clearSchedule() {
+        synchronized(schedule) {
+            schedule.clear()
+        }
+    }
+
+    override fun startCapture(name: String?, rowPayloads: Boolean) {
+        // noop
+    }
+
+    override fun stopCapture() {
+        // noop
+    }
+
+    override fun getDmaHealth(): MutableList<DmaHealth> = mutableListOf(
+        DmaHealth().apply {
+            subSystem = SubSystem.CLUTTER
+            isRunning = simState.isEnabled
+        },
+        DmaHealth().apply {
+            subSystem = SubSystem.MOVING_TARGET
+            isRunning = simState.isEnabled
+        }
+    )
+
 }
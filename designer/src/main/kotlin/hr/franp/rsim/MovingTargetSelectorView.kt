@@ -67,5 +67,39 @@ class MovingTargetSelectorView : View() {
             }
         }
 
+        separator()
+
+        button("", fontAwesome.create(PLANE)) {
+            tooltip("Injects the selected target into the running simulation, or restarts its path")
+
+            disableProperty().bind(
+                simulatorController.simulationRunningProperty.not()
+                    .or(designerController.selectedMovingTargetProperty.isNull)
+            )
+
+            setOnAction {
+                val movingTarget = designerController.selectedMovingTarget ?: return@setOnAction
+                runAsync {
+                    simulatorController.injectTarget(movingTarget)
+                }
+            }
+        }
+
+        button("", fontAwesome.create(BAN)) {
+            tooltip("Removes the selected target from the running simulation")
+
+            disableProperty().bind(
+                simulatorController.simulationRunningProperty.not()
+                    .or(designerController.selectedMovingTargetProperty.isNull)
+            )
+
+            setOnAction {
+                val movingTarget = designerController.selectedMovingTarget ?: return@setOnAction
+                runAsync {
+                    simulatorController.withdrawTarget(movingTarget.name)
+                }
+            }
+        }
+
     }
 }
@@ -2,24 +2,28 @@ package hr.franp.rsim
 
 import hr.franp.rsim.Simulator.Client
 import hr.franp.rsim.helpers.ReconnectingThriftClient.wrap
+import hr.franp.rsim.models.MovingTarget
 import hr.franp.rsim.models.RadarParameters
 import javafx.application.Platform.runLater
 import javafx.beans.property.SimpleBooleanProperty
 import net.schmizz.sshj.SSHClient
 import net.schmizz.sshj.common.IOUtils
-import net.schmizz.sshj.common.StreamCopier
 import net.schmizz.sshj.connection.channel.direct.Session
 import net.schmizz.sshj.connection.channel.direct.Signal
 import net.schmizz.sshj.xfer.FileSystemFile
-import net.schmizz.sshj.xfer.TransferListener
 import org.apache.commons.math3.stat.regression.SimpleRegression
 import org.apache.thrift.TException
 import org.apache.thrift.protocol.TBinaryProtocol
 import org.apache.thrift.transport.TSocket
 import org.apache.thrift.transport.TTransportException
 import tornadofx.*
+import java.io.File
+import java.io.RandomAccessFile
 import java.lang.Math.floor
 import java.lang.Thread.sleep
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.channels.FileChannel
 import java.util.*
 import java.util.concurrent.TimeUnit
 import java.util.logging.Level
@@ -119,6 +123,8 @@ class SimulatorController : Controller(), AutoCloseable {
                     log.log(Level.INFO, "TARGET_ACP_IDX $loadedTargetAcpIndex")
                     log.log(Level.INFO, "CLUTTER_ACP $loadedClutterAcp")
                     log.log(Level.INFO, "TARGET_ACP $loadedTargetAcp")
+                    log.log(Level.INFO, "REFILL_WAKEUP_US $refillWakeupP99Us/$refillWakeupMaxUs")
+                    log.log(Level.INFO, "LIVE_TARGET_LATENCY_MS $liveTargetLatencyMs")
                 }
             } catch (e: Exception) {
                 log.log(Level.WARNING, e.message)
@@ -188,26 +194,7 @@ class SimulatorController : Controller(), AutoCloseable {
 
         stopSimulation()
 
-        sshClient.apply {
-            newSCPFileTransfer().apply {
-                useCompression()
-                transferListener = object : TransferListener {
-                    override fun directory(name: String?): TransferListener {
-                        return this
-                    }
-
-                    override fun file(name: String?, size: Long): StreamCopier.Listener {
-                        return StreamCopier.Listener { transferred ->
-                            progressConsumer(transferred.toDouble() / size.toDouble(), "Transferring $name")
-                        }
-                    }
-                }
-
-                upload(file, "/var/clutter.bin")
-            }
-            progressConsumer(1.0, "Done")
-        }
-
+        uploadMapFile(file.file, SubSystem.CLUTTER, progressConsumer)
     }
 
     fun uploadTargetsFile(
@@ -216,24 +203,62 @@ class SimulatorController : Controller(), AutoCloseable {
 
         stopSimulation()
 
-        sshClient.apply {
-            newSCPFileTransfer().apply {
-                useCompression()
-                transferListener = object : TransferListener {
-                    override fun directory(name: String?): TransferListener {
-                        return this
-                    }
+        uploadMapFile(file.file, SubSystem.MOVING_TARGET, progressConsumer)
+    }
 
-                    override fun file(name: String?, size: Long): StreamCopier.Listener {
-                        return StreamCopier.Listener { transferred ->
-                            progressConsumer(transferred.toDouble() / size.toDouble(), "Transferring $name")
-                        }
+    /**
+     * Uploads only the rotations the simulator does not have yet, it assembles the rest of the
+     * file from its current copy.
+     */
+    private fun uploadMapFile(
+        file: File,
+        subSystem: SubSystem,
+        progressConsumer: (Double, String) -> Unit) {
+
+        RandomAccessFile(file, "r").use { raf ->
+            raf.channel.use { channel ->
+
+                val buff = channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size())
+                    .order(ByteOrder.LITTLE_ENDIAN)
+
+                // header holds the ACP count at 4 and the max impulse period (bits per ACP) at 12
+                val rotationByteCnt = buff.getInt(4) * (buff.getInt(12) / 8)
+                val rotations = ((channel.size() - FILE_HEADER_BYTE_CNT) / rotationByteCnt).toInt()
+
+                progressConsumer(0.0, "Hashing ${file.name}")
+                val hashes = (0 until rotations).map {
+                    buff.contentHash(FILE_HEADER_BYTE_CNT + it * rotationByteCnt, rotationByteCnt)
+                }
+
+                // the segment table trailing the rotations travels with the header
+                val trailerOffset = FILE_HEADER_BYTE_CNT + rotations * rotationByteCnt
+                val header = ByteArray(FILE_HEADER_BYTE_CNT + (channel.size() - trailerOffset).toInt())
+                buff.position(0)
+                buff.get(header, 0, FILE_HEADER_BYTE_CNT)
+                buff.position(trailerOffset)
+                buff.get(header, FILE_HEADER_BYTE_CNT, header.size - FILE_HEADER_BYTE_CNT)
+
+                val missing = synchronized(simulatorClient) {
+                    simulatorClient.beginUpload("", subSystem, ByteBuffer.wrap(header), hashes)
+                }
+
+                val data = ByteArray(rotationByteCnt)
+                missing.forEachIndexed { i, rotation ->
+                    buff.position(FILE_HEADER_BYTE_CNT + rotation * rotationByteCnt)
+                    buff.get(data)
+
+                    synchronized(simulatorClient) {
+                        simulatorClient.uploadRotation("", subSystem, rotation, ByteBuffer.wrap(data))
                     }
+                    progressConsumer(i.toDouble() / missing.size.toDouble(), "Transferring ${file.name}")
+                }
+
+                synchronized(simulatorClient) {
+                    simulatorClient.commitUpload("", subSystem)
                 }
-                upload(file, "/var/targets.bin")
             }
-            progressConsumer(1.0, "Done")
         }
+        progressConsumer(1.0, "Done")
     }
 
     fun toggleMti(enable: Boolean): Boolean {
@@ -262,6 +287,7 @@ class SimulatorController : Controller(), AutoCloseable {
 
     fun startSimulation(
         fromTimeSec: Double,
+        weatherCells: List<WeatherCell>,
         progressConsumer: (Double, String) -> Unit) {
 
         try {
@@ -275,8 +301,10 @@ class SimulatorController : Controller(), AutoCloseable {
             synchronized(simulatorClient) {
                 simulatorClient.apply {
                     disable()
+                    // clouds are flown by the simulator on top of the clutter
+                    setWeatherCells(weatherCells)
                     // load simulation data from the chosen ARP
-                    loadMap(fromArp)
+                    loadMap(fromArp, 0)
                     enable()
                 }
             }
@@ -331,6 +359,38 @@ class SimulatorController : Controller(), AutoCloseable {
     fun approxSimTime(t: Double = System.currentTimeMillis().toDouble()) =
         approxSimAcp(t).toDouble() / radarParameters.azimuthChangePulse * radarParameters.seekTimeSec
 
+    /**
+     * Names of the targets injected into the running simulation
+     */
+    private val liveTargetNames = mutableSetOf<String>()
+
+    /**
+     * Injects the target into the running simulation, or changes its course if it is already there.
+     * The path starts over from the initial position of the target.
+     */
+    fun injectTarget(movingTarget: MovingTarget) {
+        val liveTarget = movingTarget.toLiveTarget(CalculationParameters(radarParameters))
+        synchronized(simulatorClient) {
+            if (liveTargetNames.contains(liveTarget.name)) {
+                simulatorClient.modifyTarget(liveTarget)
+            } else {
+                simulatorClient.addTarget(liveTarget)
+                liveTargetNames.add(liveTarget.name)
+            }
+        }
+    }
+
+    /**
+     * Removes the target from the running simulation, if it was injected.
+     */
+    fun withdrawTarget(name: String) {
+        synchronized(simulatorClient) {
+            if (liveTargetNames.remove(name)) {
+                simulatorClient.removeTarget(name)
+            }
+        }
+    }
+
     fun stopSimulation() {
 
         try {
@@ -21,8 +21,13 @@ import jfxtras.labs.util.event.*
 import tornadofx.*
 import java.awt.*
 import java.awt.image.*
+import java.io.File
+import java.io.RandomAccessFile
 import java.lang.Math.*
 import java.nio.*
+import java.nio.channels.FileChannel
+import java.nio.file.Files
+import java.nio.file.StandardCopyOption
 import java.text.*
 import kotlin.Pair
 import kotlin.experimental.*
@@ -36,6 +41,11 @@ const val MIN_TO_US = 60.0 * S_TO_US
 const val HOUR_TO_US = 60.0 * MIN_TO_US
 const val SPEED_OF_LIGHT_KM_US = 300000.0
 const val FILE_HEADER_BYTE_CNT = 5 * 4
+const val FNV_OFFSET_BASIS = -0x340d631b7bdddcdbL
+const val FNV_PRIME = 0x100000001b3L
+const val SEGMENT_MAGIC = 0x4D474553
+const val SEGMENT_BYTE_CNT = 3 * 4
+const val SEGMENT_TRAILER_BYTE_CNT = 2 * 4
 
 fun angleToAzimuth(angleRadians: Double): Double {
     return HALF_PI - angleRadians
@@ -434,6 +444,61 @@ data class CalculationParameters(val radarParameters: RadarParameters) {
     val radToAcp = azimuthChangePulseCount / TWO_PI
 }
 
+/**
+ * Describes the point target for the simulator to fly it live, hits shaped like spreadHits shapes them.
+ */
+fun MovingTarget.toLiveTarget(cParams: CalculationParameters) = LiveTarget().also { target ->
+    target.name = name
+    target.rKm = initialPosition.rKm
+    target.azDeg = initialPosition.azDeg
+    target.legs = directions.map { direction ->
+        LiveTargetLeg(direction.destination.rKm, direction.destination.azDeg, direction.speedKmh)
+    }
+    target.isJammingSource = jammingSource
+    target.synchroPulseDelayM = if (synchroPulseRadarJamming) synchroPulseDelayM else 0.0
+    target.hitShape = cParams.toHitShape()
+}
+
+/**
+ * Describes the cloud for the simulator to render it into the clutter, the mask holding a point per hit
+ * pixel of the cloud image (1 km per pixel, as calculateClutterMapHits places clouds) around its center.
+ */
+fun MovingTarget.toWeatherCell(maskImage: Image, cParams: CalculationParameters) = WeatherCell().also { cell ->
+    cell.name = name
+    cell.rKm = initialPosition.rKm
+    cell.azDeg = initialPosition.azDeg
+    cell.legs = directions.map { direction ->
+        LiveTargetLeg(direction.destination.rKm, direction.destination.azDeg, direction.speedKmh)
+    }
+
+    val hitRaster = maskImage.getRasterHitMap()
+    val cx = hitRaster.width / 2.0
+    val cy = hitRaster.height / 2.0
+
+    cell.mask = mutableListOf()
+    hitRaster.forEach { hit ->
+        val cartHit = hit ?: return@forEach
+        val x = cartHit.x - cx
+        val y = cartHit.y - cy
+        cell.mask.add(MaskPoint(
+            sqrt(pow(x, 2.0) + pow(y, 2.0)),
+            toDegrees(normalizeAngleRad(angleToAzimuth(atan2(y, x))))
+        ))
+    }
+
+    cell.hitShape = cParams.toHitShape()
+}
+
+/**
+ * Hits spread like spreadHits spreads them.
+ */
+fun CalculationParameters.toHitShape() = HitShape(
+    (angleBeamWidthRad * azimuthChangePulseCount / TWO_PI).toInt(),
+    radarParameters.impulseSignalUs.toInt(),
+    minSignalTimeUs.toInt(),
+    maxSignalTimeUs.toInt()
+)
+
 fun ByteBuffer.calculateClutterMapHits(hitRaster: RasterIterator,
                                        cParams: CalculationParameters,
                                        origin: RadarCoordinate = RadarCoordinate(_rKm = 0.0, _azDeg = 0.0),
@@ -573,6 +638,17 @@ fun ByteBuffer.calculatePointTargetHits(pathSegment: PathSegment,
     return this
 }
 
+/**
+ * 64bit FNV-1a hash of the given bytes, the simulator server uses the same one to identify rotations.
+ */
+fun ByteBuffer.contentHash(offset: Int, length: Int): Long {
+    var hash = FNV_OFFSET_BASIS
+    for (i in offset until offset + length) {
+        hash = (hash xor (get(i).toLong() and 0xFF)) * FNV_PRIME
+    }
+    return hash
+}
+
 fun ByteBuffer.spreadHits(destination: ByteBuffer, cParams: CalculationParameters): ByteBuffer {
 
     // convert angle resolution to ACP idx spread
@@ -958,6 +1034,85 @@ fun ByteBuffer.writeHitsHeader(radarParameters: RadarParameters,
     putInt(16, rotations)
 }
 
+/**
+ * Rewrites the map file so runs of identical rotations are stored once and replayed by repeat
+ * segments, which the simulator resolves while playing. Files without repeats are left as they are.
+ */
+fun File.compactRepeatedRotations(rotationByteCnt: Int) {
+
+    RandomAccessFile(this, "r").use { raf ->
+        raf.channel.use { channel ->
+
+            val rotations = ((channel.size() - FILE_HEADER_BYTE_CNT) / rotationByteCnt).toInt()
+            val rotation = ByteBuffer.allocate(rotationByteCnt)
+
+            // first rotation and length of each run of identical rotations
+            val runs = mutableListOf<Pair<Int, Int>>()
+            var prevHash: Long? = null
+            for (i in 0 until rotations) {
+                rotation.clear()
+                channel.read(rotation, FILE_HEADER_BYTE_CNT + i.toLong() * rotationByteCnt)
+                val hash = rotation.contentHash(0, rotationByteCnt)
+                if (hash == prevHash) {
+                    runs[runs.lastIndex] = runs.last().copy(second = runs.last().second + 1)
+                } else {
+                    runs.add(Pair(i, 1))
+                }
+                prevHash = hash
+            }
+
+            if (runs.none { it.second > 1 }) {
+                return
+            }
+
+            // first and last stored rotation and repeat count, rotations without repeats are merged
+            val segments = mutableListOf<Triple<Int, Int, Int>>()
+            runs.forEachIndexed { stored, run ->
+                val last = segments.lastOrNull()
+                if (run.second == 1 && last != null && last.third == 1) {
+                    segments[segments.lastIndex] = last.copy(second = stored)
+                } else {
+                    segments.add(Triple(stored, stored, run.second))
+                }
+            }
+
+            val compacted = resolveSibling("$name.compact")
+            RandomAccessFile(compacted, "rw").use { out ->
+                out.setLength(0)
+                out.channel.use { outChannel ->
+
+                    val header = ByteBuffer.allocate(FILE_HEADER_BYTE_CNT).order(ByteOrder.LITTLE_ENDIAN)
+                    channel.read(header, 0)
+                    header.putInt(16, runs.size)
+                    header.flip()
+                    outChannel.write(header)
+
+                    runs.forEach { run ->
+                        rotation.clear()
+                        channel.read(rotation, FILE_HEADER_BYTE_CNT + run.first.toLong() * rotationByteCnt)
+                        rotation.flip()
+                        outChannel.write(rotation)
+                    }
+
+                    val trailer = ByteBuffer.allocate(segments.size * SEGMENT_BYTE_CNT + SEGMENT_TRAILER_BYTE_CNT)
+                        .order(ByteOrder.LITTLE_ENDIAN)
+                    segments.forEach {
+                        trailer.putInt(it.first)
+                        trailer.putInt(it.second)
+                        trailer.putInt(it.third)
+                    }
+                    trailer.putInt(segments.size)
+                    trailer.putInt(SEGMENT_MAGIC)
+                    trailer.flip()
+                    outChannel.write(trailer)
+                }
+            }
+
+            Files.move(compacted.toPath(), toPath(), StandardCopyOption.REPLACE_EXISTING)
+        }
+    }
+}
+
 fun ByteBuffer.writeHit(acpIdx: Int,
                         signalTimeUs: Int,
                         cParam: CalculationParameters,
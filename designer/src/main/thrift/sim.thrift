@@ -16,6 +16,18 @@ struct SimState {
     13: i32 loadedTargetAcpIndex;
     14: i32 loadedClutterAcp;
     15: i32 loadedTargetAcp;
+    16: i32 refillWakeupP99Us;
+    17: i32 refillWakeupMaxUs;
+    18: i32 liveTargetLatencyMs;
+}
+
+struct ScenarioInfo {
+    1: string name;
+    2: bool resident;
+    3: bool active;
+    4: i32 rotations;          // -1 for scenarios ending in an endless loop
+    5: i64 fileByteSize;
+    6: i64 residentByteSize;
 }
 
 enum SubSystem {
@@ -23,6 +35,116 @@ enum SubSystem {
     MOVING_TARGET
 }
 
+struct IngestState {
+    1: string name;
+    2: SubSystem subSystem;
+    3: i64 fileByteSize;
+    4: i32 chunkByteSize;
+    5: i32 receivedChunks;
+    6: list<i32> missingChunks;
+    7: bool complete;
+    8: i32 port;
+}
+
+struct LiveTargetLeg {
+    1: double rKm;             // destination of the leg
+    2: double azDeg;
+    3: double speedKmh;
+}
+
+struct HitShape {
+    1: i32 acpSpread;          // ACPs a hit spreads to each side, the beam width
+    2: i32 lengthUs;           // range extent of a hit, the impulse signal duration
+    3: i32 minSignalUs;
+    4: i32 maxSignalUs;
+}
+
+struct LiveTarget {
+    1: string name;
+    2: double rKm;             // initial position
+    3: double azDeg;
+    4: list<LiveTargetLeg> legs;   // empty for a target standing still
+    5: bool jammingSource;
+    6: double synchroPulseDelayM;  // 0 without synchro pulse jamming
+    7: HitShape hitShape;
+}
+
+struct MaskPoint {
+    1: double rKm;             // offset from the center of the cell
+    2: double azDeg;
+}
+
+struct WeatherCell {
+    1: string name;
+    2: double rKm;             // initial position of the center
+    3: double azDeg;
+    4: list<LiveTargetLeg> legs;   // empty for a cell standing still
+    5: list<MaskPoint> mask;   // shape, turned along with the heading of the legs
+    6: HitShape hitShape;
+}
+
+struct NoiseRegion {
+    1: double fromAzDeg;
+    2: double toAzDeg;         // clockwise from fromAzDeg, equal bounds cover the full circle
+    3: i32 fromSignalUs;
+    4: i32 toSignalUs;
+    5: double density;         // false alarm probability of each range bit
+}
+
+struct SeaClutter {
+    1: i32 seaState;           // Douglas sea state 0-9, 0 for a calm sea without clutter
+    2: double windFromDeg;     // direction the wind blows from, the clutter is strongest looking upwind
+    3: double maxRangeKm;      // range extent of the clutter
+    4: i64 seed;
+}
+
+struct TargetLayer {
+    1: string scenario;        // stored scenario whose target map the layer plays
+    2: i32 startArp;           // ARP of the simulation the first rotation of the layer plays at
+    3: bool enabled;
+}
+
+struct BlankingSector {
+    1: double fromAzDeg;
+    2: double toAzDeg;         // clockwise from fromAzDeg, equal bounds cover the full circle
+    3: double fromRangeKm;
+    4: double toRangeKm;
+}
+
+enum CommandAction {
+    ENABLE,
+    DISABLE,
+    ENABLE_MTI,
+    DISABLE_MTI,
+    ENABLE_NORM,
+    DISABLE_NORM,
+    SEEK,
+    ENABLE_TARGET_LAYER,
+    DISABLE_TARGET_LAYER
+}
+
+struct ScheduledCommand {
+    1: i64 acpIdx;             // simulation ACP index the command fires at, counted on through scheduled seeks and restarts
+    2: CommandAction action;
+    3: i32 arpPosition;        // SEEK: ARP the loaded maps are played from
+    4: string scenario;        // ENABLE_TARGET_LAYER, DISABLE_TARGET_LAYER: scenario of the layer
+}
+
+struct DmaHealth {
+    1: SubSystem subSystem;
+    2: bool running;           // armed and neither halted, in error nor stalled at the last poll
+    3: i32 status;             // MM2S status register at the last poll
+    4: i64 halts;              // halted without an error while armed
+    5: i64 internalErrors;     // DMAIntErr
+    6: i64 slaveErrors;        // DMASlvErr
+    7: i64 decodeErrors;       // DMADecErr
+    8: i64 sgErrors;           // SGIntErr, SGSlvErr or SGDecErr
+    9: i64 stalls;             // the current BD stood still while the beam went on
+    10: i64 recoveries;
+    11: i64 failedRecoveries;
+    12: i32 lastRecoveryUs;
+}
+
 exception RadarSignalNotCalibratedException {}
 
 exception IncompatibleFileException {
@@ -33,6 +155,26 @@ exception DmaNotInitializedException {
     1: SubSystem subSystem;
 }
 
+exception ScenarioException {
+    1: string name;
+    2: string reason;
+}
+
+exception LiveTargetException {
+    1: string name;
+    2: string reason;
+}
+
+exception ScheduleException {
+    1: i64 acpIdx;
+    2: string reason;
+}
+
+exception CaptureException {
+    1: string name;
+    2: string reason;
+}
+
 service Simulator {
 
     /**
@@ -76,13 +218,156 @@ service Simulator {
     void disableNorm();
 
     /**
-     * Loads the clutter and target map data from the common location.
+     * Loads the clutter and target map data from the common location, turned clockwise by the given number
+     * of ACPs to align the scenario north with the radar.
      **/
-    void loadMap(1: i32 arpPosition) throws (1: IncompatibleFileException rsnc);
+    void loadMap(1: i32 arpPosition, 2: i32 acpOffset) throws (1: IncompatibleFileException rsnc);
 
     /**
      * Returns the state of the simulator.
      **/
     SimState getState();
 
+    /**
+     * Lists the scenarios stored on the board and the ones resident in the scenario cache.
+     **/
+    list<ScenarioInfo> listScenarios();
+
+    /**
+     * Loads the named scenario into the scenario cache, evicting the least recently used ones if needed.
+     **/
+    void preloadScenario(1: string name) throws (1: ScenarioException se);
+
+    /**
+     * Fills the ring from the resident named scenario, starting at the given ARP position.
+     **/
+    void activateScenario(1: string name, 2: i32 arpPosition) throws (1: ScenarioException se);
+
+    /**
+     * Drops the named scenario from the scenario cache.
+     **/
+    void evictScenario(1: string name);
+
+    /**
+     * Starts a deduplicated upload of a map file and returns the rotations the server does not have yet.
+     * An empty name stands for the common location loaded by loadMap.
+     * The header is followed by the segment table of the file, if it has one.
+     **/
+    list<i32> beginUpload(1: string name, 2: SubSystem subSystem, 3: binary header, 4: list<i64> rotationHashes) throws (1: ScenarioException se);
+
+    /**
+     * Uploads one of the rotations requested by beginUpload.
+     **/
+    void uploadRotation(1: string name, 2: SubSystem subSystem, 3: i32 rotation, 4: binary data) throws (1: ScenarioException se);
+
+    /**
+     * Assembles the uploaded map file from the uploaded rotations and the ones already on the board.
+     **/
+    void commitUpload(1: string name, 2: SubSystem subSystem) throws (1: ScenarioException se);
+
+    /**
+     * Starts a chunked map file ingest, or resumes the unfinished one of the same size, and returns the chunks
+     * still to be streamed to the ingest port. An empty name stands for the common location loaded by loadMap.
+     **/
+    IngestState beginIngest(1: string name, 2: SubSystem subSystem, 3: i64 fileByteSize, 4: i32 chunkByteSize) throws (1: ScenarioException se);
+
+    /**
+     * Returns the progress of a chunked map file ingest.
+     **/
+    IngestState getIngestState(1: string name, 2: SubSystem subSystem) throws (1: ScenarioException se);
+
+    /**
+     * Adds a target to the running simulation, its path starts at the time of the call.
+     * The target rows the beam has not reached yet are patched right away.
+     **/
+    void addTarget(1: LiveTarget target) throws (1: LiveTargetException lte);
+
+    /**
+     * Replaces the live target of the same name, its path restarts at the time of the call.
+     **/
+    void modifyTarget(1: LiveTarget target) throws (1: LiveTargetException lte);
+
+    /**
+     * Removes the live target from the simulation.
+     **/
+    void removeTarget(1: string name) throws (1: LiveTargetException lte);
+
+    /**
+     * Replaces the weather cells rendered into the clutter, their paths flown in scenario time from the ARP 0.
+     * The clutter rotations refilled from then on show them.
+     **/
+    void setWeatherCells(1: list<WeatherCell> cells) throws (1: LiveTargetException lte);
+
+    /**
+     * Replaces the noise regions whose false hits are ORed into the clutter, the same seed giving the same hits.
+     * The clutter rotations refilled from then on show them.
+     **/
+    void setNoise(1: i64 seed, 2: list<NoiseRegion> regions);
+
+    /**
+     * Replaces the sea clutter rendered into the clutter, the same seed giving the same clutter.
+     * The clutter rotations refilled from then on show it.
+     **/
+    void setSeaClutter(1: SeaClutter seaClutter);
+
+    /**
+     * Lists the target layers ORed over the target map.
+     **/
+    list<TargetLayer> listTargetLayers();
+
+    /**
+     * Adds the target map of a stored scenario as a layer ORed over the target map, or replaces the layer of the
+     * same scenario. The target sectors the beam has not reached yet are patched right away.
+     **/
+    void addTargetLayer(1: TargetLayer layer) throws (1: ScenarioException se);
+
+    /**
+     * Enables or disables the target layer from the next sector on.
+     **/
+    void enableTargetLayer(1: string scenario, 2: bool enabled) throws (1: ScenarioException se);
+
+    /**
+     * Removes the target layer from the next sector on.
+     **/
+    void removeTargetLayer(1: string scenario) throws (1: ScenarioException se);
+
+    /**
+     * Replaces the sectors blanked on the output of the given subsystem, an empty list blanking nothing.
+     * Targets are blanked from the next sector on, clutter from the next rotation on.
+     **/
+    void setBlanking(1: SubSystem subSystem, 2: list<BlankingSector> sectors);
+
+    /**
+     * Queues the commands to fire at their ACP, the ones already due firing right away.
+     * The ACP index counts on from the simulation ACP index the queue was empty at.
+     **/
+    void scheduleCommands(1: list<ScheduledCommand> commands) throws (1: ScheduleException se);
+
+    /**
+     * Lists the commands still queued, in the order they fire.
+     **/
+    list<ScheduledCommand> listScheduledCommands();
+
+    /**
+     * Drops the commands still queued.
+     **/
+    void clearSchedule();
+
+    /**
+     * Starts recording every ring slot committed to the DMA into a capture of the given name, replacing the running
+     * capture. With row payloads the committed rows are kept too, compressed.
+     **/
+    void startCapture(1: string name, 2: bool rowPayloads) throws (1: CaptureException ce);
+
+    /**
+     * Stops the running capture once its records are written.
+     **/
+    void stopCapture();
+
+    /**
+     * Returns the health of the clutter and target DMA channels, which are reset and re-armed on a halt, an error
+     * or a stall with the ring contents kept.
+     **/
+    list<DmaHealth> getDmaHealth();
+
 }
\ No newline at end of file
@@ -0,0 +1,334 @@
+/*
+ * cluster_controller.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <thrift/transport/TSocket.h>
+
+#include "cluster_controller.hpp"
+
+using namespace std;
+using namespace ::apache::thrift;
+using namespace ::apache::thrift::protocol;
+using namespace ::apache::thrift::transport;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+BoardAddress parseBoardAddress(const string &address) {
+    auto colon = address.rfind(':');
+    if (colon == string::npos) {
+        return BoardAddress {address, CLUSTER_DEFAULT_PORT};
+    }
+    return BoardAddress {address.substr(0, colon), atoi(address.substr(colon + 1).c_str())};
+}
+
+void openClusterMapFile(ClusterMapFile &file, const string &path, SubSystem::type subSystem) {
+    file.subSystem = subSystem;
+    file.path = path;
+
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        RAISE(ClusterException, "Unable to open map file " << path);
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || (size_t) fileStat.st_size < MAP_HEADER_BYTE_SIZE) {
+        close(fd);
+        RAISE(ClusterException, "Invalid map file " << path);
+    }
+
+    file.byteSize = (size_t) fileStat.st_size;
+    auto data = mmap(NULL, file.byteSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        RAISE(ClusterException, "Unable to map file " << path);
+    }
+    file.data = (const u8 *) data;
+
+    MapHeader header;
+    memcpy(&header, file.data, MAP_HEADER_BYTE_SIZE);
+    file.rotationByteSize = (u64) header.acpCnt * ROW_BYTE_SIZE;
+    if (file.rotationByteSize == 0) {
+        closeClusterMapFile(file);
+        RAISE(ClusterException, "Invalid map header of " << path);
+    }
+
+    // the segment table trailing the rotations travels with the header
+    auto rotationCount = (file.byteSize - MAP_HEADER_BYTE_SIZE) / file.rotationByteSize;
+    auto trailerOffset = MAP_HEADER_BYTE_SIZE + rotationCount * file.rotationByteSize;
+    file.header.assign((const char *) file.data, MAP_HEADER_BYTE_SIZE);
+    file.header.append((const char *) file.data + trailerOffset, file.byteSize - trailerOffset);
+
+    file.rotationHashes.clear();
+    for (u64 rotation = 0; rotation < rotationCount; rotation++) {
+        auto rotationData = file.data + MAP_HEADER_BYTE_SIZE + rotation * file.rotationByteSize;
+        file.rotationHashes.push_back((int64_t) contentHash(rotationData, file.rotationByteSize));
+    }
+
+    cout << "MAP_FILE=" << path << "/" << rotationCount << "/" << file.rotationByteSize << endl;
+}
+
+void closeClusterMapFile(ClusterMapFile &file) {
+    if (file.data != NULL) {
+        munmap((void *) file.data, file.byteSize);
+        file.data = NULL;
+    }
+}
+
+Board::Board(const BoardAddress &address)
+    : address(address) {
+    ostringstream name;
+    name << address.host << ":" << address.port;
+    boardName = name.str();
+}
+
+Board::~Board() {
+    disconnect();
+}
+
+void Board::connect() {
+    disconnect();
+
+    boost::shared_ptr<TSocket> socket(new TSocket(address.host, address.port));
+    transport.reset(new TBufferedTransport(socket));
+    boost::shared_ptr<TProtocol> protocol(new TBinaryProtocol(transport));
+    client.reset(new SimulatorClient(protocol));
+
+    transport->open();
+    cout << "BOARD_CONNECTED=" << boardName << endl;
+}
+
+void Board::disconnect() {
+    if (transport && transport->isOpen()) {
+        transport->close();
+    }
+}
+
+bool Board::isConnected() const {
+    return transport && transport->isOpen();
+}
+
+u32 Board::upload(const string &scenario, const ClusterMapFile &file) {
+    vector<int32_t> missing;
+    client->beginUpload(missing, scenario, file.subSystem, file.header, file.rotationHashes);
+
+    string rotationData;
+    for (auto rotation : missing) {
+        rotationData.assign((const char *) file.data + MAP_HEADER_BYTE_SIZE + (u64) rotation * file.rotationByteSize,
+                            file.rotationByteSize);
+        client->uploadRotation(scenario, file.subSystem, rotation, rotationData);
+    }
+
+    client->commitUpload(scenario, file.subSystem);
+    return (u32) missing.size();
+}
+
+ClusterController::ClusterController(const vector<BoardAddress> &addresses) {
+    for (auto &address : addresses) {
+        boards.emplace_back(new Board(address));
+    }
+}
+
+void ClusterController::connect() {
+    forEachBoard("connect", [](Board &board) {
+        board.connect();
+    });
+}
+
+void ClusterController::distribute(const string &scenario, const string &clutterPath, const string &targetPath) {
+
+    // hashed once, uploaded to every board
+    vector<ClusterMapFile> files;
+    try {
+        if (!clutterPath.empty()) {
+            files.emplace_back();
+            openClusterMapFile(files.back(), clutterPath, SubSystem::CLUTTER);
+        }
+        if (!targetPath.empty()) {
+            files.emplace_back();
+            openClusterMapFile(files.back(), targetPath, SubSystem::MOVING_TARGET);
+        }
+    } catch (...) {
+        for (auto &file : files) {
+            closeClusterMapFile(file);
+        }
+        throw;
+    }
+
+    auto startTime = chrono::steady_clock::now();
+    try {
+        forEachBoard("distribute", [&](Board &board) {
+            u32 uploaded = 0;
+            for (auto &file : files) {
+                uploaded += board.upload(scenario, file);
+            }
+            cout << "BOARD_DISTRIBUTED=" << board.name() << "/" << uploaded << endl;
+        });
+    } catch (...) {
+        for (auto &file : files) {
+            closeClusterMapFile(file);
+        }
+        throw;
+    }
+
+    for (auto &file : files) {
+        closeClusterMapFile(file);
+    }
+    cout << "CLUSTER_DISTRIBUTED="
+         << files.size() << "/"
+         << boards.size() << "/"
+         << chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count()
+         << endl;
+}
+
+void ClusterController::prepare(const string &scenario, u32 arpPosition) {
+    forEachBoard("prepare", [&](Board &board) {
+        if (scenario.empty()) {
+            board.simulator().loadMap((int32_t) arpPosition, 0);
+        } else {
+            board.simulator().preloadScenario(scenario);
+            board.simulator().activateScenario(scenario, (int32_t) arpPosition);
+        }
+        cout << "BOARD_PREPARED=" << board.name() << "/" << arpPosition << endl;
+    });
+}
+
+void ClusterController::arm(s64 startAcp) {
+
+    // every board thread is connected and waiting when the common instant comes
+    auto armTime = chrono::steady_clock::now() + chrono::milliseconds(CLUSTER_ARM_LEAD_MS);
+
+    forEachBoard("arm", [&](Board &board) {
+        this_thread::sleep_until(armTime);
+
+        if (startAcp == CLUSTER_NEXT_ARP) {
+            board.simulator().enable();
+        } else {
+            ScheduledCommand command;
+            command.acpIdx = startAcp;
+            command.action = CommandAction::ENABLE;
+            board.simulator().scheduleCommands(vector<ScheduledCommand> {command});
+        }
+
+        cout << "BOARD_ARMED="
+             << board.name() << "/"
+             << chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - armTime).count()
+             << endl;
+    });
+}
+
+ClusterSkew ClusterController::poll() {
+    mutex skewMutex;
+    ClusterSkew skew {0, 0, 0};
+    s64 firstStartUs = INT64_MAX;
+    s64 lastStartUs = INT64_MIN;
+
+    auto epoch = chrono::steady_clock::now();
+
+    // a board dropping out is logged, the others are still polled
+    for (auto &board : boards) {
+        if (!board->isConnected()) {
+            try {
+                board->connect();
+            } catch (const exception &e) {
+                cerr << "ERR=Board " << board->name() << " unreachable: " << e.what() << endl;
+            }
+        }
+    }
+
+    vector<thread> threads;
+    for (auto &board : boards) {
+        if (!board->isConnected()) {
+            continue;
+        }
+        auto boardPtr = board.get();
+        threads.emplace_back([&, boardPtr] {
+            try {
+                SimState state;
+                auto sentTime = chrono::steady_clock::now();
+                boardPtr->simulator().getState(state);
+                auto receivedTime = chrono::steady_clock::now();
+
+                // the first ARP after the enable, dated back from the ACPs run since
+                auto stateUs = chrono::duration_cast<chrono::microseconds>(sentTime - epoch).count()
+                               + chrono::duration_cast<chrono::microseconds>(receivedTime - sentTime).count() / 2;
+                auto acpUs = (double) state.arpUs / MAX(state.acpCnt, 1);
+                auto startUs = stateUs - (s64) (state.simAcpIdx * acpUs);
+
+                lock_guard<mutex> lock(skewMutex);
+                skew.answering++;
+                if (state.enabled && state.simAcpIdx > 0) {
+                    skew.running++;
+                    firstStartUs = MIN(firstStartUs, startUs);
+                    lastStartUs = MAX(lastStartUs, startUs);
+                }
+            } catch (const exception &e) {
+                cerr << "ERR=Board " << boardPtr->name() << " poll failed: " << e.what() << endl;
+                boardPtr->disconnect();
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    skew.skewUs = skew.running > 0 ? lastStartUs - firstStartUs : 0;
+    cout << "CLUSTER_SKEW_US="
+         << skew.skewUs << "/"
+         << skew.running << "/"
+         << skew.answering << "/"
+         << boards.size()
+         << endl;
+    return skew;
+}
+
+void ClusterController::forEachBoard(const string &step, const function<void(Board &)> &action) {
+    mutex failedMutex;
+    vector<string> failed;
+
+    vector<thread> threads;
+    for (auto &board : boards) {
+        auto boardPtr = board.get();
+        threads.emplace_back([&, boardPtr] {
+            try {
+                action(*boardPtr);
+            } catch (Exception &e) {
+                cerr << "ERR=Board " << boardPtr->name() << " " << step << " failed: " << e.what() << endl;
+                lock_guard<mutex> lock(failedMutex);
+                failed.push_back(boardPtr->name());
+            } catch (const exception &e) {
+                cerr << "ERR=Board " << boardPtr->name() << " " << step << " failed: " << e.what() << endl;
+                lock_guard<mutex> lock(failedMutex);
+                failed.push_back(boardPtr->name());
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    if (!failed.empty()) {
+        ostringstream names;
+        for (auto &name : failed) {
+            names << " " << name;
+        }
+        RAISE(ClusterException, "Step " << step << " failed on" << names.str());
+    }
+}
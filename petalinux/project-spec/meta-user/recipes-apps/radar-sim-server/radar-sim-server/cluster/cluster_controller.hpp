@@ -0,0 +1,179 @@
+/*
+ * cluster_controller.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CLUSTER_CONTROLLER_
+#define CLUSTER_CONTROLLER_
+
+#include "thrift/Simulator.h"
+
+#include "inc/exceptions.hpp"
+#include "radar_map.hpp"
+
+#include <boost/shared_ptr.hpp>
+#include <thrift/transport/TTransport.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**  CONSTANTS **/
+#define CLUSTER_DEFAULT_PORT        9090
+
+/** Board state poll period of the skew monitor **/
+#define CLUSTER_MONITOR_MS          1000
+
+/** Lead time of the arming, so every board thread is waiting before the common instant **/
+#define CLUSTER_ARM_LEAD_MS         200
+
+/** Start with the next ARP after the arming instead of a scheduled ACP **/
+#define CLUSTER_NEXT_ARP            -1
+
+/** STRUCTS **/
+
+struct BoardAddress {
+    std::string host;
+    int port;
+};
+
+/**
+ * Map file mapped into memory with the content hashes of its rotations, hashed once and
+ * uploaded to every board.
+ */
+struct ClusterMapFile {
+    ::hr::franp::rsim::SubSystem::type subSystem;
+
+    std::string path;
+
+    const u8 *data = NULL;
+
+    size_t byteSize = 0;
+
+    u64 rotationByteSize = 0;
+
+    /** Header followed by the segment table trailing the rotations, if any **/
+    std::string header;
+
+    std::vector<int64_t> rotationHashes;
+};
+
+/** Cross-board start skew of one poll **/
+struct ClusterSkew {
+    /** Boards running, i.e. past the first ARP after their enable **/
+    u32 running;
+
+    /** Boards answering the poll **/
+    u32 answering;
+
+    /** Spread of the estimated start times of the running boards **/
+    s64 skewUs;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Parses host[:port], the port defaulting to CLUSTER_DEFAULT_PORT.
+ */
+BoardAddress parseBoardAddress(const std::string &address);
+
+/**
+ * Maps the file and hashes its rotations, raises ClusterException if it is no map file.
+ */
+void openClusterMapFile(ClusterMapFile &file, const std::string &path, ::hr::franp::rsim::SubSystem::type subSystem);
+
+void closeClusterMapFile(ClusterMapFile &file);
+
+/**  CLASSES **/
+
+EXCEPTION(Exception, ClusterException);
+
+/**
+ * Connection to the radar-sim-server of one board.
+ */
+class Board {
+public:
+    explicit Board(const BoardAddress &address);
+
+    ~Board();
+
+    const std::string &name() const {
+        return boardName;
+    }
+
+    /**
+     * (Re)connects, dropping the previous connection if there is one.
+     */
+    void connect();
+
+    void disconnect();
+
+    bool isConnected() const;
+
+    ::hr::franp::rsim::SimulatorClient &simulator() {
+        return *client;
+    }
+
+    /**
+     * Uploads the rotations of the map file the board does not have yet as the given scenario.
+     * Returns the number of rotations uploaded.
+     */
+    u32 upload(const std::string &scenario, const ClusterMapFile &file);
+
+private:
+    BoardAddress address;
+
+    std::string boardName;
+
+    boost::shared_ptr<::apache::thrift::transport::TTransport> transport;
+
+    std::unique_ptr<::hr::franp::rsim::SimulatorClient> client;
+};
+
+/**
+ * Drives the simulator boards of several radars as one: distributes the scenario to all of
+ * them in parallel, fills their rings, arms them to start together and reports how far apart
+ * they actually started.
+ *
+ * Each step runs on all boards at once, a thread per board, and raises ClusterException
+ * naming the boards it failed on after all of them finished.
+ */
+class ClusterController {
+public:
+    explicit ClusterController(const std::vector<BoardAddress> &addresses);
+
+    void connect();
+
+    /**
+     * Uploads the map files to every board as the given scenario, an empty name standing for
+     * the common location loaded by loadMap. An empty path skips that map.
+     */
+    void distribute(const std::string &scenario, const std::string &clutterPath, const std::string &targetPath);
+
+    /**
+     * Preloads and activates the scenario, or loads the common location maps if the name is
+     * empty, on every board from the given ARP. The boards are left disabled with full rings.
+     */
+    void prepare(const std::string &scenario, u32 arpPosition);
+
+    /**
+     * Enables every board at the same instant, so each starts with its next ARP, or schedules
+     * the enable at the given ACP counted from that instant on each board.
+     */
+    void arm(s64 startAcp);
+
+    /**
+     * Polls every board once, reconnecting the ones that dropped out.
+     */
+    ClusterSkew poll();
+
+private:
+    std::vector<std::unique_ptr<Board>> boards;
+
+    void forEachBoard(const std::string &step, const std::function<void(Board &)> &action);
+};
+
+#endif /* CLUSTER_CONTROLLER_ */
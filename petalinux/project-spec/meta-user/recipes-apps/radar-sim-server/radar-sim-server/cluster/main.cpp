@@ -0,0 +1,113 @@
+/*
+ * main.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <csignal>
+#include <thread>
+#include <getopt.h>
+
+#include "cluster_controller.hpp"
+
+using namespace std;
+
+volatile sig_atomic_t running = 1;
+
+void signalHandler(int signum) {
+    running = 0;
+}
+
+void usage(const char *name) {
+    cout << "Usage: " << name << " --board HOST[:PORT] [--board HOST[:PORT] ...] [--scenario NAME]"
+         << " [--clutter FILE] [--targets FILE] [--arp N] [--start-acp N] [--monitor-ms N]" << endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    vector<BoardAddress> addresses;
+    string scenario;
+    string clutterPath;
+    string targetPath;
+    u32 arpPosition = 0;
+    s64 startAcp = CLUSTER_NEXT_ARP;
+    u32 monitorMs = CLUSTER_MONITOR_MS;
+
+    const struct option options[] = {
+        {"board",      required_argument, NULL, 'b'},
+        {"scenario",   required_argument, NULL, 'n'},
+        {"clutter",    required_argument, NULL, 'c'},
+        {"targets",    required_argument, NULL, 't'},
+        {"arp",        required_argument, NULL, 'a'},
+        {"start-acp",  required_argument, NULL, 's'},
+        {"monitor-ms", required_argument, NULL, 'm'},
+        {"help",       no_argument,       NULL, 'h'},
+        {NULL, 0,                         NULL, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "b:n:c:t:a:s:m:h", options, NULL)) != -1) {
+        switch (opt) {
+            case 'b':
+                addresses.push_back(parseBoardAddress(optarg));
+                break;
+            case 'n':
+                scenario = optarg;
+                break;
+            case 'c':
+                clutterPath = optarg;
+                break;
+            case 't':
+                targetPath = optarg;
+                break;
+            case 'a':
+                arpPosition = (u32) atoi(optarg);
+                break;
+            case 's':
+                startAcp = atoll(optarg);
+                break;
+            case 'm':
+                monitorMs = (u32) atoi(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (addresses.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);
+
+    ClusterController cluster(addresses);
+    try {
+        cluster.connect();
+
+        if (!clutterPath.empty() || !targetPath.empty()) {
+            cluster.distribute(scenario, clutterPath, targetPath);
+        }
+
+        cluster.prepare(scenario, arpPosition);
+        cluster.arm(startAcp);
+    } catch (Exception &e) {
+        cerr << "ERR=" << e.what() << endl;
+        return 1;
+    }
+
+    cout << "CLUSTER_STARTED=" << addresses.size() << endl;
+
+    // the boards keep running on their own, the controller only watches them
+    while (running) {
+        cluster.poll();
+        this_thread::sleep_for(chrono::milliseconds(monitorMs));
+    }
+
+    cout << "CLUSTER_MONITOR_STOPPED" << endl;
+    return 0;
+}
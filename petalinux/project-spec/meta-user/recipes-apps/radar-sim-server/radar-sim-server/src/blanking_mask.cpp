@@ -0,0 +1,102 @@
+/*
+ * blanking_mask.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <iostream>
+
+#include "blanking_mask.hpp"
+#include "commit_kernels.hpp"
+#include "live_targets.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+void BlankingMask::set(const vector<BlankingSector> &sectors, u32 acpCnt) {
+
+    // blanked range bits of each ACP, the ACP index word is never blanked
+    vector<u32> blanked((size_t) acpCnt * TRIG_WORD_CNT, 0);
+    vector<bool> touched(acpCnt, false);
+
+    for (auto &sector : sectors) {
+        auto fromBit = MAX((s64) floor(sector.fromRangeKm * LIVE_SIGNAL_US_PER_KM), (s64) WORD_BITS);
+        auto toBit = MIN((s64) floor(sector.toRangeKm * LIVE_SIGNAL_US_PER_KM), (s64) MAX_TRIG_BITS - 1);
+        if (fromBit > toBit) {
+            continue;
+        }
+
+        auto fromAzDeg = fmod(sector.fromAzDeg, 360);
+        if (fromAzDeg < 0) {
+            fromAzDeg += 360;
+        }
+        auto spanDeg = fmod(sector.toAzDeg - sector.fromAzDeg, 360);
+        if (spanDeg <= 0) {
+            spanDeg += 360;
+        }
+        auto firstAcp = MIN((u32) (fromAzDeg / 360 * acpCnt), acpCnt - 1);
+        auto acpSpan = MIN(MAX((u32) round(spanDeg / 360 * acpCnt), 1u), acpCnt);
+
+        for (u32 i = 0; i < acpSpan; i++) {
+            auto acp = (firstAcp + i) % acpCnt;
+            auto row = blanked.data() + (size_t) acp * TRIG_WORD_CNT;
+            for (auto bit = fromBit; bit <= toBit; bit++) {
+                row[bit / WORD_BITS] |= 1u << (bit % WORD_BITS);
+            }
+            touched[acp] = true;
+        }
+    }
+
+    vector<u16> masks(acpCnt, BLANKING_NONE);
+    vector<u32> words;
+    for (u32 acp = 0; acp < acpCnt; acp++) {
+        if (!touched[acp]) {
+            continue;
+        }
+
+        auto row = blanked.data() + (size_t) acp * TRIG_WORD_CNT;
+        auto prev = acp > 0 ? masks[acp - 1] : BLANKING_NONE;
+        if (prev != BLANKING_NONE && memcmp(row, blanked.data() + (size_t) (acp - 1) * TRIG_WORD_CNT, ROW_BYTE_SIZE) == 0) {
+            masks[acp] = prev;
+            continue;
+        }
+
+        // only 65536 ACPs blanked all differently run out of indexes
+        auto maskIdx = (u32) (words.size() / TRIG_WORD_CNT);
+        if (maskIdx >= BLANKING_NONE) {
+            cerr << "ERR=Too many blanking masks, ACP " << acp << " left as it is" << endl;
+            continue;
+        }
+        for (u32 w = 0; w < TRIG_WORD_CNT; w++) {
+            words.push_back(~row[w]);
+        }
+        masks[acp] = (u16) maskIdx;
+    }
+
+    lock_guard<mutex> lock(maskMutex);
+    acpMasks.swap(masks);
+    maskWords.swap(words);
+
+    cout << "BLANKING=" << sectors.size() << "/" << maskWords.size() / TRIG_WORD_CNT << endl;
+}
+
+void BlankingMask::apply(u32 firstAcp, u32 rowCount, u32 *rows) {
+    lock_guard<mutex> lock(maskMutex);
+    if (maskWords.empty()) {
+        return;
+    }
+
+    for (u32 i = 0; i < rowCount; i++) {
+        auto acp = firstAcp + i;
+        if (acp >= acpMasks.size() || acpMasks[acp] == BLANKING_NONE) {
+            continue;
+        }
+        andRows(rows + (size_t) i * TRIG_WORD_CNT, maskWords.data() + (size_t) acpMasks[acp] * TRIG_WORD_CNT, ROW_BYTE_SIZE);
+    }
+}
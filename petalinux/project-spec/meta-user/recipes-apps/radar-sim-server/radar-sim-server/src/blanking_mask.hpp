@@ -0,0 +1,53 @@
+/*
+ * blanking_mask.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef BLANKING_MASK_
+#define BLANKING_MASK_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <mutex>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Mask index of the ACPs nothing is blanked at **/
+#define BLANKING_NONE           0xFFFF
+
+/**  CLASSES **/
+
+/**
+ * Azimuth sectors by range windows blanked on the output of one ring, ANDed into the staged
+ * rows right before they are committed.
+ *
+ * Each ACP refers to a mask row, the consecutive ACPs blanked alike sharing one, so only the
+ * rows of blanked ACPs are touched at all.
+ */
+class BlankingMask {
+public:
+    /**
+     * Replaces the sectors, for a rotation of the given number of ACPs.
+     */
+    void set(const std::vector<::hr::franp::rsim::BlankingSector> &sectors, u32 acpCnt);
+
+    /**
+     * Blanks the given rows of a rotation, firstAcp being the ACP of the first one.
+     */
+    void apply(u32 firstAcp, u32 rowCount, u32 *rows);
+
+private:
+    std::mutex maskMutex;
+
+    /** Mask row of each ACP, BLANKING_NONE for the ACPs nothing is blanked at **/
+    std::vector<u16> acpMasks;
+
+    /** Mask rows, TRIG_WORD_CNT words each **/
+    std::vector<u32> maskWords;
+};
+
+#endif /* BLANKING_MASK_ */
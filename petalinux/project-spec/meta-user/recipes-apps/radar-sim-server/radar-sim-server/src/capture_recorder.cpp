@@ -0,0 +1,226 @@
+/*
+ * capture_recorder.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+#include <iostream>
+
+#include "capture_recorder.hpp"
+#include "scenario_cache.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+void raiseCaptureException(const string &name, const string &reason) {
+    cerr << "ERR=Capture " << name << ": " << reason << endl;
+    auto ex = CaptureException();
+    ex.name = name;
+    ex.reason = reason;
+    throw ex;
+}
+
+CaptureRecorder::~CaptureRecorder() {
+    stop();
+}
+
+void CaptureRecorder::start(const string &name, bool rowPayloads, const MapHeader &header) {
+    if (!isValidScenarioName(name)) {
+        raiseCaptureException(name, "invalid capture name");
+    }
+
+    stop();
+
+    mkdir(CAPTURE_ROOT_DIR, 0755);
+    auto path = string(CAPTURE_ROOT_DIR) + "/" + name + CAPTURE_FILE_SUFFIX;
+    auto newFile = fopen(path.c_str(), "wb");
+    if (newFile == NULL) {
+        raiseCaptureException(name, string("unable to create ") + path + ": " + strerror(errno));
+    }
+
+    CaptureHeader captureHeader;
+    captureHeader.magic = CAPTURE_FILE_MAGIC;
+    captureHeader.version = CAPTURE_VERSION;
+    captureHeader.flags = rowPayloads ? CAPTURE_ROW_PAYLOADS : 0;
+    captureHeader.arpUs = header.arpUs;
+    captureHeader.acpCnt = header.acpCnt;
+    captureHeader.trigUs = header.trigUs;
+    if (fwrite(&captureHeader, sizeof(captureHeader), 1, newFile) != 1) {
+        fclose(newFile);
+        raiseCaptureException(name, "unable to write the capture header");
+    }
+
+    {
+        lock_guard<mutex> lock(queueMutex);
+        file = newFile;
+        captureName = name;
+        this->rowPayloads = rowPayloads;
+        stopping = false;
+        payloadBuffer.assign(rowPayloads ? CAPTURE_MAX_QUEUED_BYTES / WORD_SIZE : 0, 0);
+        payloadHead = 0;
+        payloadTail = 0;
+        payloadUsed = 0;
+        writtenRecords = 0;
+        droppedPayloads = 0;
+    }
+
+    writerThread = thread([this] {
+        write();
+    });
+    recording = true;
+
+    cout << "CAPTURE_STARTED=" << path << "/" << (rowPayloads ? 1 : 0) << endl;
+}
+
+void CaptureRecorder::stop() {
+    recording = false;
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueChanged.notify_all();
+    if (!writerThread.joinable()) {
+        return;
+    }
+    writerThread.join();
+
+    fclose(file);
+    file = NULL;
+    vector<u32>().swap(payloadBuffer);
+
+    cout << "CAPTURE_STOPPED=" << captureName << "/" << writtenRecords << "/" << droppedPayloads << endl;
+}
+
+void CaptureRecorder::record(CaptureRecord &record, const u32 *rows) {
+    timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    record.magic = CAPTURE_RECORD_MAGIC;
+    record.flags &= CAPTURE_OVERLAID;
+    record.timestampNs = (u64) now.tv_sec * 1000000000ULL + now.tv_nsec;
+    record.payloadByteSize = 0;
+    record.reserved = 0;
+
+    lock_guard<mutex> lock(queueMutex);
+    if (!recording) {
+        return;
+    }
+
+    queue.emplace_back();
+    auto &pending = queue.back();
+    pending.record = record;
+    pending.payloadWords = 0;
+    pending.gapWords = 0;
+
+    if (rowPayloads) {
+        auto words = record.rowCount * TRIG_WORD_CNT;
+        if (reservePayload(pending, words)) {
+            memcpy(&payloadBuffer[pending.payloadOffset], rows, (size_t) words * WORD_SIZE);
+        } else {
+            pending.record.flags |= CAPTURE_PAYLOAD_DROPPED;
+            droppedPayloads++;
+        }
+    }
+
+    queueChanged.notify_one();
+}
+
+void CaptureRecorder::write() {
+    vector<u8> compressed;
+
+    unique_lock<mutex> lock(queueMutex);
+    while (true) {
+        if (queue.empty()) {
+            if (stopping) {
+                break;
+            }
+            queueChanged.wait(lock);
+            continue;
+        }
+
+        auto pending = queue.front();
+        queue.pop_front();
+
+        // the commits go on queueing while the rows are compressed
+        lock.unlock();
+        auto written = writeRecord(pending, compressed);
+        lock.lock();
+
+        // the payloads go out in the order they were reserved
+        if (pending.payloadWords > 0) {
+            payloadTail = pending.payloadOffset + pending.payloadWords;
+            payloadUsed -= pending.gapWords + pending.payloadWords;
+        }
+        if (!written) {
+            cerr << "ERR=Capture " << captureName << ": write failed, stopping" << endl;
+            recording = false;
+            queue.clear();
+            payloadUsed = 0;
+            break;
+        }
+        writtenRecords++;
+    }
+
+    fflush(file);
+}
+
+bool CaptureRecorder::writeRecord(Pending &pending, vector<u8> &compressed) {
+    auto &record = pending.record;
+
+    if (pending.payloadWords > 0) {
+        auto rowBytes = (uLong) pending.payloadWords * WORD_SIZE;
+        auto compressedSize = compressBound(rowBytes);
+        compressed.resize(compressedSize);
+        if (compress2(compressed.data(), &compressedSize, (const Bytef *) &payloadBuffer[pending.payloadOffset], rowBytes,
+                      Z_BEST_SPEED) != Z_OK) {
+            record.flags |= CAPTURE_PAYLOAD_DROPPED;
+        } else {
+            record.payloadByteSize = (u32) compressedSize;
+        }
+    }
+
+    if (fwrite(&record, sizeof(record), 1, file) != 1) {
+        return false;
+    }
+    return record.payloadByteSize == 0 || fwrite(compressed.data(), record.payloadByteSize, 1, file) == 1;
+}
+
+bool CaptureRecorder::reservePayload(Pending &pending, u32 words) {
+    auto capacity = (u32) payloadBuffer.size();
+    if (payloadUsed == 0) {
+        payloadHead = 0;
+        payloadTail = 0;
+    }
+
+    // the free words are the end and the start of the buffer, or the run in between
+    u32 offset, gap;
+    if (payloadHead >= payloadTail && payloadUsed < capacity) {
+        if (capacity - payloadHead >= words) {
+            offset = payloadHead;
+            gap = 0;
+        } else if (payloadTail >= words) {
+            offset = 0;
+            gap = capacity - payloadHead;
+        } else {
+            return false;
+        }
+    } else if (payloadHead < payloadTail && payloadTail - payloadHead >= words) {
+        offset = payloadHead;
+        gap = 0;
+    } else {
+        return false;
+    }
+
+    pending.payloadOffset = offset;
+    pending.payloadWords = words;
+    pending.gapWords = gap;
+    payloadHead = offset + words;
+    payloadUsed += gap + words;
+    return true;
+}
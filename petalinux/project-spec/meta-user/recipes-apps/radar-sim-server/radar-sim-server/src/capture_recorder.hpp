@@ -0,0 +1,193 @@
+/*
+ * capture_recorder.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CAPTURE_RECORDER_
+#define CAPTURE_RECORDER_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**  CONSTANTS **/
+#define CAPTURE_ROOT_DIR            "/var/captures"
+#define CAPTURE_FILE_SUFFIX         ".cap"
+
+#define CAPTURE_FILE_MAGIC          0x50414352
+#define CAPTURE_RECORD_MAGIC        0x43455243
+#define CAPTURE_VERSION             2
+
+/** Capture header flag: the records carry the committed rows **/
+#define CAPTURE_ROW_PAYLOADS        0x1
+
+/** Record flag: the rows of the record were dropped, the writer fell behind **/
+#define CAPTURE_PAYLOAD_DROPPED     0x1
+
+/** Record flag: layers, live targets, weather, noise, sea clutter or blanking changed the map rows **/
+#define CAPTURE_OVERLAID            0x2
+
+/** Bytes of the payload buffer allocated at the start, the payloads that do not fit are dropped **/
+#define CAPTURE_MAX_QUEUED_BYTES    (32 * 1024 * 1024)
+
+/** STRUCTS **/
+
+/**
+ * Header at the start of a capture file, followed by the records.
+ */
+struct CaptureHeader {
+    u32 magic;
+    u32 version;
+    u32 flags;
+    u32 arpUs;
+    u32 acpCnt;
+    u32 trigUs;
+};
+
+/**
+ * One committed ring slot. With row payloads the record is followed by payloadByteSize bytes
+ * of the zlib compressed rows, rowCount rows of ROW_BYTE_SIZE once inflated.
+ */
+struct CaptureRecord {
+    u32 magic;
+    u32 subSystem;
+    u32 flags;
+    u32 slot;
+
+    /** Rotation of the clutter or sector of the targets committed, counted from the load **/
+    u32 loadIdx;
+
+    /** ARP the map was loaded from **/
+    u32 fromArpIdx;
+
+    /** Rotation of the played map the rows were read from **/
+    u32 mapRotation;
+
+    /** ACP index of the first row of the slot **/
+    u32 firstAcp;
+
+    u32 rowCount;
+
+    /** Simulation ACP index at the commit, 0 before the first ARP after the enable **/
+    u32 beamAcp;
+
+    /** CLOCK_REALTIME of the commit **/
+    u64 timestampNs;
+
+    /** rowsHash of the rows the slot's BDs point to after the commit **/
+    u64 hash;
+
+    /** rowsHash of the map rows before the overlays, the same rows as hash unless CAPTURE_OVERLAID **/
+    u64 mapHash;
+
+    u32 payloadByteSize;
+
+    u32 reserved;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Logs and throws the Thrift CaptureException.
+ */
+void raiseCaptureException(const std::string &name, const std::string &reason);
+
+/**  CLASSES **/
+
+/**
+ * Records every ring slot committed to the DMA, so an exercise can be audited afterwards:
+ * when it was committed, where the beam was and a hash of what the DMA plays from then on.
+ *
+ * The commit path only fills in the record and, if the rows are captured too, copies them
+ * into a circular buffer allocated when the capture starts. A writer thread compresses and
+ * writes them out. When the writer falls behind and the buffer is full the payloads are
+ * dropped and counted while the records still go out.
+ */
+class CaptureRecorder {
+public:
+    ~CaptureRecorder();
+
+    /**
+     * Starts a capture into CAPTURE_ROOT_DIR/<name>CAPTURE_FILE_SUFFIX, replacing the running
+     * one. Raises CaptureException if the file cannot be created.
+     */
+    void start(const std::string &name, bool rowPayloads, const MapHeader &header);
+
+    /**
+     * Stops the capture once the queued records are written.
+     */
+    void stop();
+
+    bool isRecording() const {
+        return recording;
+    }
+
+    /**
+     * Queues the record, with a copy of the committed rows if payloads are captured.
+     * The caller fills in the slot fields and the CAPTURE_OVERLAID flag.
+     */
+    void record(CaptureRecord &record, const u32 *rows);
+
+private:
+    struct Pending {
+        CaptureRecord record;
+
+        /** Rows in payloadBuffer, after a gap left unused at its end when it wrapped **/
+        u32 payloadOffset;
+        u32 payloadWords;
+        u32 gapWords;
+    };
+
+    std::atomic<bool> recording {false};
+
+    std::mutex queueMutex;
+
+    std::condition_variable queueChanged;
+
+    std::deque<Pending> queue;
+
+    /** Circular buffer of the queued payloads, from payloadTail on to payloadHead **/
+    std::vector<u32> payloadBuffer;
+
+    u32 payloadHead = 0;
+
+    u32 payloadTail = 0;
+
+    /** Words of payloadBuffer taken by the queued payloads and their gaps **/
+    u32 payloadUsed = 0;
+
+    std::thread writerThread;
+
+    FILE *file = NULL;
+
+    std::string captureName;
+
+    bool rowPayloads = false;
+
+    bool stopping = false;
+
+    u64 writtenRecords = 0;
+
+    u64 droppedPayloads = 0;
+
+    void write();
+
+    /**
+     * Reserves the words for a payload in payloadBuffer, returns false if they do not fit.
+     */
+    bool reservePayload(Pending &pending, u32 words);
+
+    bool writeRecord(Pending &pending, std::vector<u8> &compressed);
+};
+
+#endif /* CAPTURE_RECORDER_ */
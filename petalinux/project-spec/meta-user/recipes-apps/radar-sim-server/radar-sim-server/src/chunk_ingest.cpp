@@ -0,0 +1,460 @@
+/*
+ * chunk_ingest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <zlib.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "scenario_cache.hpp"
+#include "scenario_ingest.hpp"
+#include "chunk_ingest.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+/** Side file header: u64 file size, u32 chunk size, u32 chunk count, followed by one byte per chunk **/
+#define CHUNKS_HEADER_BYTE_SIZE     16
+
+static bool recvFully(int socket, void *data, size_t byteSize) {
+    auto bytes = (char *) data;
+    while (byteSize > 0) {
+        auto cnt = recv(socket, bytes, byteSize, 0);
+        if (cnt <= 0) {
+            return false;
+        }
+        bytes += cnt;
+        byteSize -= cnt;
+    }
+    return true;
+}
+
+static bool pwriteFully(int fd, const void *data, size_t byteSize, off_t offset) {
+    auto bytes = (const char *) data;
+    while (byteSize > 0) {
+        auto cnt = pwrite(fd, bytes, byteSize, offset);
+        if (cnt <= 0) {
+            return false;
+        }
+        bytes += cnt;
+        byteSize -= cnt;
+        offset += cnt;
+    }
+    return true;
+}
+
+ChunkIngest::ChunkIngest() : serverSocket(-1), running(false) {
+}
+
+ChunkIngest::~ChunkIngest() {
+    stop();
+}
+
+ChunkIngest::Ingest::~Ingest() {
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (chunksFd >= 0) {
+        close(chunksFd);
+    }
+}
+
+void ChunkIngest::start(int port) {
+
+    serverSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (serverSocket < 0) {
+        cerr << "ERR=Unable to create the ingest socket" << endl;
+        return;
+    }
+
+    int reuse = 1;
+    setsockopt(serverSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in address;
+    memset(&address, 0x0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t) port);
+
+    if (::bind(serverSocket, (struct sockaddr *) &address, sizeof(address)) != 0 || listen(serverSocket, 8) != 0) {
+        cerr << "ERR=Unable to listen for ingest connections on " << port << endl;
+        close(serverSocket);
+        serverSocket = -1;
+        return;
+    }
+
+    running = true;
+    acceptThread = thread([=] {
+        acceptConnections();
+    });
+
+    cout << "INGEST_PORT=" << port << endl;
+}
+
+void ChunkIngest::stop() {
+    running = false;
+
+    if (serverSocket >= 0) {
+        shutdown(serverSocket, SHUT_RDWR);
+    }
+
+    if (acceptThread.joinable()) {
+        acceptThread.join();
+    }
+
+    if (serverSocket >= 0) {
+        close(serverSocket);
+        serverSocket = -1;
+    }
+
+    // wake the connections blocked in recv, their threads use this object until they end
+    {
+        lock_guard<mutex> lock(connectionsMutex);
+        for (auto &connection : connections) {
+            shutdown(connection.socket, SHUT_RDWR);
+        }
+    }
+    reapConnections(true);
+}
+
+void ChunkIngest::begin(IngestState &_return,
+                        const string &name,
+                        SubSystem::type subSystem,
+                        u64 fileByteSize,
+                        u32 chunkByteSize) {
+
+    if (fileByteSize < MAP_HEADER_BYTE_SIZE || chunkByteSize == 0 || chunkByteSize > INGEST_MAX_CHUNK_BYTE_SIZE) {
+        raiseScenarioException(name, "Invalid ingest size");
+    }
+
+    auto path = ScenarioIngest::mapPath(name, subSystem);
+
+    lock_guard<mutex> lock(ingestsMutex);
+
+    // resume the unfinished ingest of the same file, either still open or from an earlier run
+    auto it = ingests.find(path);
+    if (it != ingests.end() && it->second->finishing) {
+        raiseScenarioException(name, "Ingest is being finished");
+    }
+    if (it != ingests.end()
+        && (it->second->complete
+            || it->second->fileByteSize != fileByteSize
+            || it->second->chunkByteSize != chunkByteSize)) {
+        ingests.erase(it);
+        it = ingests.end();
+    }
+
+    auto ingest = it != ingests.end() ? it->second : resume(path, fileByteSize, chunkByteSize);
+    if (!ingest) {
+        ingest = make_shared<Ingest>();
+        ingest->path = path;
+        ingest->fileByteSize = fileByteSize;
+        ingest->chunkByteSize = chunkByteSize;
+        ingest->received.assign(chunkCount(fileByteSize, chunkByteSize), 0);
+        ingest->receivedCount = 0;
+        ingest->complete = false;
+        ingest->finishing = false;
+
+        ingest->fd = open((path + INGEST_FILE_SUFFIX).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        ingest->chunksFd = open((path + INGEST_CHUNKS_SUFFIX).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        u32 chunksHeader[CHUNKS_HEADER_BYTE_SIZE / WORD_SIZE] = {
+            (u32) fileByteSize,
+            (u32) (fileByteSize >> 32),
+            chunkByteSize,
+            (u32) ingest->received.size()
+        };
+
+        if (ingest->fd < 0 || ingest->chunksFd < 0
+            || ftruncate(ingest->fd, (off_t) fileByteSize) != 0
+            || !pwriteFully(ingest->chunksFd, chunksHeader, CHUNKS_HEADER_BYTE_SIZE, 0)
+            || !pwriteFully(ingest->chunksFd, ingest->received.data(), ingest->received.size(), CHUNKS_HEADER_BYTE_SIZE)) {
+            raiseScenarioException(name, "Unable to allocate " + path + INGEST_FILE_SUFFIX);
+        }
+
+        cout << "INGEST_BEGIN=" << path << "/" << fileByteSize << "/" << chunkByteSize << endl;
+    } else {
+        cout << "INGEST_RESUME=" << path << "/" << ingest->receivedCount << "/" << ingest->received.size() << endl;
+    }
+
+    ingests[path] = ingest;
+
+    fillState(_return, *ingest);
+    _return.name = name;
+    _return.subSystem = subSystem;
+}
+
+void ChunkIngest::state(IngestState &_return, const string &name, SubSystem::type subSystem) {
+
+    auto path = ScenarioIngest::mapFilePath(name, subSystem);
+
+    lock_guard<mutex> lock(ingestsMutex);
+
+    auto it = ingests.find(path);
+    if (it == ingests.end()) {
+        raiseScenarioException(name, "No ingest in progress");
+    }
+
+    fillState(_return, *it->second);
+    _return.name = name;
+    _return.subSystem = subSystem;
+}
+
+void ChunkIngest::acceptConnections() {
+    while (running) {
+        auto socket = accept(serverSocket, NULL, NULL);
+        if (socket < 0) {
+            // don't spin when out of file descriptors or memory
+            if (running && errno != EINTR && errno != ECONNABORTED) {
+                this_thread::sleep_for(chrono::milliseconds(INGEST_ACCEPT_BACKOFF_MS));
+            }
+            continue;
+        }
+
+        reapConnections(false);
+
+        lock_guard<mutex> lock(connectionsMutex);
+        if (connections.size() >= INGEST_MAX_CONNECTIONS) {
+            cerr << "ERR=Too many ingest connections" << endl;
+            close(socket);
+            continue;
+        }
+
+        struct timeval timeout = {INGEST_RECV_TIMEOUT_S, 0};
+        setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        // one thread per data connection, the clients decide on the parallelism up to the limit
+        connections.emplace_back();
+        auto &connection = connections.back();
+        connection.socket = socket;
+        connection.thread = thread([this, &connection] {
+            serveConnection(connection.socket);
+            connection.done = true;
+        });
+    }
+}
+
+void ChunkIngest::reapConnections(bool all) {
+    list<Connection> ended;
+    {
+        lock_guard<mutex> lock(connectionsMutex);
+        for (auto it = connections.begin(); it != connections.end();) {
+            auto following = next(it);
+            if (all || it->done) {
+                ended.splice(ended.end(), connections, it);
+            }
+            it = following;
+        }
+    }
+
+    for (auto &connection : ended) {
+        connection.thread.join();
+        close(connection.socket);
+    }
+}
+
+void ChunkIngest::serveConnection(int connection) {
+
+    vector<char> buffer;
+    ChunkFrame frame;
+
+    while (running && recvFully(connection, &frame, sizeof(frame))) {
+
+        // framing errors are unrecoverable, the client has to reconnect and resume
+        if (frame.magic != INGEST_FRAME_MAGIC
+            || frame.subSystem > SubSystem::MOVING_TARGET
+            || frame.nameLength > INGEST_MAX_NAME_LENGTH
+            || frame.byteSize > INGEST_MAX_CHUNK_BYTE_SIZE) {
+            cerr << "ERR=Invalid ingest frame" << endl;
+            break;
+        }
+
+        string name(frame.nameLength, '\0');
+        buffer.resize(frame.byteSize);
+        if (!recvFully(connection, &name[0], frame.nameLength) || !recvFully(connection, buffer.data(), frame.byteSize)) {
+            break;
+        }
+
+        u32 status = storeChunk(frame, name, buffer);
+        if (send(connection, &status, sizeof(status), MSG_NOSIGNAL) != sizeof(status)) {
+            break;
+        }
+    }
+}
+
+u32 ChunkIngest::storeChunk(const ChunkFrame &frame, const string &name, vector<char> &buffer) {
+
+    // anyone may connect, only chunks of an announced ingest get anywhere near the filesystem
+    if (!name.empty() && !isValidScenarioName(name)) {
+        return INGEST_CHUNK_REJECTED;
+    }
+
+    shared_ptr<Ingest> ingest;
+    {
+        auto path = ScenarioIngest::mapFilePath(name, (SubSystem::type) frame.subSystem);
+
+        lock_guard<mutex> lock(ingestsMutex);
+        auto it = ingests.find(path);
+        if (it != ingests.end()) {
+            ingest = it->second;
+        }
+    }
+
+    if (!ingest || frame.chunk >= ingest->received.size()) {
+        return INGEST_CHUNK_REJECTED;
+    }
+
+    auto offset = (u64) frame.chunk * ingest->chunkByteSize;
+    if (frame.byteSize != MIN((u64) ingest->chunkByteSize, ingest->fileByteSize - offset)) {
+        return INGEST_CHUNK_REJECTED;
+    }
+
+    if (crc32(crc32(0L, Z_NULL, 0), (const Bytef *) buffer.data(), frame.byteSize) != frame.crc) {
+        return INGEST_CHUNK_CORRUPTED;
+    }
+
+    unique_lock<mutex> lock(ingestsMutex);
+
+    // a retransmitted chunk is already on disk, and once the file is complete its fd is gone
+    if (ingest->complete || ingest->received[frame.chunk]) {
+        return INGEST_CHUNK_OK;
+    }
+
+    // chunks of one file are written in parallel, finish waits for them before closing the fd
+    ingest->writers++;
+    lock.unlock();
+
+    auto written = pwriteFully(ingest->fd, buffer.data(), frame.byteSize, (off_t) offset);
+
+    lock.lock();
+    ingest->writers--;
+    ingest->writersDone.notify_all();
+
+    if (!written) {
+        return INGEST_CHUNK_REJECTED;
+    }
+
+    if (!ingest->complete && !ingest->received[frame.chunk]) {
+        ingest->received[frame.chunk] = 1;
+        ingest->receivedCount++;
+        pwriteFully(ingest->chunksFd, &ingest->received[frame.chunk], 1, CHUNKS_HEADER_BYTE_SIZE + frame.chunk);
+
+        if (ingest->receivedCount == ingest->received.size()) {
+            finish(*ingest, lock);
+        }
+    }
+
+    return INGEST_CHUNK_OK;
+}
+
+void ChunkIngest::finish(Ingest &ingest, unique_lock<mutex> &lock) {
+    ingest.finishing = true;
+
+    // duplicates of received chunks may still be writing, the same bytes again
+    ingest.writersDone.wait(lock, [&] {
+        return ingest.writers == 0;
+    });
+
+    // syncing GBs takes a while, the other ingests and the RPCs go on meanwhile
+    lock.unlock();
+
+    // every chunk was verified while writing, the file only has to be moved into place
+    fsync(ingest.fd);
+
+    unlink((ingest.path + INGEST_HASHES_SUFFIX).c_str());
+    auto moved = rename((ingest.path + INGEST_FILE_SUFFIX).c_str(), ingest.path.c_str()) == 0;
+    if (moved) {
+        unlink((ingest.path + INGEST_CHUNKS_SUFFIX).c_str());
+
+        close(ingest.fd);
+        close(ingest.chunksFd);
+        ingest.fd = -1;
+        ingest.chunksFd = -1;
+    }
+
+    lock.lock();
+    ingest.finishing = false;
+
+    if (!moved) {
+        cerr << "ERR=Unable to move " << ingest.path << INGEST_FILE_SUFFIX << " into place" << endl;
+        return;
+    }
+    ingest.complete = true;
+
+    cout << "INGEST_COMPLETE=" << ingest.path << "/" << ingest.fileByteSize << endl;
+}
+
+shared_ptr<ChunkIngest::Ingest> ChunkIngest::resume(const string &path, u64 fileByteSize, u32 chunkByteSize) {
+
+    auto chunksFd = open((path + INGEST_CHUNKS_SUFFIX).c_str(), O_RDWR);
+    if (chunksFd < 0) {
+        return nullptr;
+    }
+
+    u32 chunksHeader[CHUNKS_HEADER_BYTE_SIZE / WORD_SIZE];
+    auto count = chunkCount(fileByteSize, chunkByteSize);
+    auto ingest = make_shared<Ingest>();
+    ingest->received.resize(count);
+
+    struct stat fileStat;
+    auto fd = open((path + INGEST_FILE_SUFFIX).c_str(), O_RDWR);
+    if (fd < 0
+        || fstat(fd, &fileStat) != 0
+        || (u64) fileStat.st_size != fileByteSize
+        || pread(chunksFd, chunksHeader, CHUNKS_HEADER_BYTE_SIZE, 0) != CHUNKS_HEADER_BYTE_SIZE
+        || (chunksHeader[0] | ((u64) chunksHeader[1] << 32)) != fileByteSize
+        || chunksHeader[2] != chunkByteSize
+        || chunksHeader[3] != count
+        || pread(chunksFd, ingest->received.data(), count, CHUNKS_HEADER_BYTE_SIZE) != (ssize_t) count) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        close(chunksFd);
+        return nullptr;
+    }
+
+    ingest->path = path;
+    ingest->fd = fd;
+    ingest->chunksFd = chunksFd;
+    ingest->fileByteSize = fileByteSize;
+    ingest->chunkByteSize = chunkByteSize;
+    ingest->receivedCount = 0;
+    for (auto received : ingest->received) {
+        ingest->receivedCount += received ? 1 : 0;
+    }
+    ingest->complete = false;
+    ingest->finishing = false;
+
+    return ingest;
+}
+
+void ChunkIngest::fillState(IngestState &_return, const Ingest &ingest) {
+    _return.fileByteSize = (int64_t) ingest.fileByteSize;
+    _return.chunkByteSize = (int32_t) ingest.chunkByteSize;
+    _return.receivedChunks = (int32_t) ingest.receivedCount;
+    _return.complete = ingest.complete;
+    _return.port = INGEST_PORT;
+
+    for (u32 i = 0; i < ingest.received.size(); i++) {
+        if (!ingest.received[i]) {
+            _return.missingChunks.push_back((int32_t) i);
+        }
+    }
+}
+
+u32 ChunkIngest::chunkCount(u64 fileByteSize, u32 chunkByteSize) {
+    return (u32) ((fileByteSize + chunkByteSize - 1) / chunkByteSize);
+}
@@ -0,0 +1,172 @@
+/*
+ * chunk_ingest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHUNK_INGEST_
+#define CHUNK_INGEST_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**  CONSTANTS **/
+#define INGEST_PORT                 9091
+#define INGEST_FILE_SUFFIX          ".ingest"
+#define INGEST_CHUNKS_SUFFIX        ".ingest.chunks"
+
+#define INGEST_FRAME_MAGIC          0x48435352
+#define INGEST_MAX_CHUNK_BYTE_SIZE  (16 * 1024 * 1024)
+#define INGEST_MAX_NAME_LENGTH      255
+
+/** Data connections served at once, each may buffer a whole chunk **/
+#define INGEST_MAX_CONNECTIONS      8
+
+/** A data connection silent for this long is dropped, the client resumes on a new one **/
+#define INGEST_RECV_TIMEOUT_S       30
+
+/** Pause after a failed accept, e.g. out of file descriptors **/
+#define INGEST_ACCEPT_BACKOFF_MS    100
+
+/** Per chunk replies on the data connection **/
+#define INGEST_CHUNK_OK             0
+#define INGEST_CHUNK_CORRUPTED      1
+#define INGEST_CHUNK_REJECTED       2
+
+/** STRUCTS **/
+
+/**
+ * Frame header preceding every chunk on a data connection, followed by the scenario name
+ * and the chunk bytes. The server answers each frame with one u32 INGEST_CHUNK_* status.
+ */
+struct ChunkFrame {
+    u32 magic;
+    u32 subSystem;
+    u32 chunk;
+    u32 byteSize;
+    u32 crc;
+    u32 nameLength;
+};
+
+/**  CLASSES **/
+
+/**
+ * Chunked, resumable and parallel upload of map files.
+ *
+ * An ingest is announced over Thrift with the file size and chunk size, the chunks are then
+ * streamed over any number of parallel TCP connections to INGEST_PORT. Each chunk is checked
+ * against its CRC32 and written with pwrite at its offset directly into the final file, the
+ * received chunks are tracked in a side file so an ingest can be resumed after a disconnect
+ * or a restart. The file is renamed into place as soon as the last chunk lands.
+ */
+class ChunkIngest {
+public:
+    ChunkIngest();
+
+    ~ChunkIngest();
+
+    /**
+     * Starts accepting data connections.
+     */
+    void start(int port);
+
+    /**
+     * Stops accepting data connections and closes the open ones.
+     */
+    void stop();
+
+    /**
+     * Starts an ingest of the map file or resumes the matching unfinished one.
+     */
+    void begin(::hr::franp::rsim::IngestState &_return,
+               const std::string &name,
+               ::hr::franp::rsim::SubSystem::type subSystem,
+               u64 fileByteSize,
+               u32 chunkByteSize);
+
+    /**
+     * Returns the progress of an ingest.
+     */
+    void state(::hr::franp::rsim::IngestState &_return,
+               const std::string &name,
+               ::hr::franp::rsim::SubSystem::type subSystem);
+
+private:
+    struct Ingest {
+        ~Ingest();
+
+        std::string path;
+        int fd = -1;
+        int chunksFd = -1;
+        u64 fileByteSize;
+        u32 chunkByteSize;
+        std::vector<u8> received;
+        u32 receivedCount;
+        bool complete;
+
+        /** All chunks arrived, the file is being moved into place outside ingestsMutex **/
+        bool finishing;
+
+        /** Chunks being written to fd outside ingestsMutex **/
+        u32 writers = 0;
+        std::condition_variable writersDone;
+    };
+
+    std::mutex ingestsMutex;
+
+    /** Ingests by map file path **/
+    std::map<std::string, std::shared_ptr<Ingest>> ingests;
+
+    int serverSocket;
+
+    std::atomic<bool> running;
+
+    std::thread acceptThread;
+
+    struct Connection {
+        int socket;
+        std::thread thread;
+        std::atomic<bool> done {false};
+    };
+
+    std::mutex connectionsMutex;
+
+    /** Data connections being served, closed once their thread is joined **/
+    std::list<Connection> connections;
+
+    /**
+     * Joins the threads of the connections the clients closed, all of them if all is set.
+     */
+    void reapConnections(bool all);
+
+    void acceptConnections();
+
+    void serveConnection(int connection);
+
+    u32 storeChunk(const ChunkFrame &frame, const std::string &name, std::vector<char> &buffer);
+
+    /**
+     * Moves the complete file into place once no chunk is being written any more. Called
+     * with ingestsMutex held, it drops the lock while the file is synced and renamed.
+     */
+    void finish(Ingest &ingest, std::unique_lock<std::mutex> &lock);
+
+    std::shared_ptr<Ingest> resume(const std::string &path, u64 fileByteSize, u32 chunkByteSize);
+
+    static void fillState(::hr::franp::rsim::IngestState &_return, const Ingest &ingest);
+
+    static u32 chunkCount(u64 fileByteSize, u32 chunkByteSize);
+};
+
+#endif /* CHUNK_INGEST_ */
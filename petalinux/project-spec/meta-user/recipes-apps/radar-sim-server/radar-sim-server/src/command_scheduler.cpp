@@ -0,0 +1,214 @@
+/*
+ * command_scheduler.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+
+#include <iostream>
+
+#include "command_scheduler.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+void raiseScheduleException(s64 acpIdx, const string &reason) {
+    cerr << "ERR=Scheduled command at ACP " << acpIdx << ": " << reason << endl;
+    auto ex = ScheduleException();
+    ex.acpIdx = acpIdx;
+    ex.reason = reason;
+    throw ex;
+}
+
+static const char *actionName(CommandAction::type action) {
+    auto it = _CommandAction_VALUES_TO_NAMES.find(action);
+    return it != _CommandAction_VALUES_TO_NAMES.end() ? it->second : "?";
+}
+
+CommandScheduler::~CommandScheduler() {
+    stop();
+}
+
+void CommandScheduler::start(const RtProfile &profile, ClockFunc clock, ExecuteFunc execute) {
+    lock_guard<mutex> lock(queueMutex);
+    this->clock = clock;
+    this->execute = execute;
+    running = true;
+    schedulerThread = thread([=] {
+        run(profile);
+    });
+    logThread = thread([=] {
+        logFired();
+    });
+}
+
+void CommandScheduler::stop() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        running = false;
+    }
+    queueChanged.notify_all();
+    if (schedulerThread.joinable()) {
+        schedulerThread.join();
+    }
+
+    firedChanged.notify_all();
+    if (logThread.joinable()) {
+        logThread.join();
+    }
+}
+
+void CommandScheduler::add(const vector<ScheduledCommand> &commands) {
+    for (auto &command : commands) {
+        if (command.acpIdx < 0) {
+            raiseScheduleException(command.acpIdx, "negative ACP index");
+        }
+        if (_CommandAction_VALUES_TO_NAMES.count(command.action) == 0) {
+            raiseScheduleException(command.acpIdx, "unknown action");
+        }
+        if (command.action == CommandAction::SEEK && command.arpPosition < 0) {
+            raiseScheduleException(command.acpIdx, "negative ARP position to seek to");
+        }
+        if ((command.action == CommandAction::ENABLE_TARGET_LAYER || command.action == CommandAction::DISABLE_TARGET_LAYER)
+            && command.scenario.empty()) {
+            raiseScheduleException(command.acpIdx, "no scenario of the target layer");
+        }
+    }
+
+    {
+        lock_guard<mutex> lock(queueMutex);
+        if (queue.size() + commands.size() > SCHEDULE_MAX_COMMANDS) {
+            raiseScheduleException(commands.front().acpIdx, "too many commands queued");
+        }
+
+        // the ACPs of a new schedule count on from the simulation ACP index of now
+        if (queue.empty() && !commands.empty()) {
+            resetClock(clock());
+        }
+
+        for (auto &command : commands) {
+            queue.insert(make_pair(command.acpIdx, command));
+        }
+
+        cout << "SCHEDULE_QUEUED=" << commands.size() << "/" << queue.size() << "/" << (s64) lastAcp << endl;
+    }
+    queueChanged.notify_all();
+}
+
+void CommandScheduler::list(vector<ScheduledCommand> &_return) {
+    lock_guard<mutex> lock(queueMutex);
+    for (auto &entry : queue) {
+        _return.push_back(entry.second);
+    }
+}
+
+void CommandScheduler::clear() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        cout << "SCHEDULE_CLEARED=" << queue.size() << endl;
+        queue.clear();
+    }
+    queueChanged.notify_all();
+}
+
+void CommandScheduler::run(RtProfile profile) {
+    applySchedulerProfile(profile);
+
+    unique_lock<mutex> lock(queueMutex);
+    while (running) {
+        auto now = clock();
+
+        if (queue.empty()) {
+            resetClock(now);
+            queueChanged.wait_for(lock, chrono::milliseconds(SCHEDULE_IDLE_WAIT_MS));
+            continue;
+        }
+
+        auto acp = scheduleAcp(now);
+        auto next = queue.begin();
+        if (next->first <= (s64) acp) {
+            auto command = next->second;
+            queue.erase(next);
+
+            // the command may restart the simulation, which reads the clock on its own
+            lock.unlock();
+            execute(command);
+            {
+                lock_guard<mutex> firedLock(firedMutex);
+                fired.push_back(Fired {command.action, command.acpIdx, (s64) acp - command.acpIdx});
+            }
+            firedChanged.notify_one();
+            lock.lock();
+            continue;
+        }
+
+        auto waitAcps = (double) next->first - acp;
+        if (waitAcps > SCHEDULE_LEAD_ACPS) {
+            auto waitUs = MIN((waitAcps - SCHEDULE_LEAD_ACPS) * now.acpUs, SCHEDULE_IDLE_WAIT_MS * 1000.0);
+            queueChanged.wait_for(lock, chrono::microseconds((s64) waitUs));
+        } else {
+            lock.unlock();
+            this_thread::sleep_for(chrono::microseconds(MAX((s64) (now.acpUs / SCHEDULE_POLLS_PER_ACP), (s64) 1)));
+            lock.lock();
+        }
+    }
+}
+
+void CommandScheduler::logFired() {
+    unique_lock<mutex> lock(firedMutex);
+    while (true) {
+        if (fired.empty()) {
+            {
+                lock_guard<mutex> queueLock(queueMutex);
+                if (!running) {
+                    break;
+                }
+            }
+            firedChanged.wait_for(lock, chrono::milliseconds(SCHEDULE_IDLE_WAIT_MS));
+            continue;
+        }
+
+        auto entry = fired.front();
+        fired.pop_front();
+
+        lock.unlock();
+        cout << "SCHEDULE_FIRED="
+             << actionName(entry.action) << "/"
+             << entry.acpIdx << "/"
+             << entry.lateAcps
+             << endl;
+        lock.lock();
+    }
+}
+
+void CommandScheduler::resetClock(const SweepClock &now) {
+    acpBase = 0;
+    locked = now.beamAcp > 0;
+    lastAcp = now.beamAcp;
+    lastSimAcp = now.beamAcp;
+    lastTime = now.now;
+}
+
+double CommandScheduler::scheduleAcp(const SweepClock &now) {
+    auto elapsedAcps = chrono::duration<double, micro>(now.now - lastTime).count() / now.acpUs;
+
+    // the simulation ACP index is 0 until the first ARP after the enable
+    if (now.beamAcp > 0) {
+        if (!locked || now.beamAcp < lastSimAcp) {
+            acpBase = llround(lastAcp + elapsedAcps) - now.beamAcp;
+            locked = true;
+        }
+        lastAcp = (double) (acpBase + now.beamAcp);
+    } else {
+        locked = false;
+        lastAcp += elapsedAcps;
+    }
+
+    lastSimAcp = now.beamAcp;
+    lastTime = now.now;
+    return lastAcp;
+}
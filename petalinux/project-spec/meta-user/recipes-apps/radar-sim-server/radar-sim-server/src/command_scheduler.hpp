@@ -0,0 +1,135 @@
+/*
+ * command_scheduler.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef COMMAND_SCHEDULER_
+#define COMMAND_SCHEDULER_
+
+#include "thrift/sim_types.h"
+
+#include "live_targets.hpp"
+#include "rt_profile.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Most commands queued at once **/
+#define SCHEDULE_MAX_COMMANDS       65536
+
+/** Longest sleep of the scheduler, so it follows the clock while nothing is due **/
+#define SCHEDULE_IDLE_WAIT_MS       100
+
+/** Within this many ACPs of the next command the clock is polled instead of slept on **/
+#define SCHEDULE_LEAD_ACPS          4
+
+/** Clock polls per ACP once the next command is due **/
+#define SCHEDULE_POLLS_PER_ACP      8
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Logs and throws the Thrift ScheduleException.
+ */
+void raiseScheduleException(s64 acpIdx, const std::string &reason);
+
+/**  CLASSES **/
+
+/**
+ * Queue of commands fired at the ACP they carry by a real-time thread, so an exercise script
+ * uploaded up front runs with ACP accurate timing instead of the RPC latency.
+ *
+ * The schedule ACP follows the simulation ACP index while the simulation runs. Across a
+ * restart, i.e. a scheduled seek or disable and enable, the antenna model counts on from
+ * the last ACP seen until the new simulation ACP index takes over again.
+ */
+class CommandScheduler {
+public:
+    typedef std::function<SweepClock()> ClockFunc;
+
+    typedef std::function<void(const ::hr::franp::rsim::ScheduledCommand &)> ExecuteFunc;
+
+    ~CommandScheduler();
+
+    /**
+     * Starts the scheduler thread, reading the clock and executing the due commands with the
+     * given functions.
+     */
+    void start(const RtProfile &profile, ClockFunc clock, ExecuteFunc execute);
+
+    void stop();
+
+    /**
+     * Queues the commands, raises ScheduleException and queues none of them if one is invalid.
+     */
+    void add(const std::vector<::hr::franp::rsim::ScheduledCommand> &commands);
+
+    void list(std::vector<::hr::franp::rsim::ScheduledCommand> &_return);
+
+    void clear();
+
+private:
+    std::mutex queueMutex;
+
+    std::condition_variable queueChanged;
+
+    /** Queued commands by ACP, the ones of the same ACP in the order they were queued **/
+    std::multimap<s64, ::hr::franp::rsim::ScheduledCommand> queue;
+
+    std::thread schedulerThread;
+
+    struct Fired {
+        ::hr::franp::rsim::CommandAction::type action;
+        s64 acpIdx;
+        s64 lateAcps;
+    };
+
+    std::mutex firedMutex;
+
+    std::condition_variable firedChanged;
+
+    /** Commands fired, logged by logThread so the console never holds up the real-time thread **/
+    std::deque<Fired> fired;
+
+    std::thread logThread;
+
+    bool running = false;
+
+    ClockFunc clock;
+
+    ExecuteFunc execute;
+
+    /** Schedule ACP at the last clock reading **/
+    double lastAcp = 0;
+
+    /** Simulation ACP index and time of the last clock reading **/
+    u32 lastSimAcp = 0;
+    std::chrono::steady_clock::time_point lastTime;
+
+    /** Schedule ACP of the simulation ACP index 0, valid while locked **/
+    s64 acpBase = 0;
+    bool locked = false;
+
+    void run(RtProfile profile);
+
+    void logFired();
+
+    /**
+     * Restarts the schedule ACP at the simulation ACP index.
+     */
+    void resetClock(const SweepClock &now);
+
+    double scheduleAcp(const SweepClock &now);
+};
+
+#endif /* COMMAND_SCHEDULER_ */
@@ -0,0 +1,163 @@
+/*
+ * commit_kernels.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+
+#include "commit_kernels.hpp"
+#include "radar_map.hpp"
+
+using namespace std;
+
+u32 *allocStaging(size_t byteSize) {
+    void *staging = NULL;
+    if (posix_memalign(&staging, STAGING_ALIGNMENT, byteSize) != 0) {
+        return NULL;
+    }
+    memset(staging, 0x0, byteSize);
+    return (u32 *) staging;
+}
+
+void freeStaging(u32 *staging) {
+    free(staging);
+}
+
+void commitRows(u32 *dst, const u32 *src, size_t byteSize) {
+
+    auto blockCnt = byteSize / COMMIT_BLOCK_BYTE_SIZE;
+
+#ifdef __ARM_NEON
+    for (size_t i = 0; i < blockCnt; i++) {
+        uint32x4_t q0 = vld1q_u32(src);
+        uint32x4_t q1 = vld1q_u32(src + 4);
+        uint32x4_t q2 = vld1q_u32(src + 8);
+        uint32x4_t q3 = vld1q_u32(src + 12);
+        vst1q_u32(dst, q0);
+        vst1q_u32(dst + 4, q1);
+        vst1q_u32(dst + 8, q2);
+        vst1q_u32(dst + 12, q3);
+        src += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+        dst += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+    }
+#else
+    memcpy(dst, src, blockCnt * COMMIT_BLOCK_BYTE_SIZE);
+    src += blockCnt * COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+    dst += blockCnt * COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+#endif
+
+    memcpy(dst, src, byteSize % COMMIT_BLOCK_BYTE_SIZE);
+}
+
+void clearRows(u32 *dst, size_t byteSize) {
+
+    auto blockCnt = byteSize / COMMIT_BLOCK_BYTE_SIZE;
+
+#ifdef __ARM_NEON
+    uint32x4_t zero = vdupq_n_u32(0);
+    for (size_t i = 0; i < blockCnt; i++) {
+        vst1q_u32(dst, zero);
+        vst1q_u32(dst + 4, zero);
+        vst1q_u32(dst + 8, zero);
+        vst1q_u32(dst + 12, zero);
+        dst += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+    }
+#else
+    memset(dst, 0x0, blockCnt * COMMIT_BLOCK_BYTE_SIZE);
+    dst += blockCnt * COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+#endif
+
+    memset(dst, 0x0, byteSize % COMMIT_BLOCK_BYTE_SIZE);
+}
+
+void orRows(u32 *dst, const u32 *src, size_t byteSize) {
+
+    auto blockCnt = byteSize / COMMIT_BLOCK_BYTE_SIZE;
+
+#ifdef __ARM_NEON
+    for (size_t i = 0; i < blockCnt; i++) {
+        vst1q_u32(dst, vorrq_u32(vld1q_u32(dst), vld1q_u32(src)));
+        vst1q_u32(dst + 4, vorrq_u32(vld1q_u32(dst + 4), vld1q_u32(src + 4)));
+        vst1q_u32(dst + 8, vorrq_u32(vld1q_u32(dst + 8), vld1q_u32(src + 8)));
+        vst1q_u32(dst + 12, vorrq_u32(vld1q_u32(dst + 12), vld1q_u32(src + 12)));
+        src += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+        dst += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+    }
+#else
+    for (size_t i = 0; i < blockCnt * COMMIT_BLOCK_BYTE_SIZE / sizeof(u32); i++) {
+        *dst++ |= *src++;
+    }
+#endif
+
+    for (size_t i = 0; i < byteSize % COMMIT_BLOCK_BYTE_SIZE / sizeof(u32); i++) {
+        *dst++ |= *src++;
+    }
+}
+
+void andRows(u32 *dst, const u32 *mask, size_t byteSize) {
+
+    auto blockCnt = byteSize / COMMIT_BLOCK_BYTE_SIZE;
+
+#ifdef __ARM_NEON
+    for (size_t i = 0; i < blockCnt; i++) {
+        vst1q_u32(dst, vandq_u32(vld1q_u32(dst), vld1q_u32(mask)));
+        vst1q_u32(dst + 4, vandq_u32(vld1q_u32(dst + 4), vld1q_u32(mask + 4)));
+        vst1q_u32(dst + 8, vandq_u32(vld1q_u32(dst + 8), vld1q_u32(mask + 8)));
+        vst1q_u32(dst + 12, vandq_u32(vld1q_u32(dst + 12), vld1q_u32(mask + 12)));
+        mask += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+        dst += COMMIT_BLOCK_BYTE_SIZE / sizeof(u32);
+    }
+#else
+    for (size_t i = 0; i < blockCnt * COMMIT_BLOCK_BYTE_SIZE / sizeof(u32); i++) {
+        *dst++ &= *mask++;
+    }
+#endif
+
+    for (size_t i = 0; i < byteSize % COMMIT_BLOCK_BYTE_SIZE / sizeof(u32); i++) {
+        *dst++ &= *mask++;
+    }
+}
+
+void RowBitmap::resize(u32 rowCount) {
+    words.assign((rowCount + 63) / 64, 0);
+}
+
+void RowBitmap::clear() {
+    fill(words.begin(), words.end(), 0);
+}
+
+void RowBitmap::set(u32 row) {
+    words[row / 64] |= 1ULL << (row % 64);
+}
+
+bool RowBitmap::test(u32 row) const {
+    return (words[row / 64] >> (row % 64)) & 1;
+}
+
+u32 RowBitmap::count() const {
+    u32 cnt = 0;
+    for (auto word : words) {
+        cnt += __builtin_popcountll(word);
+    }
+    return cnt;
+}
+
+u32 scanOccupancy(const u32 *rows, u32 rowCount, RowBitmap &occupancy) {
+    occupancy.clear();
+    u32 cnt = 0;
+    for (u32 row = 0; row < rowCount; row++) {
+        if (!isEmptyRow(rows + row * TRIG_WORD_CNT)) {
+            occupancy.set(row);
+            cnt++;
+        }
+    }
+    return cnt;
+}
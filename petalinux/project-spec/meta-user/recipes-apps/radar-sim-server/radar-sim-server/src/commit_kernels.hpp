@@ -0,0 +1,79 @@
+/*
+ * commit_kernels.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef COMMIT_KERNELS_
+#define COMMIT_KERNELS_
+
+#include "xilinx/xil_types.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Alignment of the staging buffers, one L1/L2 cache line **/
+#define STAGING_ALIGNMENT       64
+
+/** Bytes moved per iteration of the wide store loops **/
+#define COMMIT_BLOCK_BYTE_SIZE  64
+
+/** STRUCTS **/
+
+/**
+ * One bit per row of a rotation, set for the rows with hits.
+ */
+struct RowBitmap {
+    std::vector<u64> words;
+
+    void resize(u32 rowCount);
+
+    void clear();
+
+    void set(u32 row);
+
+    bool test(u32 row) const;
+
+    u32 count() const;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Allocates a cached, STAGING_ALIGNMENT aligned buffer rows are prepared in before they
+ * are committed to the uncached DMA window.
+ */
+u32 *allocStaging(size_t byteSize);
+
+void freeStaging(u32 *staging);
+
+/**
+ * Copies prepared rows into the DMA window in one pass of wide (NEON, 4x128bit) stores,
+ * which the uncached mapping turns into bursts instead of single word writes.
+ */
+void commitRows(u32 *dst, const u32 *src, size_t byteSize);
+
+/**
+ * Clears a region of the DMA window with wide stores.
+ */
+void clearRows(u32 *dst, size_t byteSize);
+
+/**
+ * ORs rows prepared on the side into the staging buffer, in the same wide steps.
+ */
+void orRows(u32 *dst, const u32 *src, size_t byteSize);
+
+/**
+ * ANDs a mask into rows of the staging buffer, in the same wide steps.
+ */
+void andRows(u32 *dst, const u32 *mask, size_t byteSize);
+
+/**
+ * Sets the bit of every row with hits, returns the number of such rows.
+ */
+u32 scanOccupancy(const u32 *rows, u32 rowCount, RowBitmap &occupancy);
+
+#endif /* COMMIT_KERNELS_ */
@@ -0,0 +1,167 @@
+/*
+ * dma_monitor.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include "xilinx/xaxidma_hw.h"
+#include "inc/exceptions.hpp"
+#include "dma_monitor.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+static const char *channelName(SubSystem::type subSystem) {
+    return subSystem == SubSystem::CLUTTER ? "CL" : "MT";
+}
+
+DmaMonitor::DmaMonitor() : channels(2) {
+    channels[0].health.subSystem = SubSystem::CLUTTER;
+    channels[1].health.subSystem = SubSystem::MOVING_TARGET;
+}
+
+DmaMonitor::~DmaMonitor() {
+    stop();
+}
+
+void DmaMonitor::start(const RtProfile &profile, ProbeFunc probe, RecoverFunc recover) {
+    lock_guard<mutex> lock(monitorMutex);
+    this->probe = probe;
+    this->recover = recover;
+    running = true;
+    monitorThread = thread([=] {
+        run(profile);
+    });
+}
+
+void DmaMonitor::stop() {
+    {
+        lock_guard<mutex> lock(monitorMutex);
+        running = false;
+    }
+    stopRequested.notify_all();
+    if (monitorThread.joinable()) {
+        monitorThread.join();
+    }
+}
+
+void DmaMonitor::health(vector<DmaHealth> &_return) {
+    lock_guard<mutex> lock(monitorMutex);
+    for (auto &channel : channels) {
+        _return.push_back(channel.health);
+    }
+}
+
+void DmaMonitor::run(RtProfile profile) {
+    applySchedulerProfile(profile);
+
+    unique_lock<mutex> lock(monitorMutex);
+    while (running) {
+        // probing and recovering take the simulator locks, getDmaHealth must not wait for them
+        lock.unlock();
+        for (auto &channel : channels) {
+            check(channel);
+        }
+        lock.lock();
+
+        if (running) {
+            stopRequested.wait_for(lock, chrono::milliseconds(DMA_MONITOR_PERIOD_MS));
+        }
+    }
+}
+
+void DmaMonitor::check(Channel &channel) {
+    // the subsystem never changes and the tracking state is the monitor thread's own
+    auto subSystem = channel.health.subSystem;
+    auto now = probe(subSystem);
+
+    if (!now.armed) {
+        channel.tracking = false;
+
+        lock_guard<mutex> lock(monitorMutex);
+        channel.health.status = (int32_t) now.status;
+        channel.health.running = false;
+        return;
+    }
+
+    auto fault = true;
+    {
+        lock_guard<mutex> lock(monitorMutex);
+        auto &health = channel.health;
+        health.status = (int32_t) now.status;
+
+        if (now.status & XAXIDMA_ERR_ALL_MASK) {
+            health.internalErrors += (now.status & XAXIDMA_ERR_INTERNAL_MASK) ? 1 : 0;
+            health.slaveErrors += (now.status & XAXIDMA_ERR_SLAVE_MASK) ? 1 : 0;
+            health.decodeErrors += (now.status & XAXIDMA_ERR_DECODE_MASK) ? 1 : 0;
+            health.sgErrors += (now.status & (XAXIDMA_ERR_SG_INT_MASK | XAXIDMA_ERR_SG_SLV_MASK | XAXIDMA_ERR_SG_DEC_MASK)) ? 1 : 0;
+        } else if (now.status & XAXIDMA_HALTED_MASK) {
+            health.halts++;
+        } else if (now.beamAcp == 0) {
+            // not past the first ARP after the enable, the simulator takes no rows yet
+            channel.tracking = false;
+            fault = false;
+        } else if (!channel.tracking || now.currDesc != channel.lastDesc || now.beamAcp < channel.lastDescAcp) {
+            channel.lastDesc = now.currDesc;
+            channel.lastDescAcp = now.beamAcp;
+            channel.tracking = true;
+            fault = false;
+        } else if (now.beamAcp - channel.lastDescAcp >= DMA_STALL_ACPS) {
+            health.stalls++;
+        } else {
+            fault = false;
+        }
+
+        health.running = !fault;
+    }
+    if (!fault) {
+        return;
+    }
+
+    cerr << "ERR=DMA " << channelName(subSystem) << " fault, status "
+         << hex << showbase << setw(10) << setfill('0') << internal << now.status
+         << dec << noshowbase << endl;
+
+    channel.tracking = false;
+    auto startTime = chrono::steady_clock::now();
+    try {
+        if (!recover(subSystem)) {
+            return;
+        }
+    } catch (Exception &e) {
+        recoveryFailed(channel, e.what());
+        return;
+    } catch (const exception &e) {
+        recoveryFailed(channel, e.what());
+        return;
+    }
+
+    auto recoveryUs = (int32_t) chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - startTime).count();
+
+    int64_t recoveries;
+    {
+        lock_guard<mutex> lock(monitorMutex);
+        auto &health = channel.health;
+        recoveries = ++health.recoveries;
+        health.running = true;
+        health.lastRecoveryUs = recoveryUs;
+    }
+
+    cout << "DMA_RECOVERED="
+         << channelName(subSystem) << "/"
+         << recoveries << "/"
+         << recoveryUs
+         << endl;
+}
+
+void DmaMonitor::recoveryFailed(Channel &channel, const string &reason) {
+    {
+        lock_guard<mutex> lock(monitorMutex);
+        channel.health.failedRecoveries++;
+    }
+    cerr << "ERR=DMA " << channelName(channel.health.subSystem) << " recovery failed: " << reason << endl;
+}
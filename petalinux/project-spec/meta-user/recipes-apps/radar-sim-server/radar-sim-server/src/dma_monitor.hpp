@@ -0,0 +1,110 @@
+/*
+ * dma_monitor.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef DMA_MONITOR_
+#define DMA_MONITOR_
+
+#include "thrift/sim_types.h"
+
+#include "rt_profile.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Poll period of the channel status registers **/
+#define DMA_MONITOR_PERIOD_MS       10
+
+/** ACPs the beam may go on while the current BD of a running channel stands still, a row plays per ACP **/
+#define DMA_STALL_ACPS              32
+
+/** STRUCTS **/
+
+/**
+ * One look at a DMA channel.
+ */
+struct DmaProbe {
+    /** The channel is supposed to run, i.e. the simulation is enabled **/
+    bool armed;
+
+    /** MM2S status register **/
+    u32 status;
+
+    /** MM2S current descriptor register **/
+    u32 currDesc;
+
+    /** Simulation ACP index at the probe **/
+    u32 beamAcp;
+};
+
+/**  CLASSES **/
+
+/**
+ * Watches the clutter and target MM2S channels and has a channel recovered as soon as it
+ * halts, reports an error or stops fetching BDs while the beam goes on, so the display is
+ * dark for a moment instead of until the service is restarted.
+ *
+ * The counters only grow, each fault is counted once as the recovery resets the channel.
+ */
+class DmaMonitor {
+public:
+    typedef std::function<DmaProbe(::hr::franp::rsim::SubSystem::type)> ProbeFunc;
+
+    /**
+     * Resets and re-arms the channel, returns false if it was disarmed in the meantime and
+     * raises if the channel could not be re-armed.
+     */
+    typedef std::function<bool(::hr::franp::rsim::SubSystem::type)> RecoverFunc;
+
+    DmaMonitor();
+
+    ~DmaMonitor();
+
+    void start(const RtProfile &profile, ProbeFunc probe, RecoverFunc recover);
+
+    void stop();
+
+    void health(std::vector<::hr::franp::rsim::DmaHealth> &_return);
+
+private:
+    struct Channel {
+        ::hr::franp::rsim::DmaHealth health;
+
+        /** Current descriptor and the ACP it was first seen at, valid while tracking **/
+        u32 lastDesc = 0;
+        u32 lastDescAcp = 0;
+        bool tracking = false;
+    };
+
+    /** Guards running and the health of the channels, never held while probing or recovering **/
+    std::mutex monitorMutex;
+
+    std::condition_variable stopRequested;
+
+    std::vector<Channel> channels;
+
+    std::thread monitorThread;
+
+    bool running = false;
+
+    ProbeFunc probe;
+
+    RecoverFunc recover;
+
+    void run(RtProfile profile);
+
+    void check(Channel &channel);
+
+    void recoveryFailed(Channel &channel, const std::string &reason);
+};
+
+#endif /* DMA_MONITOR_ */
@@ -0,0 +1,226 @@
+/*
+ * live_targets.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+
+#include <iostream>
+#include <limits>
+
+#include "live_targets.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+#define HOUR_TO_US              3600000000.0
+
+void raiseLiveTargetException(const string &name, const string &reason) {
+    cerr << "ERR=Live target " << name << ": " << reason << endl;
+    auto ex = LiveTargetException();
+    ex.name = name;
+    ex.reason = reason;
+    throw ex;
+}
+
+/**
+ * Sets the hit bits fromUs..toUs of the row, leaving the ACP index word alone.
+ */
+static void setHitBits(u32 *row, s32 fromUs, s32 toUs) {
+    auto from = MAX(fromUs, (s32) WORD_BITS);
+    auto to = MIN(toUs, (s32) MAX_TRIG_BITS - 1);
+    for (auto bit = from; bit <= to; bit++) {
+        row[bit / WORD_BITS] |= 1u << (bit % WORD_BITS);
+    }
+}
+
+u32 azimuthAcp(double xKm, double yKm, u32 acpCnt) {
+    auto azRad = atan2(xKm, yKm);
+    if (azRad < 0) {
+        azRad += 2 * M_PI;
+    }
+    return MIN((u32) (azRad / (2 * M_PI) * acpCnt), acpCnt - 1);
+}
+
+void LiveTargets::add(const LiveTarget &target) {
+    auto prepared = makeTarget(target);
+
+    lock_guard<mutex> lock(targetsMutex);
+    if (targets.count(target.name)) {
+        raiseLiveTargetException(target.name, "already exists");
+    }
+    targets[target.name] = prepared;
+    cout << "LIVE_TARGET_ADDED=" << target.name << "/" << targets.size() << endl;
+}
+
+void LiveTargets::modify(const LiveTarget &target) {
+    auto prepared = makeTarget(target);
+
+    lock_guard<mutex> lock(targetsMutex);
+    auto it = targets.find(target.name);
+    if (it == targets.end()) {
+        raiseLiveTargetException(target.name, "not found");
+    }
+    it->second = prepared;
+    cout << "LIVE_TARGET_MODIFIED=" << target.name << "/" << targets.size() << endl;
+}
+
+void LiveTargets::remove(const string &name) {
+    lock_guard<mutex> lock(targetsMutex);
+    if (targets.erase(name) == 0) {
+        raiseLiveTargetException(name, "not found");
+    }
+    cout << "LIVE_TARGET_REMOVED=" << name << "/" << targets.size() << endl;
+}
+
+void LiveTargets::render(const SweepClock &clock, u32 firstAcp, u32 rowCount, u32 *rows) {
+    lock_guard<mutex> lock(targetsMutex);
+
+    auto acpCnt = clock.acpCnt;
+    auto rotationAcp = firstAcp - firstAcp % acpCnt;
+    auto firstRow = firstAcp % acpCnt;
+
+    for (auto &entry : targets) {
+        auto &target = entry.second;
+        auto &definition = target.definition;
+        auto &shape = definition.hitShape;
+
+        // find the azimuth around the middle of the rows, then look again when the beam is there
+        double xKm, yKm;
+        if (!position(target, sweepTimeUs(target, clock, firstAcp + rowCount / 2), xKm, yKm)) {
+            continue;
+        }
+        auto acp = azimuthAcp(xKm, yKm, acpCnt);
+        if (!position(target, sweepTimeUs(target, clock, rotationAcp + acp), xKm, yKm)) {
+            continue;
+        }
+        acp = azimuthAcp(xKm, yKm, acpCnt);
+
+        auto signalUs = (s32) floor(sqrt(xKm * xKm + yKm * yKm) * LIVE_SIGNAL_US_PER_KM);
+        if (!(signalUs > shape.minSignalUs && signalUs < shape.maxSignalUs)) {
+            continue;
+        }
+
+        // a jamming source is detected from the minimum range up to its own distance
+        auto fromUs = definition.jammingSource ? shape.minSignalUs - 1 : signalUs;
+        auto toUs = MIN(signalUs + shape.lengthUs - 1, shape.maxSignalUs);
+
+        auto synchroUs = -1;
+        if (definition.synchroPulseDelayM != 0) {
+            auto delayUs = (s32) floor(definition.synchroPulseDelayM / 1000.0 * LIVE_SIGNAL_US_PER_KM);
+            synchroUs = MIN(MAX(0, signalUs + delayUs), shape.maxSignalUs);
+        }
+
+        for (auto d = -shape.acpSpread; d <= shape.acpSpread; d++) {
+            auto row = (u32) ((((s64) acp + d) % acpCnt + acpCnt) % acpCnt);
+            if (row < firstRow || row >= firstRow + rowCount) {
+                continue;
+            }
+
+            auto dst = rows + (row - firstRow) * TRIG_WORD_CNT;
+            setHitBits(dst, fromUs, toUs);
+            if (synchroUs >= 0) {
+                setHitBits(dst, synchroUs, MIN(synchroUs + shape.lengthUs - 1, shape.maxSignalUs));
+            }
+
+            // sectors are committed in beam order, the first hit rendered is the first one emitted
+            if (target.latencyPending && (!target.firstHitKnown || rotationAcp + row < target.firstHitAcp)) {
+                target.firstHitKnown = true;
+                target.firstHitAcp = rotationAcp + row;
+            }
+        }
+    }
+}
+
+void LiveTargets::reportEmitted(const SweepClock &clock) {
+    lock_guard<mutex> lock(targetsMutex);
+
+    for (auto &entry : targets) {
+        auto &target = entry.second;
+        if (!target.latencyPending || !target.firstHitKnown || clock.beamAcp <= target.firstHitAcp) {
+            continue;
+        }
+
+        // the refill wakes up some ACPs after the hit went out
+        auto emittedUs = chrono::duration<double, micro>(clock.now - target.startTime).count()
+                         - (clock.beamAcp - target.firstHitAcp) * clock.acpUs;
+        latencyMs = (s32) MAX(0.0, emittedUs / 1000);
+        target.latencyPending = false;
+
+        cout << "LIVE_TARGET_LATENCY_MS=" << entry.first << "/" << latencyMs << endl;
+    }
+}
+
+s32 LiveTargets::lastLatencyMs() {
+    lock_guard<mutex> lock(targetsMutex);
+    return latencyMs;
+}
+
+LiveTargets::Target LiveTargets::makeTarget(const LiveTarget &definition) {
+
+    if (definition.name.empty()) {
+        raiseLiveTargetException(definition.name, "missing name");
+    }
+
+    auto &shape = definition.hitShape;
+    if (shape.acpSpread < 0 || shape.lengthUs <= 0 || shape.maxSignalUs <= shape.minSignalUs) {
+        raiseLiveTargetException(definition.name, "invalid hit shape");
+    }
+
+    Target target;
+    target.definition = definition;
+    target.latencyPending = true;
+    target.firstHitKnown = false;
+    target.firstHitAcp = 0;
+
+    auto azRad = definition.azDeg * M_PI / 180;
+    auto x = definition.rKm * sin(azRad);
+    auto y = definition.rKm * cos(azRad);
+
+    if (definition.legs.empty()) {
+        // hovering or standing still
+        target.legs.push_back(Leg {x, y, x, y, 0, numeric_limits<double>::infinity()});
+    }
+
+    double t = 0;
+    for (auto &leg : definition.legs) {
+        if (leg.speedKmh <= 0) {
+            raiseLiveTargetException(definition.name, "leg speed must be positive");
+        }
+
+        auto legAzRad = leg.azDeg * M_PI / 180;
+        auto x2 = leg.rKm * sin(legAzRad);
+        auto y2 = leg.rKm * cos(legAzRad);
+        auto dt = sqrt((x2 - x) * (x2 - x) + (y2 - y) * (y2 - y)) / (leg.speedKmh / HOUR_TO_US);
+
+        target.legs.push_back(Leg {x, y, x2, y2, t, t + dt});
+
+        x = x2;
+        y = y2;
+        t += dt;
+    }
+
+    target.startTime = chrono::steady_clock::now();
+    return target;
+}
+
+bool LiveTargets::position(const Target &target, double tUs, double &xKm, double &yKm) {
+    for (auto &leg : target.legs) {
+        if (tUs >= leg.t1Us && tUs < leg.t2Us) {
+            auto f = isinf(leg.t2Us) ? 0 : (tUs - leg.t1Us) / (leg.t2Us - leg.t1Us);
+            xKm = leg.x1 + f * (leg.x2 - leg.x1);
+            yKm = leg.y1 + f * (leg.y2 - leg.y1);
+            return true;
+        }
+    }
+    return false;
+}
+
+double LiveTargets::sweepTimeUs(const Target &target, const SweepClock &clock, u32 acp) {
+    return chrono::duration<double, micro>(clock.now - target.startTime).count()
+           + ((s64) acp - (s64) clock.beamAcp) * clock.acpUs;
+}
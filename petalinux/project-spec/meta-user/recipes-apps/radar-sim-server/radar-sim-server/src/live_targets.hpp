@@ -0,0 +1,147 @@
+/*
+ * live_targets.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef LIVE_TARGETS_
+#define LIVE_TARGETS_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Round trip signal time per km of target distance, as the designer calculates it **/
+#define LIVE_SIGNAL_US_PER_KM       (2.0 / 300000.0 * 1000000.0)
+
+/** Reported latency until the first live target hit has been emitted **/
+#define LIVE_LATENCY_UNKNOWN        -1
+
+/** STRUCTS **/
+
+/**
+ * Relates the ACP index counted from the enable on, like simAcpIdx, to the time it is swept.
+ */
+struct SweepClock {
+    std::chrono::steady_clock::time_point now;
+
+    /** ACP under the beam at now **/
+    u32 beamAcp;
+
+    double acpUs;
+
+    u32 acpCnt;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Logs and throws the Thrift LiveTargetException.
+ */
+void raiseLiveTargetException(const std::string &name, const std::string &reason);
+
+/**
+ * ACP of the azimuth the given cartesian position is seen at, north being ACP 0.
+ */
+u32 azimuthAcp(double xKm, double yKm, u32 acpCnt);
+
+/**  CLASSES **/
+
+/**
+ * Point targets added, changed and removed while the simulation runs, rendered on top of the
+ * target map whenever a target ring sector is committed.
+ *
+ * The path of a target starts at the time it is added or modified and is flown exactly like
+ * the designer flies the targets of a scenario, i.e. a target without legs stands still and
+ * one with legs disappears once it has flown the last one.
+ */
+class LiveTargets {
+public:
+    /**
+     * Adds the target, raises LiveTargetException if one of the same name already exists.
+     */
+    void add(const ::hr::franp::rsim::LiveTarget &target);
+
+    /**
+     * Replaces the target of the same name, raises LiveTargetException if there is none.
+     */
+    void modify(const ::hr::franp::rsim::LiveTarget &target);
+
+    void remove(const std::string &name);
+
+    /**
+     * ORs the hits of all targets into the given rows of one rotation, firstAcp being the ACP
+     * of the first row counted like the beam position of the clock.
+     */
+    void render(const SweepClock &clock, u32 firstAcp, u32 rowCount, u32 *rows);
+
+    /**
+     * Reports the latency from the call to the first emitted hit of the targets whose first
+     * hit the beam has passed since the last call.
+     */
+    void reportEmitted(const SweepClock &clock);
+
+    /**
+     * Latency of the last target reported, LIVE_LATENCY_UNKNOWN if none was reported yet.
+     */
+    s32 lastLatencyMs();
+
+private:
+    /**
+     * Straight leg of a path in cartesian km, flown from t1Us to t2Us after the path started.
+     */
+    struct Leg {
+        double x1;
+        double y1;
+        double x2;
+        double y2;
+        double t1Us;
+        double t2Us;
+    };
+
+    struct Target {
+        ::hr::franp::rsim::LiveTarget definition;
+
+        std::vector<Leg> legs;
+
+        std::chrono::steady_clock::time_point startTime;
+
+        /** Whether the first hit after the last change still has to be reported **/
+        bool latencyPending;
+
+        bool firstHitKnown;
+
+        u32 firstHitAcp;
+    };
+
+    std::mutex targetsMutex;
+
+    std::map<std::string, Target> targets;
+
+    s32 latencyMs = LIVE_LATENCY_UNKNOWN;
+
+    /**
+     * Validates the target and prepares its path, starting now.
+     */
+    static Target makeTarget(const ::hr::franp::rsim::LiveTarget &definition);
+
+    /**
+     * Position of the target the given time after its path started, false if it is not flying then.
+     */
+    static bool position(const Target &target, double tUs, double &xKm, double &yKm);
+
+    /**
+     * Time after the path of the target started at which the beam sweeps the given ACP.
+     */
+    static double sweepTimeUs(const Target &target, const SweepClock &clock, u32 acp);
+};
+
+#endif /* LIVE_TARGETS_ */
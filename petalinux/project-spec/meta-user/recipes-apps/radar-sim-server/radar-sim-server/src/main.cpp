@@ -10,6 +10,7 @@
 #include <iostream>
 #include <csignal>
 #include <thread>
+#include <getopt.h>
 
 #include <boost/shared_ptr.hpp>
 #include <thrift/protocol/TBinaryProtocol.h>
@@ -26,17 +27,78 @@ using namespace ::apache::thrift::server;
 
 #include "radar_simulator.hpp"
 
-boost::shared_ptr<SimulatorHandler> handler(new SimulatorHandler());
-boost::shared_ptr<TProcessor> processor(new SimulatorProcessor(handler));
+boost::shared_ptr<SimulatorHandler> handler;
 
 void signalHandler(int signum) {
-    handler->reset();
+    if (handler) {
+        handler->reset();
+    }
     cout << "DISABLE_SIM INTR=" << signum << endl;
     exit(signum);
 }
 
+void usage(const char *name) {
+    cout << "Usage: " << name << " [--rt] [--rt-priority N] [--rt-cpu N] [--service-cpu N] [--sector-acps N] [--sector-lead N]"
+         << " [--clutter-depth N] [--clutter-loop N]" << endl;
+}
+
 int main(int argc, char *argv[]) {
 
+    RtProfile rtProfile;
+    RingProfile ringProfile;
+
+    const struct option options[] = {
+        {"rt",          no_argument,       NULL, 'r'},
+        {"rt-priority", required_argument, NULL, 'p'},
+        {"rt-cpu",      required_argument, NULL, 'c'},
+        {"service-cpu", required_argument, NULL, 's'},
+        {"sector-acps", required_argument, NULL, 'a'},
+        {"sector-lead", required_argument, NULL, 'l'},
+        {"clutter-depth", required_argument, NULL, 'd'},
+        {"clutter-loop", required_argument, NULL, 'o'},
+        {"help",        no_argument,       NULL, 'h'},
+        {NULL, 0,                          NULL, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "rp:c:s:a:l:d:o:h", options, NULL)) != -1) {
+        switch (opt) {
+            case 'r':
+                rtProfile.enabled = true;
+                break;
+            case 'p':
+                rtProfile.priority = atoi(optarg);
+                break;
+            case 'c':
+                rtProfile.refillCpu = atoi(optarg);
+                break;
+            case 's':
+                rtProfile.serviceCpu = atoi(optarg);
+                break;
+            case 'a':
+                ringProfile.sectorAcpCnt = (u32) atoi(optarg);
+                break;
+            case 'l':
+                ringProfile.sectorLead = (u32) atoi(optarg);
+                break;
+            case 'd':
+                ringProfile.clutterDepth = (u32) atoi(optarg);
+                break;
+            case 'o':
+                ringProfile.clutterLoop = (u32) atoi(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    // every thread started from here on inherits the service core
+    applyServiceProfile(rtProfile);
+
+    handler.reset(new SimulatorHandler(rtProfile, ringProfile));
+    boost::shared_ptr<TProcessor> processor(new SimulatorProcessor(handler));
+
     // register signal SIGINT and signal handler
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
@@ -0,0 +1,151 @@
+/*
+ * map_resampling.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <iostream>
+
+#include "map_resampling.hpp"
+#include "commit_kernels.hpp"
+
+using namespace std;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+RangeResampledSource::RangeResampledSource(shared_ptr<MapSource> source, u32 trigUs)
+    : source(source), firstBits(MAX_TRIG_BITS, 0), endBits(MAX_TRIG_BITS, 0) {
+
+    // segments are resolved by the wrapped source already
+    mapHeader = source->header();
+    mapHeader.trigUs = trigUs;
+    mapHeader.trigSize = MIN(MAX(source->header().trigSize * trigUs / source->header().trigUs, (u32) WORD_BITS), (u32) MAX_TRIG_BITS);
+
+    auto scale = (double) trigUs / source->header().trigUs;
+    for (u32 bit = WORD_BITS; bit < MAX_TRIG_BITS; bit++) {
+        auto first = (u32) floor(bit * scale);
+        auto end = MAX((u32) floor((bit + 1) * scale), first + 1);
+        firstBits[bit] = (u16) MIN(MAX(first, (u32) WORD_BITS), (u32) MAX_TRIG_BITS);
+        endBits[bit] = (u16) MIN(MAX(end, (u32) WORD_BITS), (u32) MAX_TRIG_BITS);
+    }
+}
+
+void RangeResampledSource::readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+
+    sourceRows.resize((size_t) rowCount * TRIG_WORD_CNT);
+    source->readRows(rotation, firstRow, rowCount, sourceRows.data());
+
+    for (u32 row = 0; row < rowCount; row++) {
+        auto src = sourceRows.data() + (size_t) row * TRIG_WORD_CNT;
+        auto out = dst + (size_t) row * TRIG_WORD_CNT;
+
+        // the first word carries nothing but the ACP index
+        out[0] = src[0] & ACP_IDX_MASK;
+        for (u32 w = 1; w < TRIG_WORD_CNT; w++) {
+            out[w] = 0;
+        }
+
+        for (u32 w = 1; w < TRIG_WORD_CNT; w++) {
+            for (auto bits = src[w]; bits != 0; bits &= bits - 1) {
+                auto bit = w * WORD_BITS + __builtin_ctz(bits);
+                for (u32 outBit = firstBits[bit]; outBit < endBits[bit]; outBit++) {
+                    out[outBit / WORD_BITS] |= 1u << (outBit % WORD_BITS);
+                }
+            }
+        }
+    }
+}
+
+AzimuthResampledSource::AzimuthResampledSource(shared_ptr<MapSource> source, u32 acpCnt, s32 acpOffset)
+    : source(source), firstRows(acpCnt, 0), endRows(acpCnt, 0) {
+
+    // segments are resolved by the wrapped source already
+    mapHeader = source->header();
+    mapHeader.acpCnt = acpCnt;
+
+    wrapAcp = (u32) (((s64) acpOffset % acpCnt + acpCnt) % acpCnt);
+
+    auto fileAcpCnt = source->header().acpCnt;
+    for (u32 acp = 0; acp < acpCnt; acp++) {
+        auto fileAcp = (acp + acpCnt - wrapAcp) % acpCnt;
+        if (acpCnt >= fileAcpCnt) {
+            // the file row the middle of the ACP falls into, duplicated over the neighbours
+            firstRows[acp] = MIN((u32) (((u64) fileAcp * 2 + 1) * fileAcpCnt / (2 * (u64) acpCnt)), fileAcpCnt - 1);
+            endRows[acp] = firstRows[acp] + 1;
+        } else {
+            // every file row ORed into exactly one ACP
+            firstRows[acp] = (u32) ((u64) fileAcp * fileAcpCnt / acpCnt);
+            endRows[acp] = (u32) ((u64) (fileAcp + 1) * fileAcpCnt / acpCnt);
+        }
+    }
+}
+
+void AzimuthResampledSource::readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+
+    auto acpCnt = mapHeader.acpCnt;
+
+    // resolve rotation by rotation as the rows of the wrapped source do
+    rotation += firstRow / acpCnt;
+    firstRow %= acpCnt;
+    while (rowCount > 0) {
+        auto rows = MIN(rowCount, acpCnt - firstRow);
+        if (firstRow < wrapAcp) {
+            rows = MIN(rows, wrapAcp - firstRow);
+        }
+        readRotationRows(rotation, firstRow, rows, dst);
+
+        dst += rows * TRIG_WORD_CNT;
+        rowCount -= rows;
+        firstRow += rows;
+        if (firstRow == acpCnt) {
+            rotation++;
+            firstRow = 0;
+        }
+    }
+}
+
+void AzimuthResampledSource::readRotationRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+
+    // the file rows of the ACPs are contiguous up to the wrap, read in one go
+    auto fileFirst = firstRows[firstRow];
+    auto fileCount = endRows[firstRow + rowCount - 1] - fileFirst;
+    sourceRows.resize((size_t) fileCount * TRIG_WORD_CNT);
+    source->readRows(rotation, fileFirst, fileCount, sourceRows.data());
+
+    for (u32 i = 0; i < rowCount; i++) {
+        auto acp = firstRow + i;
+        auto out = dst + (size_t) i * TRIG_WORD_CNT;
+        auto src = sourceRows.data() + (size_t) (firstRows[acp] - fileFirst) * TRIG_WORD_CNT;
+
+        memcpy(out, src, ROW_BYTE_SIZE);
+        for (auto row = firstRows[acp] + 1; row < endRows[acp]; row++) {
+            src += TRIG_WORD_CNT;
+            orRows(out, src, ROW_BYTE_SIZE);
+        }
+        out[0] = (out[0] & ~ACP_IDX_MASK) | acp;
+    }
+}
+
+shared_ptr<MapSource> rangeResampledSource(shared_ptr<MapSource> source, u32 trigUs) {
+    auto fileTrigUs = source->header().trigUs;
+    if (fileTrigUs == 0 || trigUs == 0 || fileTrigUs == trigUs) {
+        return source;
+    }
+
+    cout << "RANGE_RESAMPLE=" << fileTrigUs << "/" << trigUs << endl;
+    return make_shared<RangeResampledSource>(source, trigUs);
+}
+
+shared_ptr<MapSource> azimuthResampledSource(shared_ptr<MapSource> source, u32 acpCnt, s32 acpOffset) {
+    auto fileAcpCnt = source->header().acpCnt;
+    if (fileAcpCnt == 0 || acpCnt == 0 || (fileAcpCnt == acpCnt && acpOffset % (s64) acpCnt == 0)) {
+        return source;
+    }
+
+    cout << "AZIMUTH_RESAMPLE=" << fileAcpCnt << "/" << acpCnt << "/" << acpOffset << endl;
+    return make_shared<AzimuthResampledSource>(source, acpCnt, acpOffset);
+}
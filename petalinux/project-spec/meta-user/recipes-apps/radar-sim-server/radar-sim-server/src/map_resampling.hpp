@@ -0,0 +1,88 @@
+/*
+ * map_resampling.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef MAP_RESAMPLING_
+#define MAP_RESAMPLING_
+
+#include "radar_map.hpp"
+
+#include <memory>
+#include <vector>
+
+/**  CLASSES **/
+
+/**
+ * Plays a map built for another trigger period, its range extent (one bit per microsecond
+ * of the file trigger period) stretched or squeezed onto the calibrated one.
+ *
+ * Every hit bit of the file is looked up in a table of the output bits it covers, so the
+ * cost follows the hits rather than the row size. Squeezing ORs neighbouring bits together,
+ * stretching widens each hit, no hit is ever lost.
+ */
+class RangeResampledSource : public MapSource {
+public:
+    RangeResampledSource(std::shared_ptr<MapSource> source, u32 trigUs);
+
+    void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+
+    u64 rowCount() const {
+        return source->rowCount();
+    }
+
+private:
+    std::shared_ptr<MapSource> source;
+
+    /** First and one past the last output bit of each file bit **/
+    std::vector<u16> firstBits;
+    std::vector<u16> endBits;
+
+    std::vector<u32> sourceRows;
+};
+
+/**
+ * Plays a map built for another ACP count, every calibrated ACP taking the file row nearest
+ * to it when the radar has more ACPs, or the file rows it covers ORed together when it has
+ * fewer. The ACP index of each row is rewritten to the calibrated one.
+ *
+ * The rotation is also turned clockwise by acpOffset calibrated ACPs this way, the file rows
+ * relabelled rather than moved.
+ */
+class AzimuthResampledSource : public MapSource {
+public:
+    AzimuthResampledSource(std::shared_ptr<MapSource> source, u32 acpCnt, s32 acpOffset);
+
+    void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+
+private:
+    std::shared_ptr<MapSource> source;
+
+    /** First and one past the last file row of each calibrated ACP **/
+    std::vector<u32> firstRows;
+    std::vector<u32> endRows;
+
+    std::vector<u32> sourceRows;
+
+    /** First ACP of the turned rotation, the file rows wrap around there **/
+    u32 wrapAcp;
+
+    void readRotationRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Returns the source played on a radar of the given trigger period, i.e. the source wrapped
+ * into a RangeResampledSource if it was built for another one.
+ */
+std::shared_ptr<MapSource> rangeResampledSource(std::shared_ptr<MapSource> source, u32 trigUs);
+
+/**
+ * Returns the source played on a radar of the given ACP count turned by the given ACPs, i.e.
+ * the source wrapped into an AzimuthResampledSource if it was built for another one or turned.
+ */
+std::shared_ptr<MapSource> azimuthResampledSource(std::shared_ptr<MapSource> source, u32 acpCnt, s32 acpOffset);
+
+#endif /* MAP_RESAMPLING_ */
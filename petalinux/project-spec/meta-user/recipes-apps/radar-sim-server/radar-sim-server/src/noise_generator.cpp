@@ -0,0 +1,169 @@
+/*
+ * noise_generator.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <iostream>
+
+#include "noise_generator.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+#define GOLDEN_GAMMA            0x9e3779b97f4a7c15ULL
+
+/** Poisson tail beyond this many standard deviations is left out of the count table **/
+#define NOISE_CDF_SIGMAS        12
+
+/**
+ * splitmix64, spreads a seed over the generator state.
+ */
+static u64 splitMix(u64 &state) {
+    auto z = (state += GOLDEN_GAMMA);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+void NoiseRandom::seed(u64 seed) {
+    for (u32 lane = 0; lane < NOISE_LANES; lane++) {
+        for (u32 i = 0; i < 4; i += 2) {
+            auto bits = splitMix(seed);
+            state[i][lane] = (u32) bits;
+            state[i + 1][lane] = (u32) (bits >> 32);
+        }
+        // an all zero lane would stay zero
+        if ((state[0][lane] | state[1][lane] | state[2][lane] | state[3][lane]) == 0) {
+            state[0][lane] = 1;
+        }
+    }
+    batchPos = NOISE_BATCH_WORDS;
+}
+
+void NoiseRandom::seed(u64 seed, u32 rotation) {
+    this->seed(seed ^ ((u64) rotation * GOLDEN_GAMMA));
+}
+
+void NoiseRandom::refill() {
+
+#ifdef __ARM_NEON
+    uint32x4_t x = vld1q_u32(state[0]);
+    uint32x4_t y = vld1q_u32(state[1]);
+    uint32x4_t z = vld1q_u32(state[2]);
+    uint32x4_t w = vld1q_u32(state[3]);
+    for (u32 i = 0; i < NOISE_BATCH_WORDS; i += NOISE_LANES) {
+        uint32x4_t t = veorq_u32(x, vshlq_n_u32(x, 11));
+        x = y;
+        y = z;
+        z = w;
+        w = veorq_u32(veorq_u32(w, vshrq_n_u32(w, 19)), veorq_u32(t, vshrq_n_u32(t, 8)));
+        vst1q_u32(batch + i, w);
+    }
+    vst1q_u32(state[0], x);
+    vst1q_u32(state[1], y);
+    vst1q_u32(state[2], z);
+    vst1q_u32(state[3], w);
+#else
+    for (u32 i = 0; i < NOISE_BATCH_WORDS; i += NOISE_LANES) {
+        for (u32 lane = 0; lane < NOISE_LANES; lane++) {
+            auto t = state[0][lane] ^ (state[0][lane] << 11);
+            state[0][lane] = state[1][lane];
+            state[1][lane] = state[2][lane];
+            state[2][lane] = state[3][lane];
+            state[3][lane] ^= (state[3][lane] >> 19) ^ t ^ (t >> 8);
+            batch[i + lane] = state[3][lane];
+        }
+    }
+#endif
+
+    batchPos = 0;
+}
+
+void NoiseGenerator::set(u64 seed, const vector<NoiseRegion> &definitions) {
+    vector<Region> prepared;
+    for (auto &definition : definitions) {
+        auto region = makeRegion(definition);
+        if (!region.countCdf.empty()) {
+            prepared.push_back(region);
+        }
+    }
+
+    lock_guard<mutex> lock(regionsMutex);
+    noiseSeed = seed;
+    regions.swap(prepared);
+    cout << "NOISE_REGIONS=" << regions.size() << "/" << definitions.size() << "/" << seed << endl;
+}
+
+void NoiseGenerator::render(u32 rotation, u32 acpCnt, u32 *rows) {
+    lock_guard<mutex> lock(regionsMutex);
+    if (regions.empty()) {
+        return;
+    }
+
+    random.seed(noiseSeed, rotation);
+
+    for (auto &region : regions) {
+        auto firstAcp = MIN((u32) (region.fromAzDeg / 360 * acpCnt), acpCnt - 1);
+        auto acpSpan = MIN(MAX((u32) round(region.spanDeg / 360 * acpCnt), 1u), acpCnt);
+        auto &cdf = region.countCdf;
+
+        for (u32 i = 0; i < acpSpan; i++) {
+            auto dst = rows + (firstAcp + i) % acpCnt * TRIG_WORD_CNT;
+
+            // hits may coincide, which only matters for densities no radar shows
+            auto hitCnt = (u32) (upper_bound(cdf.begin(), cdf.end(), random.next()) - cdf.begin());
+            hitCnt = MIN(hitCnt, (u32) cdf.size() - 1);
+            for (u32 hit = 0; hit < hitCnt; hit++) {
+                auto bit = region.fromUs + (u32) (((u64) random.next() * region.bitCount) >> 32);
+                dst[bit / WORD_BITS] |= 1u << (bit % WORD_BITS);
+            }
+        }
+    }
+}
+
+NoiseGenerator::Region NoiseGenerator::makeRegion(const NoiseRegion &definition) {
+    Region region;
+
+    region.fromAzDeg = fmod(definition.fromAzDeg, 360);
+    if (region.fromAzDeg < 0) {
+        region.fromAzDeg += 360;
+    }
+    region.spanDeg = fmod(definition.toAzDeg - definition.fromAzDeg, 360);
+    if (region.spanDeg <= 0) {
+        region.spanDeg += 360;
+    }
+
+    // the first word carries the ACP index
+    auto fromUs = MAX(definition.fromSignalUs, (s32) WORD_BITS);
+    auto toUs = MIN(definition.toSignalUs, (s32) MAX_TRIG_BITS - 1);
+    region.fromUs = (u32) fromUs;
+    region.bitCount = toUs >= fromUs ? (u32) (toUs - fromUs + 1) : 0;
+
+    auto density = MIN(MAX(definition.density, 0.0), 1.0);
+    auto mean = density * region.bitCount;
+    if (mean <= 0) {
+        return region;
+    }
+
+    // built in the log domain, exp(-mean) underflows for dense regions
+    auto maxCnt = MIN((u32) (mean + NOISE_CDF_SIGMAS * sqrt(mean) + NOISE_CDF_SIGMAS), region.bitCount);
+    double cumulative = 0;
+    for (u32 k = 0; k <= maxCnt; k++) {
+        cumulative += exp(-mean + k * log(mean) - lgamma(k + 1.0));
+        region.countCdf.push_back((u32) MIN(cumulative * 4294967296.0, 4294967295.0));
+    }
+    region.countCdf.back() = UINT32_MAX;
+
+    return region;
+}
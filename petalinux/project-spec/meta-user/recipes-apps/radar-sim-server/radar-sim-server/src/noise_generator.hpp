@@ -0,0 +1,106 @@
+/*
+ * noise_generator.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef NOISE_GENERATOR_
+#define NOISE_GENERATOR_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <mutex>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Independent xorshift128 generators stepped side by side, one per NEON lane **/
+#define NOISE_LANES             4
+
+/** Random words generated per refill of the random buffer **/
+#define NOISE_BATCH_WORDS       256
+
+/**  CLASSES **/
+
+/**
+ * Random words of a 4 lane xorshift128 generator, stepped with NEON where available. The
+ * scalar path steps the very same lanes, so a seed gives the same words on the board and
+ * on a host.
+ */
+class NoiseRandom {
+public:
+    void seed(u64 seed);
+
+    /**
+     * Seeds the words of the given scenario rotation, which do not depend on what was drawn
+     * for the rotations before it.
+     */
+    void seed(u64 seed, u32 rotation);
+
+    u32 next() {
+        if (batchPos == NOISE_BATCH_WORDS) {
+            refill();
+        }
+        return batch[batchPos++];
+    }
+
+private:
+    /** x, y, z and w of each lane, lane by lane **/
+    u32 state[4][NOISE_LANES];
+
+    u32 batch[NOISE_BATCH_WORDS];
+
+    u32 batchPos = NOISE_BATCH_WORDS;
+
+    void refill();
+};
+
+/**
+ * Thermal noise and false alarms ORed into the clutter rotations as they are refilled.
+ *
+ * Each region gets a Poisson distributed number of false hits per row, the mean being its
+ * density times its range extent, spread uniformly over its range. Every rotation is seeded
+ * from the seed and its scenario rotation, so an exercise replays the very same noise no
+ * matter when the rotation is refilled.
+ */
+class NoiseGenerator {
+public:
+    /**
+     * Replaces the regions, densities are clamped to [0, 1].
+     */
+    void set(u64 seed, const std::vector<::hr::franp::rsim::NoiseRegion> &regions);
+
+    /**
+     * ORs the false hits of the given scenario rotation into its acpCnt rows.
+     */
+    void render(u32 rotation, u32 acpCnt, u32 *rows);
+
+private:
+    struct Region {
+        double fromAzDeg;
+
+        /** Clockwise extent, (0, 360] **/
+        double spanDeg;
+
+        u32 fromUs;
+
+        u32 bitCount;
+
+        /** Scaled (2^32) cumulative Poisson distribution of the hit count of a row **/
+        std::vector<u32> countCdf;
+    };
+
+    std::mutex regionsMutex;
+
+    u64 noiseSeed = 0;
+
+    std::vector<Region> regions;
+
+    NoiseRandom random;
+
+    static Region makeRegion(const ::hr::franp::rsim::NoiseRegion &definition);
+};
+
+#endif /* NOISE_GENERATOR_ */
@@ -0,0 +1,220 @@
+/*
+ * radar_map.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "radar_map.hpp"
+
+using namespace std;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+#define FNV_OFFSET_BASIS        0xcbf29ce484222325ULL
+#define FNV_PRIME               0x100000001b3ULL
+
+u64 contentHash(const void *data, size_t byteSize) {
+    auto bytes = (const u8 *) data;
+    u64 hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < byteSize; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+bool isEmptyRow(const u32 *row) {
+    u32 hits = row[0] & ~ACP_IDX_MASK;
+    for (u32 w = 1; w < TRIG_WORD_CNT; w++) {
+        hits |= row[w];
+    }
+    return hits == 0;
+}
+
+u64 rowKey(const u32 *row) {
+    if (isEmptyRow(row)) {
+        return EMPTY_ROW_KEY_FLAG | row[0];
+    }
+    return contentHash(row, ROW_BYTE_SIZE) & ~EMPTY_ROW_KEY_FLAG;
+}
+
+u64 rowsHash(const u32 *rows, u32 rowCount) {
+    vector<u64> keys;
+    return rowsHash(rows, rowCount, keys);
+}
+
+u64 rowsHash(const u32 *rows, u32 rowCount, vector<u64> &keys) {
+    keys.resize(rowCount);
+    for (u32 row = 0; row < rowCount; row++) {
+        keys[row] = rowKey(rows + row * TRIG_WORD_CNT);
+    }
+    return contentHash(keys.data(), keys.size() * sizeof(u64));
+}
+
+bool isValidSegmentTable(const vector<MapSegment> &segments, u32 storedRotations) {
+    for (u32 i = 0; i < segments.size(); i++) {
+        auto &segment = segments[i];
+        if (segment.first > segment.last || segment.last >= storedRotations) {
+            return false;
+        }
+        if (segment.count == MAP_SEGMENT_ENDLESS && i + 1 < segments.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+u32 playbackRotationCount(const vector<MapSegment> &segments) {
+    u64 rotations = 0;
+    for (auto &segment : segments) {
+        if (segment.count == MAP_SEGMENT_ENDLESS) {
+            return MAP_ENDLESS_ROTATIONS;
+        }
+        rotations += (u64) (segment.last - segment.first + 1) * segment.count;
+    }
+    return (u32) MIN(rotations, (u64) MAP_ENDLESS_ROTATIONS - 1);
+}
+
+FileMapSource::FileMapSource(const string &fileName)
+    : input(fileName, ios_base::in | ios_base::binary) {
+
+    storedRowCount = 0;
+
+    opened = input && input.is_open();
+    if (opened) {
+        input.read((char *) &mapHeader, MAP_HEADER_BYTE_SIZE);
+        opened = input.gcount() == MAP_HEADER_BYTE_SIZE;
+    }
+
+    if (opened) {
+        input.seekg(0, ios_base::end);
+        auto fileByteSize = (u64) input.tellg();
+
+        u64 trailerByteSize = 0;
+        opened = readSegments(fileByteSize, trailerByteSize);
+
+        storedRowCount = MIN((fileByteSize - MAP_HEADER_BYTE_SIZE - trailerByteSize) / ROW_BYTE_SIZE, MapSource::rowCount());
+    }
+}
+
+bool FileMapSource::readSegments(u64 fileByteSize, u64 &trailerByteSize) {
+
+    trailerByteSize = 0;
+    if (fileByteSize < MAP_HEADER_BYTE_SIZE + MAP_TRAILER_BYTE_SIZE) {
+        return true;
+    }
+
+    u32 trailer[2];
+    input.clear();
+    input.seekg(fileByteSize - MAP_TRAILER_BYTE_SIZE);
+    input.read((char *) trailer, MAP_TRAILER_BYTE_SIZE);
+    if (input.gcount() != MAP_TRAILER_BYTE_SIZE || trailer[1] != MAP_SEGMENT_MAGIC) {
+        return true;
+    }
+
+    // a table never ends on a row boundary, plain rows that merely end like one always do
+    auto segmentCnt = trailer[0];
+    auto rowsByteSize = fileByteSize - MAP_HEADER_BYTE_SIZE;
+    auto tableByteSize = (u64) segmentCnt * MAP_SEGMENT_BYTE_SIZE + MAP_TRAILER_BYTE_SIZE;
+    if (segmentCnt == 0
+        || segmentCnt > MAP_MAX_SEGMENT_CNT
+        || tableByteSize > rowsByteSize
+        || (rowsByteSize - tableByteSize) % ROW_BYTE_SIZE != 0) {
+        return true;
+    }
+
+    mapSegments.resize(segmentCnt);
+    input.seekg(fileByteSize - tableByteSize);
+    input.read((char *) mapSegments.data(), segmentCnt * MAP_SEGMENT_BYTE_SIZE);
+    if (input.gcount() != (streamsize) (segmentCnt * MAP_SEGMENT_BYTE_SIZE) || mapHeader.acpCnt == 0) {
+        return false;
+    }
+
+    trailerByteSize = tableByteSize;
+
+    auto storedRotations = MIN((rowsByteSize - tableByteSize) / ROW_BYTE_SIZE / mapHeader.acpCnt, (u64) mapHeader.blockCount);
+    return isValidSegmentTable(mapSegments, (u32) storedRotations);
+}
+
+u64 FileMapSource::rowCount() const {
+    return storedRowCount;
+}
+
+void FileMapSource::readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+
+    auto byteSize = (streamsize) (rowCount * ROW_BYTE_SIZE);
+    streamsize readSize = 0;
+
+    if (opened) {
+        // use 64bit offsets, scenario files easily exceed 4GB
+        auto offset = (streamoff) MAP_HEADER_BYTE_SIZE
+                      + ((streamoff) rotation * mapHeader.acpCnt + firstRow) * ROW_BYTE_SIZE;
+
+        input.clear();
+        input.seekg(offset);
+        input.read((char *) dst, byteSize);
+        readSize = input.gcount();
+    }
+
+    // clear whatever is past the EOF instead of leaving stale rows behind
+    if (readSize < byteSize) {
+        memset(((char *) dst) + readSize, 0x0, (size_t) (byteSize - readSize));
+    }
+}
+
+SegmentMapSource::SegmentMapSource(shared_ptr<MapSource> source) : source(source) {
+
+    mapHeader = source->header();
+    mapSegments = source->segments();
+    mapHeader.blockCount = playbackRotationCount(mapSegments);
+
+    u64 start = 0;
+    for (auto &segment : mapSegments) {
+        segmentStarts.push_back(start);
+        start += (u64) (segment.last - segment.first + 1) * segment.count;
+    }
+}
+
+void SegmentMapSource::readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+
+    auto acpCnt = mapHeader.acpCnt;
+
+    // resolve rotation by rotation, the rows of a rotation are contiguous in the source
+    rotation += firstRow / acpCnt;
+    firstRow %= acpCnt;
+    while (rowCount > 0) {
+        auto rows = MIN(rowCount, acpCnt - firstRow);
+        source->readRows(storedRotation(rotation), firstRow, rows, dst);
+
+        dst += rows * TRIG_WORD_CNT;
+        rowCount -= rows;
+        rotation++;
+        firstRow = 0;
+    }
+}
+
+u32 SegmentMapSource::storedRotation(u32 rotation) const {
+
+    auto segmentIdx = upper_bound(segmentStarts.begin(), segmentStarts.end(), (u64) rotation) - segmentStarts.begin() - 1;
+    auto &segment = mapSegments[segmentIdx];
+
+    auto length = (u64) segment.last - segment.first + 1;
+    auto offset = rotation - segmentStarts[segmentIdx];
+    if (segment.count != MAP_SEGMENT_ENDLESS && offset >= length * segment.count) {
+        // past the end of the playback, the source clears it
+        return source->header().blockCount;
+    }
+
+    return segment.first + (u32) (offset % length);
+}
+
+shared_ptr<MapSource> playbackSource(shared_ptr<MapSource> source) {
+    if (source->segments().empty()) {
+        return source;
+    }
+    return make_shared<SegmentMapSource>(source);
+}
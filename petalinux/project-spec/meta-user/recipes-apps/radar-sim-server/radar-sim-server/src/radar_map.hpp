@@ -0,0 +1,216 @@
+/*
+ * radar_map.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef RADAR_MAP_
+#define RADAR_MAP_
+
+#include "xilinx/xil_types.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**  CONSTANTS **/
+#define WORD_SIZE               (sizeof(u32))
+#define WORD_BITS               (8 * WORD_SIZE)
+#define MAX_TRIG_BITS           (3072)
+#define TRIG_WORD_CNT           (MAX_TRIG_BITS / WORD_BITS)
+#define ROW_BYTE_SIZE           (TRIG_WORD_CNT * WORD_SIZE)
+
+/** The lower 16 bits of the first word of each row carry the ACP index of the row **/
+#define ACP_IDX_MASK            0x0000FFFF
+
+/** Keys of the rows without hits, which are told apart by their ACP index alone **/
+#define EMPTY_ROW_KEY_FLAG      (1ULL << 63)
+
+#define MAP_HEADER_BYTE_SIZE    (5 * WORD_SIZE)
+
+/** Optional segment table at the end of a map file: segments, segment count, magic **/
+#define MAP_SEGMENT_MAGIC       0x4D474553
+#define MAP_SEGMENT_BYTE_SIZE   (3 * WORD_SIZE)
+#define MAP_TRAILER_BYTE_SIZE   (2 * WORD_SIZE)
+#define MAP_MAX_SEGMENT_CNT     65536
+
+/** Segment count of a segment played until the map is replaced **/
+#define MAP_SEGMENT_ENDLESS     0
+
+/** Rotation count of a map that plays forever **/
+#define MAP_ENDLESS_ROTATIONS   UINT32_MAX
+
+/** Common location of the maps loaded by loadMap **/
+#define CLUTTER_MAP_FILE        "/var/clutter.bin"
+#define TARGET_MAP_FILE         "/var/targets.bin"
+
+/** STRUCTS **/
+
+/**
+ * Header of the clutter and target map files, as written by the designer.
+ */
+struct MapHeader {
+    u32 arpUs;
+    u32 acpCnt;
+    u32 trigUs;
+    u32 trigSize;
+    u32 blockCount;
+};
+
+/**
+ * Playback segment of a map file: the stored rotations first..last, played count times in a
+ * row. A rotation N repeated K times is {N, N, K}, an endless loop over A..B is
+ * {A, B, MAP_SEGMENT_ENDLESS}, which only the last segment may be.
+ *
+ * Maps with a segment table play the segments in order and their header block count is
+ * the number of rotations stored. Maps without one play the stored rotations in order.
+ */
+struct MapSegment {
+    u32 first;
+    u32 last;
+    u32 count;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * 64bit FNV-1a hash of the given bytes, used to identify rotation and row contents.
+ * The designer calculates the very same hash on its side.
+ */
+u64 contentHash(const void *data, size_t byteSize);
+
+/**
+ * Returns true when the row has no hits, i.e. carries nothing but its ACP index.
+ */
+bool isEmptyRow(const u32 *row);
+
+/**
+ * Key identifying the row contents: the content hash of a row with hits, the ACP index
+ * flagged with EMPTY_ROW_KEY_FLAG of a row without.
+ */
+u64 rowKey(const u32 *row);
+
+/**
+ * Content hash of the keys of the given rows, which the ring calculates from the keys of the
+ * pool rows its BDs point to without touching the rows.
+ */
+u64 rowsHash(const u32 *rows, u32 rowCount);
+
+/**
+ * The same, collecting the row keys in the given scratch vector instead of allocating one.
+ */
+u64 rowsHash(const u32 *rows, u32 rowCount, std::vector<u64> &keys);
+
+/**
+ * Returns true if all segments reference stored rotations and only the last one is endless.
+ */
+bool isValidSegmentTable(const std::vector<MapSegment> &segments, u32 storedRotations);
+
+/**
+ * Number of rotations the segments play, MAP_ENDLESS_ROTATIONS if they end in an endless loop.
+ */
+u32 playbackRotationCount(const std::vector<MapSegment> &segments);
+
+/**  CLASSES **/
+
+/**
+ * A source of map rows (one row per ACP, TRIG_WORD_CNT words each) the ring is refilled from.
+ *
+ * Rows are addressed linearly, i.e. row (rotation * acpCnt + row) of the map, so a read
+ * that runs past the end of a rotation continues with the next one, exactly as the
+ * contiguous file layout does.
+ */
+class MapSource {
+public:
+    virtual ~MapSource() {}
+
+    const MapHeader &header() const {
+        return mapHeader;
+    }
+
+    /**
+     * Copies rowCount rows starting at the given rotation and row into dst.
+     * Rows past the end of the map are zeroed.
+     */
+    virtual void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) = 0;
+
+    /**
+     * Returns the number of rows actually present in the map.
+     */
+    virtual u64 rowCount() const {
+        return (u64) mapHeader.blockCount * mapHeader.acpCnt;
+    }
+
+    /**
+     * Returns the playback segments of the map, empty if the rotations simply play in order.
+     */
+    const std::vector<MapSegment> &segments() const {
+        return mapSegments;
+    }
+
+protected:
+    MapHeader mapHeader = MapHeader();
+
+    std::vector<MapSegment> mapSegments;
+};
+
+/**
+ * Map rows read on demand from a map file.
+ */
+class FileMapSource : public MapSource {
+public:
+    explicit FileMapSource(const std::string &fileName);
+
+    bool isOpen() const {
+        return opened;
+    }
+
+    void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+
+    /**
+     * Returns the number of rows stored in the file, which can be less than the header
+     * announces as the designer caps the file size.
+     */
+    u64 rowCount() const;
+
+private:
+    std::ifstream input;
+
+    bool opened;
+
+    u64 storedRowCount;
+
+    /**
+     * Reads the segment table, if any, along with the bytes it occupies at the end of the file.
+     * Returns false if the table is corrupted.
+     */
+    bool readSegments(u64 fileByteSize, u64 &trailerByteSize);
+};
+
+/**
+ * Plays the rotations of another source as its segments say, i.e. rotation r of this source
+ * is the stored rotation the segments resolve r to. No rotation is stored twice for it.
+ */
+class SegmentMapSource : public MapSource {
+public:
+    explicit SegmentMapSource(std::shared_ptr<MapSource> source);
+
+    void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+
+private:
+    u32 storedRotation(u32 rotation) const;
+
+    std::shared_ptr<MapSource> source;
+
+    /** First rotation played by each segment **/
+    std::vector<u64> segmentStarts;
+};
+
+/**
+ * Returns the source to refill the rings from, i.e. the source wrapped into a
+ * SegmentMapSource if it has playback segments.
+ */
+std::shared_ptr<MapSource> playbackSource(std::shared_ptr<MapSource> source);
+
+#endif /* RADAR_MAP_ */
@@ -24,6 +24,7 @@ using namespace std;
 
 #define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
 #define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+#define ROUND_UP(X, Y) ((((X) + (Y) - 1) / (Y)) * (Y))
 
 void FXAxiDma_DumpBd(XAxiDma_Bd *BdPtr) {
     cout << "Dump BD " << PADHEX(8, BdPtr) << endl;
@@ -83,16 +84,21 @@ void dumpMem(char const *data, size_t const bytes) {
     }
 }
 
-void SimulatorHandler::stopDmaTransfer(XAxiDma *dmaPtr) {
-    // TODO: RESET and Reinitialize
-    //XAxiDma_Reset(dmaPtr);
+bool SimulatorHandler::stopDmaTransfer(XAxiDma *dmaPtr) {
+    XAxiDma_Reset(dmaPtr);
+
+    // the reset waits for the transfer in flight
+    for (int timeOut = DMA_RESET_TIMEOUT; timeOut > 0; timeOut--) {
+        if (XAxiDma_ResetIsDone(dmaPtr)) {
+            return true;
+        }
+    }
+    return false;
 }
 
-XAxiDma_Bd *SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
-                                               UINTPTR physMemAddr,
-                                               u32 simBlockByteSize,
-                                               int blockCount,
-                                               XAxiDma_Bd *oldFirstBtPtr) {
+void SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
+                                        PooledRing &ring,
+                                        u32 firstRow) {
 
     XAxiDma_Bd *firstBdPtr;
     XAxiDma_Bd *prevBdPtr;
@@ -101,23 +107,12 @@ XAxiDma_Bd *SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
 
     XAxiDma_BdRing *txRingPtr = XAxiDma_GetTxRing(dmaPtr);
 
-    // free old BDs
-    if (oldFirstBtPtr) {
-        cout << "DMA_INIT_CLEAN_OLD" << endl;
-        int oldBdCnt = XAxiDma_BdRingFromHw(txRingPtr, XAXIDMA_ALL_BDS, &oldFirstBtPtr);
-        if (oldBdCnt > 0) {
-            cout << "DMA_INIT_CLEAN_OLD_CNT=" << oldBdCnt << endl;
-            status = XAxiDma_BdRingFree(txRingPtr, oldBdCnt, oldFirstBtPtr); // Return the list
-            if (status != XST_SUCCESS) {
-                RAISE(DmaInitFailedException, "Unable to clean old BD ring");
-            }
-        }
-    }
+    cout << "DMA_INIT_BLOCK_SIZE=" << ROW_BYTE_SIZE << endl;
 
-    cout << "DMA_INIT_BLOCK_SIZE=" << simBlockByteSize << endl;
-
-    int bdCount = max(2, blockCount);
-    cout << "DMA_INIT_BD_COUNT=" << bdCount << endl;
+    // one BD per row, each pointing to the pool row the ring holds for it
+    auto rowAddresses = ring.rowAddresses();
+    int bdCount = rowAddresses.size();
+    cout << "DMA_INIT_BD_COUNT=" << bdCount << "/" << firstRow << endl;
 
     /* Allocate a couple of BD */
     status = XAxiDma_BdRingAlloc(txRingPtr, bdCount, &firstBdPtr);
@@ -130,14 +125,14 @@ XAxiDma_Bd *SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
     cout << "DMA_INIT_FIRST_BD_PTR " << PADHEX(8, firstBdPtr) << endl;
 
     currBdPtr = firstBdPtr;
-    u32 memIdx = 0;
     for (int i = 0; i < bdCount; i++) {
+        auto row = (firstRow + i) % bdCount;
 
         /* Set up the BD using the information of the packet to transmit */
-        status = XAxiDma_BdSetBufAddr(currBdPtr, physMemAddr + memIdx * simBlockByteSize);
+        status = XAxiDma_BdSetBufAddr(currBdPtr, rowAddresses[row]);
         if (status != XST_SUCCESS) {
             cerr << "Tx set buffer addr "
-                 << PADHEX(8, physMemAddr + memIdx * simBlockByteSize)
+                 << PADHEX(8, rowAddresses[row])
                  << " on BD "
                  << PADHEX(8, currBdPtr)
                  << " failed with status "
@@ -146,10 +141,10 @@ XAxiDma_Bd *SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
             RAISE(DmaInitFailedException, "Unable to set BD buffer address");
         }
 
-        status = XAxiDma_BdSetLength(currBdPtr, simBlockByteSize, txRingPtr->MaxTransferLen);
+        status = XAxiDma_BdSetLength(currBdPtr, ROW_BYTE_SIZE, txRingPtr->MaxTransferLen);
         if (status != XST_SUCCESS) {
             cerr << "Tx set length "
-                 << simBlockByteSize
+                 << ROW_BYTE_SIZE
                  << " on BD "
                  << PADHEX(8, currBdPtr)
                  << " failed with status "
@@ -158,17 +153,11 @@ XAxiDma_Bd *SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
             RAISE(DmaInitFailedException, "Unable to set BD buffer length");
         }
 
-        XAxiDma_BdSetId(currBdPtr, i);
+        XAxiDma_BdSetId(currBdPtr, row);
 
         /* advance pointer */
         prevBdPtr = currBdPtr;
         currBdPtr = (XAxiDma_Bd *) XAxiDma_BdRingNext(txRingPtr, currBdPtr);
-
-        /* advance memory (with loop around protection) */
-        if (blockCount > 1) {
-            memIdx = (memIdx + 1) % blockCount;
-        }
-
     }
 
     // set up cyclic mode, i.e. wrap around pointer to first (CurrBdPtr = last BD ptr)
@@ -193,8 +182,8 @@ XAxiDma_Bd *SimulatorHandler::startDmaTransfer(XAxiDma *dmaPtr,
         RAISE(DmaInitFailedException, "Unable for HW to process BDs");
     }
 
-    return firstBdPtr;
-
+    // from now on refills update the BDs in place
+    ring.attach(txRingPtr, firstBdPtr, firstRow);
 }
 
 void SimulatorHandler::initDmaEngine(int devId,
@@ -277,46 +266,88 @@ void SimulatorHandler::initScatterGatherBufferDescriptors(XAxiDma *dma,
 
 }
 
+void SimulatorHandler::initRowPool() {
+
+    ringProfile.clutterDepth = MIN(MAX(ringProfile.clutterDepth, 1u), (u32) CL_MAX_DEPTH);
+    clutterRing.resize(ringProfile.clutterDepth * calAcpCnt, calAcpCnt);
+
+    cout << "CL_ROTATIONS="
+         << ringProfile.clutterDepth << "/"
+         << ringProfile.clutterLoop
+         << endl;
+
+    // a sector can neither exceed a rotation nor lead by a whole rotation, it would overwrite the beam
+    ringProfile.sectorAcpCnt = MIN(MAX(ringProfile.sectorAcpCnt, 1u), calAcpCnt);
+    targetRing.resize(calAcpCnt, ringProfile.sectorAcpCnt);
+    ringProfile.sectorLead = MIN(ringProfile.sectorLead, targetRing.slotCount() - 1);
+
+    cout << "MT_SECTORS="
+         << ringProfile.sectorAcpCnt << "/"
+         << targetRing.slotCount() << "/"
+         << ringProfile.sectorLead << "/"
+         << refillPeriodNs() / 1000
+         << endl;
+
+    clutterBdSpace = MEM_BASE_ADDR;
+    clutterBdSpaceSize = ROUND_UP(clutterRing.bdCount() * XAXIDMA_BD_MINIMUM_ALIGNMENT, BD_SPACE_ALIGNMENT);
+
+    targetBdSpace = clutterBdSpace + clutterBdSpaceSize;
+    targetBdSpaceSize = ROUND_UP(targetRing.bdCount() * XAXIDMA_BD_MINIMUM_ALIGNMENT, BD_SPACE_ALIGNMENT);
+
+    // every BD may end up pointing to a row of its own, plus the zero row
+    UINTPTR poolBase = targetBdSpace + targetBdSpaceSize;
+    u32 poolRowCnt = (MEM_HIGH_ADDR + 1 - poolBase) / ROW_BYTE_SIZE;
+    if (poolRowCnt < clutterRing.bdCount() + targetRing.bdCount() + 1) {
+        RAISE(ScratchTooSmallException, "Scratch memory holds " << poolRowCnt << " rows, "
+            << clutterRing.bdCount() + targetRing.bdCount() + 1 << " needed");
+    }
+    rowPool.init((u32 *) addrToVirtual(poolBase), poolBase, poolRowCnt);
+
+    cout << "ROW_POOL="
+         << PADHEX(8, poolBase) << "/"
+         << dec << poolRowCnt << "/"
+         << clutterRing.bdCount() << "/"
+         << targetRing.bdCount()
+         << endl;
+}
+
 void SimulatorHandler::initClutterDma() {
 
-    // store pointer to the beginnings of the individual memory blocks
-    u32 dataOffset = (DATA_BASE - MEM_BASE_ADDR) / WORD_SIZE;
-    clutterMemPtr = scratchMem + dataOffset;
-    cout << "CLUTTER_MEM_PTR="
-         << PADHEX(8, addrToPhysical((UINTPTR) clutterMemPtr)) << "/"
-         << dec << clutterMapWordSize
+    cout << "CLUTTER_BD_SPACE="
+         << PADHEX(8, clutterBdSpace) << "/"
+         << dec << clutterBdSpaceSize
          << endl;
 
     initDmaEngine(CL_DMA_DEV_ID, devMemHandle, &clutterDma);
     initScatterGatherBufferDescriptors(
         &clutterDma,
-        addrToVirtual(CL_BD_SPACE_BASE),
-        CL_BD_SPACE_BASE,
-        CL_BD_SPACE_HIGH - CL_BD_SPACE_BASE + 1
+        addrToVirtual(clutterBdSpace),
+        clutterBdSpace,
+        clutterBdSpaceSize
     );
 
 }
 
 void SimulatorHandler::initTargetDma() {
 
-    // store pointer to the beginnings of the individual memory blocks
-    u32 dataOffset = (DATA_BASE - MEM_BASE_ADDR) / WORD_SIZE;
-    targetMemPtr = scratchMem + dataOffset + clutterMapWordSize;
-    cout << "TARGET_MEM_PTR="
-         << PADHEX(8, addrToPhysical((UINTPTR) targetMemPtr)) << "/"
-         << dec << targetMapWordSize
+    cout << "TARGET_BD_SPACE="
+         << PADHEX(8, targetBdSpace) << "/"
+         << dec << targetBdSpaceSize
          << endl;
 
     initDmaEngine(MT_DMA_DEV_ID, devMemHandle, &targetDma);
     initScatterGatherBufferDescriptors(
         &targetDma,
-        addrToVirtual(MT_BD_SPACE_BASE),
-        MT_BD_SPACE_BASE,
-        MT_BD_SPACE_HIGH - MT_BD_SPACE_BASE + 1
+        addrToVirtual(targetBdSpace),
+        targetBdSpace,
+        targetBdSpaceSize
     );
 }
 
-SimulatorHandler::SimulatorHandler() {
+SimulatorHandler::SimulatorHandler(const RtProfile &rtProfile, const RingProfile &ringProfile)
+    : rtProfile(rtProfile), ringProfile(ringProfile) {
+
+    auto coldStartTime = chrono::steady_clock::now();
 
     devMemHandle = open("/dev/mem", O_RDWR | O_SYNC);
     if (devMemHandle < 0) {
@@ -341,9 +372,21 @@ SimulatorHandler::SimulatorHandler() {
         MEM_BASE_ADDR
     );
 
-    clearAll();
+    // avoid page faults on the ring mappings once the refresh thread runs
+    if (rtProfile.enabled) {
+        prefaultMemory(scratchMem, MEM_SCRATCH_SIZE);
+    }
 
+    auto calibrationTime = chrono::steady_clock::now();
     calibrate();
+    auto calibrationDuration = chrono::steady_clock::now() - calibrationTime;
+
+    stagingMem = allocStaging(blockByteSize);
+    if (stagingMem == NULL) {
+        RAISE(StagingAllocFailedException, "Unable to allocate " << blockByteSize << " bytes of staging memory");
+    }
+
+    initRowPool();
 
     /* Initialize CLUTTER DMA engine */
     initClutterDma();
@@ -351,10 +394,35 @@ SimulatorHandler::SimulatorHandler() {
     /* Initialize TARGET DMA engine */
     initTargetDma();
 
+    benchmarkCommit();
+
+    chunkIngest.start(INGEST_PORT);
+
+    commandScheduler.start(rtProfile, [this] {
+        return sweepClock();
+    }, [this](const ScheduledCommand &command) {
+        runScheduledCommand(command);
+    });
+
+    dmaMonitor.start(rtProfile, [this](SubSystem::type subSystem) {
+        return probeDma(subSystem);
+    }, [this](SubSystem::type subSystem) {
+        return recoverDma(subSystem);
+    });
+
+    // waiting for the radar signal is not the server's startup cost
+    auto coldStartDuration = chrono::steady_clock::now() - coldStartTime - calibrationDuration;
+    cout << "COLD_START_MS="
+         << chrono::duration_cast<chrono::milliseconds>(coldStartDuration).count() << "/"
+         << chrono::duration_cast<chrono::milliseconds>(calibrationDuration).count()
+         << endl;
+
     cout << "STARTED_SERVER" << endl;
 }
 
 SimulatorHandler::~SimulatorHandler() {
+    dmaMonitor.stop();
+    commandScheduler.stop();
     reset();
 
     cout << "STOPING_REFRESH_THREAD" << endl;
@@ -363,6 +431,8 @@ SimulatorHandler::~SimulatorHandler() {
         cout << "STOP_REFRESH_THREAD" << endl;
     }
 
+    freeStaging(stagingMem);
+
     close(devMemHandle);
 }
 
@@ -384,6 +454,7 @@ void SimulatorHandler::enableNorm() {
 }
 
 void SimulatorHandler::enable() {
+    lock_guard<recursive_mutex> lock(controlMutex);
 
     if (!ctrl->calibrated) {
         throw RadarSignalNotCalibratedException();
@@ -403,8 +474,12 @@ void SimulatorHandler::enable() {
         throw ex;
     }
 
-    firstClutterBdPtr = startDmaTransfer(&clutterDma, addrToPhysical((UINTPTR) clutterMemPtr), blockByteSize, CL_BLK_CNT, firstClutterBdPtr);
-    firstTargetBdPtr = startDmaTransfer(&targetDma, addrToPhysical((UINTPTR) targetMemPtr), blockByteSize, MT_BLK_CNT, firstTargetBdPtr);
+    {
+        lock_guard<mutex> lock(ringMutex);
+        armDma(SubSystem::CLUTTER, 0);
+        armDma(SubSystem::MOVING_TARGET, 0);
+    }
+    dmaArmed = true;
 
 #ifdef FDEBUG
     dumpMem((char *) scratchMem, MEM_SCRATCH_SIZE);
@@ -424,13 +499,19 @@ void SimulatorHandler::enable() {
 }
 
 void SimulatorHandler::disable() {
+    lock_guard<recursive_mutex> lock(controlMutex);
 
+    dmaArmed = false;
     if (clutterDma.Initialized) {
-        stopDmaTransfer(&clutterDma);
+        if (!stopDmaTransfer(&clutterDma)) {
+            cerr << "ERR=CL DMA reset timed out" << endl;
+        }
         cout << "STOP_CL_DMA" << endl;
     }
     if (targetDma.Initialized) {
-        stopDmaTransfer(&targetDma);
+        if (!stopDmaTransfer(&targetDma)) {
+            cerr << "ERR=MT DMA reset timed out" << endl;
+        }
         cout << "STOP_MT_DMA" << endl;
     }
 
@@ -456,40 +537,319 @@ void SimulatorHandler::disableNorm() {
     cout << "NORM_STATUS=" << (ctrl->normEnabled == 1) << endl;
 }
 
-void SimulatorHandler::loadMap(const int32_t arpPosition) {
+void SimulatorHandler::loadMap(const int32_t arpPosition, const int32_t acpOffset) {
+    lock_guard<recursive_mutex> lock(controlMutex);
 
-    auto cf = "/var/clutter.bin";
-    ifstream clFile(cf, ios_base::in | ios_base::binary);
-    if (!clFile || !clFile.is_open()) {
+    auto cf = CLUTTER_MAP_FILE;
+    auto clFile = make_shared<FileMapSource>(cf);
+    if (!clFile->isOpen()) {
         cerr << "ERR=Unable to open file " << cf << endl;
         auto ex = IncompatibleFileException();
         ex.subSystem = SubSystem::CLUTTER;
         throw ex;
     }
 
-    auto mf = "/var/targets.bin";
-    ifstream mtFile(mf, ios_base::in | ios_base::binary);
-    if (!mtFile || !mtFile.is_open()) {
+    auto mf = TARGET_MAP_FILE;
+    auto mtFile = make_shared<FileMapSource>(mf);
+    if (!mtFile->isOpen()) {
         cerr << "ERR=Unable to open file " << mf << endl;
         auto ex = IncompatibleFileException();
         ex.subSystem = SubSystem::MOVING_TARGET;
         throw ex;
     }
 
-    // stop simulator
-    reset();
+    loadSources(clFile, mtFile, (u32) arpPosition, acpOffset);
+    activeScenario.clear();
+}
+
+void SimulatorHandler::listScenarios(std::vector<ScenarioInfo> &_return) {
+    scenarioCache.list(_return, activeScenario);
+}
+
+void SimulatorHandler::preloadScenario(const std::string &name) {
+    scenarioCache.preload(name);
+}
+
+void SimulatorHandler::activateScenario(const std::string &name, const int32_t arpPosition) {
+    lock_guard<recursive_mutex> lock(controlMutex);
+
+    shared_ptr<MapSource> clutter;
+    shared_ptr<MapSource> targets;
+    scenarioCache.get(name, clutter, targets);
+
+    cout << "ACTIVATING_SCENARIO=" << name << endl;
+
+    loadSources(clutter, targets, (u32) arpPosition, 0);
+    activeScenario = name;
+}
+
+void SimulatorHandler::evictScenario(const std::string &name) {
+    scenarioCache.evict(name);
+}
+
+void SimulatorHandler::beginUpload(std::vector<int32_t> &_return,
+                                   const std::string &name,
+                                   const SubSystem::type subSystem,
+                                   const std::string &header,
+                                   const std::vector<int64_t> &rotationHashes) {
+    scenarioIngest.begin(_return, ScenarioIngest::mapPath(name, subSystem), header, rotationHashes);
+}
+
+void SimulatorHandler::uploadRotation(const std::string &name,
+                                      const SubSystem::type subSystem,
+                                      const int32_t rotation,
+                                      const std::string &data) {
+    scenarioIngest.put(ScenarioIngest::mapPath(name, subSystem), (u32) rotation, data);
+}
+
+void SimulatorHandler::commitUpload(const std::string &name, const SubSystem::type subSystem) {
+    scenarioIngest.commit(ScenarioIngest::mapPath(name, subSystem));
+
+    // the resident copy is outdated now, the next preload picks up the new file
+    if (!name.empty()) {
+        scenarioCache.evict(name);
+    }
+}
+
+void SimulatorHandler::beginIngest(IngestState &_return,
+                                   const std::string &name,
+                                   const SubSystem::type subSystem,
+                                   const int64_t fileByteSize,
+                                   const int32_t chunkByteSize) {
+    chunkIngest.begin(_return, name, subSystem, (u64) fileByteSize, (u32) chunkByteSize);
+}
+
+void SimulatorHandler::getIngestState(IngestState &_return, const std::string &name, const SubSystem::type subSystem) {
+    chunkIngest.state(_return, name, subSystem);
+}
+
+void SimulatorHandler::addTarget(const LiveTarget &target) {
+    liveTargets.add(target);
+    patchTargetSectors(target.name);
+}
+
+void SimulatorHandler::modifyTarget(const LiveTarget &target) {
+    liveTargets.modify(target);
+    patchTargetSectors(target.name);
+}
+
+void SimulatorHandler::removeTarget(const std::string &name) {
+    liveTargets.remove(name);
+    patchTargetSectors(name);
+}
+
+void SimulatorHandler::setWeatherCells(const std::vector<WeatherCell> &cells) {
+    weatherCells.set(cells);
+}
+
+void SimulatorHandler::setNoise(const int64_t seed, const std::vector<NoiseRegion> &regions) {
+    noiseGenerator.set((u64) seed, regions);
+}
+
+void SimulatorHandler::setSeaClutter(const SeaClutter &seaClutter) {
+    seaClutterModel.set(seaClutter);
+}
+
+void SimulatorHandler::listTargetLayers(std::vector<TargetLayer> &_return) {
+    targetLayers.list(_return);
+}
+
+void SimulatorHandler::addTargetLayer(const TargetLayer &layer) {
+    // played with the ACP offset and calibration of the main maps, which loadSources changes
+    lock_guard<recursive_mutex> lock(controlMutex);
+
+    shared_ptr<MapSource> clutter;
+    shared_ptr<MapSource> targets;
+    scenarioCache.get(layer.scenario, clutter, targets);
+
+    targetLayers.add(layer, targets, [this](shared_ptr<MapSource> map) {
+        return playedSource(map);
+    });
+    patchTargetSectors(layer.scenario);
+}
+
+void SimulatorHandler::enableTargetLayer(const std::string &scenario, const bool enabled) {
+    targetLayers.enable(scenario, enabled);
+    patchTargetSectors(scenario);
+}
+
+void SimulatorHandler::removeTargetLayer(const std::string &scenario) {
+    targetLayers.remove(scenario);
+    patchTargetSectors(scenario);
+}
+
+void SimulatorHandler::setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> &sectors) {
+    if (subSystem == SubSystem::CLUTTER) {
+        clutterBlanking.set(sectors, calAcpCnt);
+        patchClutterRotations("blanking");
+    } else {
+        targetBlanking.set(sectors, calAcpCnt);
+        patchTargetSectors("blanking");
+    }
+}
+
+void SimulatorHandler::loadSources(shared_ptr<MapSource> clutter, shared_ptr<MapSource> targets, u32 arpPosition, s32 acpOffset) {
+    lock_guard<recursive_mutex> controlLock(controlMutex);
+
+    // stop simulator, the rings are rewritten below
+    disable();
+
+    lock_guard<mutex> lock(ringMutex);
+
+    loadAcpOffset = acpOffset;
+    clutterMap = clutter;
+    targetMap = targets;
+    clutterSource = playedSource(clutter);
+    targetSource = playedSource(targets);
+
+    // the layers turn along with the main maps
+    targetLayers.replay([this](shared_ptr<MapSource> map) {
+        return playedSource(map);
+    });
 
     // store current ARP
-    fromArpIdx = (u32) arpPosition;
+    fromArpIdx = arpPosition;
 
     // set initial queue pointer and force initial load
     clutterArpLoadIdx = 0;
-    targetArpLoadIdx = 0;
+    targetSectorLoadIdx = 0;
+    targetChangedRows = 0;
+    targetCopiedRows = 0;
 
     cout << "LOADING_MAPS_FROM_ARP=" << fromArpIdx << endl;
 
-    loadNextTargetMap(mtFile);
-    loadNextClutterMap(clFile);
+    loadNextTargetMap(*targetSource);
+    loadNextClutterMap(*clutterSource);
+
+    // clear whatever the initial load did not reach
+    targetRing.clear(MIN(targetSectorLoadIdx, targetRing.slotCount()));
+    clutterRing.clear(MIN(clutterArpLoadIdx, clutterRing.slotCount()));
+}
+
+void SimulatorHandler::scheduleCommands(const std::vector<ScheduledCommand> &commands) {
+    commandScheduler.add(commands);
+}
+
+void SimulatorHandler::listScheduledCommands(std::vector<ScheduledCommand> &_return) {
+    commandScheduler.list(_return);
+}
+
+void SimulatorHandler::clearSchedule() {
+    commandScheduler.clear();
+}
+
+void SimulatorHandler::startCapture(const std::string &name, const bool rowPayloads) {
+    MapHeader header {calArpUs, calAcpCnt, calTrigUs, 0, 0};
+    captureRecorder.start(name, rowPayloads, header);
+}
+
+void SimulatorHandler::stopCapture() {
+    captureRecorder.stop();
+}
+
+void SimulatorHandler::getDmaHealth(std::vector<DmaHealth> &_return) {
+    dmaMonitor.health(_return);
+}
+
+void SimulatorHandler::armDma(SubSystem::type subSystem, u32 firstRow) {
+    // the engine is reset as part of its initialization
+    if (subSystem == SubSystem::CLUTTER) {
+        initClutterDma();
+        startDmaTransfer(&clutterDma, clutterRing, firstRow);
+    } else {
+        initTargetDma();
+        startDmaTransfer(&targetDma, targetRing, firstRow);
+    }
+}
+
+DmaProbe SimulatorHandler::probeDma(SubSystem::type subSystem) {
+    lock_guard<recursive_mutex> lock(controlMutex);
+
+    auto dmaPtr = subSystem == SubSystem::CLUTTER ? &clutterDma : &targetDma;
+    auto chanBase = XAxiDma_GetTxRing(dmaPtr)->ChanBase;
+    return DmaProbe {
+        dmaArmed && ctrl->enabled == 1,
+        XAxiDma_ReadReg(chanBase, XAXIDMA_SR_OFFSET),
+        XAxiDma_ReadReg(chanBase, XAXIDMA_CDESC_OFFSET),
+        ctrl->simAcpIdx
+    };
+}
+
+bool SimulatorHandler::recoverDma(SubSystem::type subSystem) {
+    lock_guard<recursive_mutex> lock(controlMutex);
+    if (!dmaArmed) {
+        return false;
+    }
+
+    lock_guard<mutex> ringLock(ringMutex);
+    auto &ring = subSystem == SubSystem::CLUTTER ? clutterRing : targetRing;
+
+    // the simulator skips rows whose ACP the beam has passed, so starting at the row under
+    // the beam loses nothing but the ACPs the recovery takes, and the slots stay in phase
+    auto firstRow = ctrl->simAcpIdx % ring.bdCount();
+    armDma(subSystem, firstRow);
+    return true;
+}
+
+void SimulatorHandler::seek(u32 arpPosition) {
+    lock_guard<recursive_mutex> lock(controlMutex);
+    if (!clutterMap || !targetMap) {
+        cerr << "ERR=No maps loaded to seek in" << endl;
+        return;
+    }
+
+    auto wasEnabled = ctrl->enabled == 1;
+    loadSources(clutterMap, targetMap, arpPosition, loadAcpOffset);
+    if (wasEnabled) {
+        enable();
+    }
+}
+
+void SimulatorHandler::runScheduledCommand(const ScheduledCommand &command) {
+    try {
+        switch (command.action) {
+        case CommandAction::ENABLE:
+            enable();
+            break;
+        case CommandAction::DISABLE:
+            disable();
+            break;
+        case CommandAction::ENABLE_MTI:
+            enableMti();
+            break;
+        case CommandAction::DISABLE_MTI:
+            disableMti();
+            break;
+        case CommandAction::ENABLE_NORM:
+            enableNorm();
+            break;
+        case CommandAction::DISABLE_NORM:
+            disableNorm();
+            break;
+        case CommandAction::SEEK:
+            seek((u32) command.arpPosition);
+            break;
+        case CommandAction::ENABLE_TARGET_LAYER:
+            enableTargetLayer(command.scenario, true);
+            break;
+        case CommandAction::DISABLE_TARGET_LAYER:
+            enableTargetLayer(command.scenario, false);
+            break;
+        }
+    } catch (const std::exception &e) {
+        // the Thrift exceptions are logged where they are raised already
+        cerr << "ERR=Scheduled command at ACP " << command.acpIdx << " failed: " << e.what() << endl;
+    }
+}
+
+shared_ptr<MapSource> SimulatorHandler::playedSource(shared_ptr<MapSource> source) {
+
+    // resolve repeat and loop segments on the fly
+    auto played = playbackSource(source);
+
+    // a map built for another radar is resampled onto the calibrated ACPs and trigger period
+    played = azimuthResampledSource(played, calAcpCnt, loadAcpOffset);
+    return rangeResampledSource(played, calTrigUs);
 }
 
 void SimulatorHandler::getState(SimState &_return) {
@@ -512,6 +872,11 @@ void SimulatorHandler::getState(SimState &_return) {
     _return.loadedClutterAcp = ctrl->loadedClutterAcp;
     _return.loadedTargetAcp = ctrl->loadedTargetAcp;
 
+    _return.refillWakeupP99Us = wakeupStats.percentileUs(99);
+    _return.refillWakeupMaxUs = wakeupStats.maxUs();
+
+    _return.liveTargetLatencyMs = liveTargets.lastLatencyMs();
+
     auto startTime = chrono::steady_clock::now();
     chrono::milliseconds timeSinceEpoch = chrono::duration_cast<chrono::milliseconds>(startTime.time_since_epoch());
     _return.__set_time(timeSinceEpoch.count());
@@ -519,20 +884,24 @@ void SimulatorHandler::getState(SimState &_return) {
 }
 
 void SimulatorHandler::clearAll() {
-    memset(scratchMem, 0x0, MEM_SCRATCH_SIZE);
+    clearClutterMap();
+    clearTargetMap();
     cout << "CLR_ALL" << endl;
 }
 
 void SimulatorHandler::clearClutterMap() {
-    memset(clutterMemPtr, 0x0, CL_BLK_CNT * blockByteSize);
+    lock_guard<mutex> lock(ringMutex);
+    clutterRing.clear(0);
     cout << "CLR_CL" << endl;
 }
 
 void SimulatorHandler::clearTargetMap() {
-    memset(targetMemPtr, 0x0, MT_BLK_CNT * blockByteSize);
+    lock_guard<mutex> lock(ringMutex);
+    targetRing.clear(0);
     cout << "CLR_MT" << endl;
 }
 
+
 /**
  * Converts a virtual (mmap-ed) address to the physical address.
  */
@@ -549,184 +918,340 @@ UINTPTR SimulatorHandler::addrToVirtual(UINTPTR physicalAddress) {
 
 void SimulatorHandler::loadNextMaps() {
 
-    auto mtFileName = "/var/targets.bin";
-    ifstream mtFile(mtFileName, ios_base::in | ios_base::binary);
-    if (!mtFile || !mtFile.is_open()) {
-        throw IncompatibleFileException();
+    // keep the sources alive even if they get replaced meanwhile
+    auto clutter = clutterSource;
+    auto targets = targetSource;
+    if (!clutter || !targets) {
+        cerr << "ERR=No maps loaded" << endl;
+        return;
     }
 
-    auto ctFileName = "/var/clutter.bin";
-    ifstream ctFile(ctFileName, ios_base::in | ios_base::binary);
-    if (!ctFile || !ctFile.is_open()) {
-        throw IncompatibleFileException();
-    }
+    applyRefillProfile(rtProfile);
+    wakeupStats.reset();
 
-    std::chrono::seconds sleepDuration(1);
+    auto periodNs = refillPeriodNs();
+
+    struct timespec deadline, wakeup;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
 
     while (ctrl->enabled) {
-        loadNextClutterMap(ctFile);
-        loadNextTargetMap(mtFile);
-        // sleep
-        this_thread::sleep_for(sleepDuration);
+        {
+            lock_guard<mutex> lock(ringMutex);
+            loadNextClutterMap(*clutter);
+            loadNextTargetMap(*targets);
+            liveTargets.reportEmitted(sweepClock());
+        }
+
+        // sleep until the next period, skipping the periods an overlong refill missed
+        clock_gettime(CLOCK_MONOTONIC, &wakeup);
+        deadline.tv_nsec += periodNs;
+        deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+        deadline.tv_nsec %= 1000000000L;
+        if (wakeup.tv_sec > deadline.tv_sec || (wakeup.tv_sec == deadline.tv_sec && wakeup.tv_nsec > deadline.tv_nsec)) {
+            deadline = wakeup;
+        }
+
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+        clock_gettime(CLOCK_MONOTONIC, &wakeup);
+        wakeupStats.record(deadline, wakeup);
+
+        if (wakeupStats.count() % REFILL_STATS_INTERVAL == 0) {
+            cout << "REFILL_WAKEUP_US="
+                 << wakeupStats.percentileUs(50) << "/"
+                 << wakeupStats.percentileUs(99) << "/"
+                 << wakeupStats.maxUs() << "/"
+                 << wakeupStats.count()
+                 << endl;
+        }
     }
 }
 
-void SimulatorHandler::loadNextTargetMap(istream &input) {
+void SimulatorHandler::loadNextTargetMap(MapSource &source) {
+
+    auto blockCount = source.header().blockCount;
+    auto sectorCnt = targetRing.slotCount();
+
+    // a zero based, non modulo, sector index like the load index
+    auto currSector = beamSector();
+
+    // the beam overtook the refill, the sectors it passed went out stale
+    if (targetSectorLoadIdx < currSector) {
+        cerr << "ERR=MT sectors missed " << currSector - targetSectorLoadIdx << endl;
+        targetSectorLoadIdx = currSector;
+    }
+
+    // early exit for full lead
+    if (targetSectorLoadIdx > currSector + ringProfile.sectorLead) {
+        return;
+    }
+
+    while (targetSectorLoadIdx <= currSector + ringProfile.sectorLead) {
+
+        // ensure we don't go over the EOF
+        auto arpIdx = targetSectorLoadIdx / sectorCnt;
+        auto blockFilePos = MIN(fromArpIdx + arpIdx, blockCount - 1);
+
+        // the ring holds exactly one rotation
+        auto writeSectorIdx = targetSectorLoadIdx % sectorCnt;
+
+        // read from the source or clear past its end
+        targetChangedRows += commitTargetSector(source, targetSectorLoadIdx);
+        targetCopiedRows += rowPool.takeCopiedRows();
+
+        // a line per rotation, not per sector, console writes block the refill thread
+        if (writeSectorIdx == sectorCnt - 1) {
+            cout << "LOAD_MT_ARP_MAP="
+                 << fromArpIdx + arpIdx << "/"
+                 << blockFilePos << "/"
+                 << blockCount << "/"
+                 << targetChangedRows << "/"
+                 << targetCopiedRows << "/"
+                 << rowPool.usedRows() << "/"
+                 << targetSectorLoadIdx - currSector
+                 << endl;
+
+            targetChangedRows = 0;
+            targetCopiedRows = 0;
+        }
 
-    u32 arpUs = 0;
-    u32 acpCnt = 0;
-    u32 trigUs = 0;
-    u32 trigSize = 0;
-    u32 blockCount = 0;
+        targetSectorLoadIdx++;
+    }
+}
 
-    input.seekg(0, ios_base::beg);
-    input.read((char *) &arpUs, sizeof(u32));
-    input.read((char *) &acpCnt, sizeof(u32));
-    input.read((char *) &trigUs, sizeof(u32));
-    input.read((char *) &trigSize, sizeof(u32));
-    input.read((char *) &blockCount, sizeof(u32));
+void SimulatorHandler::loadNextClutterMap(MapSource &source) {
 
-    auto headerOffset = (u32) input.tellg();
-    auto fileBlockByteSize = acpCnt * TRIG_WORD_CNT * WORD_SIZE;
+    auto blockCount = source.header().blockCount;
+    auto depth = clutterRing.slotCount();
 
     // a zero based, non modulo, set of indexes for the circular queue of a fixed size
-    auto currArp = MAX(ctrl->simAcpIdx / calAcpCnt, 0);
-    targetArpLoadIdx = MAX(targetArpLoadIdx, 0);
+    auto currArp = ctrl->simAcpIdx / calAcpCnt;
+
+    // the beam overtook the refill, the rotations it passed went out stale
+    if (clutterArpLoadIdx < currArp) {
+        cerr << "ERR=CL rotations missed " << currArp - clutterArpLoadIdx << endl;
+        clutterArpLoadIdx = currArp;
+    }
 
     // early exit for full queue
-    auto queueSize = targetArpLoadIdx - currArp;
-    if (queueSize >= MT_BLK_CNT) {
-//        cout << "DBG_STOP_MT_QUEUE_FULL="
-//             << targetArpLoadIdx << "/"
-//             << currArp << "/"
-//             << queueSize
-//             << endl;
+    auto queueSize = clutterArpLoadIdx - currArp;
+    if (queueSize >= depth) {
         return;
     }
 
-//    cout << "DBG_LOAD_NEXT_TARGET_MAP_FILE_BYTE_BLOCK_SIZE=" << fileBlockByteSize << "/" << blockByteSize << endl;
-//    cout << "DBG_LOAD_NEXT_TARGET_MAP_IDX=" << targetArpLoadIdx << "/" << currArp << "/" << MT_BLK_CNT - 1 << endl;
-//    cout << "CURR_ARP_IDX=" << currArp << "/" << currArp % MT_BLK_CNT << endl;
-
-
-    auto runCount = 0;
-    while (queueSize < MT_BLK_CNT && runCount < MT_BLK_CNT) {
-        // prevent endless loop
-        runCount++;
+    while (queueSize < depth) {
 
-        // ensure we don't go over the EOF
-        auto blockFilePos = MIN(fromArpIdx + targetArpLoadIdx, blockCount - 1);
+        auto blockFilePos = clutterRotation(source, clutterArpLoadIdx);
 
         // block index to write (circular buffer) with 0 being the starting ARP (fromArpIdx)
-        auto writeBlockIdx = targetArpLoadIdx % MT_BLK_CNT;
-        char *memPtr = ((char *) targetMemPtr) + writeBlockIdx * blockByteSize;
-
-        // rewind the file past the headers to correct position of next block to load
-        size_t offset = headerOffset + blockFilePos * fileBlockByteSize;
-        input.seekg(offset);
-        if (input.eof()) {
-            cout << "STOP_MT_EOF" << endl;
-            break;
-        }
+        auto writeBlockIdx = clutterArpLoadIdx % depth;
 
-        // read from file or clear
-        input.read(memPtr, blockByteSize);
+        // read from the source or clear past its end
+        auto changedRows = commitClutterRotation(source, clutterArpLoadIdx);
 
-        cout << "LOAD_MT_ARP_MAP="
-             << fromArpIdx + targetArpLoadIdx << "/"
+        cout << "LOAD_CL_ARP_MAP="
+             << clutterArpLoadIdx << "/"
              << writeBlockIdx << "/"
-             << offset << "/"
-             << PADHEX(8, addrToPhysical((UINTPTR) memPtr)) << "/"
-             << dec << blockCount
+             << blockFilePos << "/"
+             << blockCount << "/"
+             << changedRows << "/"
+             << rowPool.takeCopiedRows() << "/"
+             << rowPool.usedRows()
              << endl;
 
-        targetArpLoadIdx = targetArpLoadIdx + 1;
-        queueSize = targetArpLoadIdx - currArp;
+        clutterArpLoadIdx = clutterArpLoadIdx + 1;
+        queueSize = clutterArpLoadIdx - currArp;
     }
 
-    cout << "LOAD_MT_COMPLETE="
-         << targetArpLoadIdx << "/"
+    cout << "LOAD_CL_COMPLETE="
+         << clutterArpLoadIdx << "/"
          << currArp << "/"
          << queueSize
          << endl;
 }
 
-void SimulatorHandler::loadNextClutterMap(istream &input) {
+u32 SimulatorHandler::clutterRotation(MapSource &source, u32 arpIdx) {
+    auto blockCount = source.header().blockCount;
 
-    u32 arpUs = 0;
-    u32 acpCnt = 0;
-    u32 trigUs = 0;
-    u32 trigSize = 0;
-    u32 blockCount = 0;
+    // unlike the targets the clutter loops, a single rotation map is static clutter
+    auto loop = ringProfile.clutterLoop > 0 ? MIN(ringProfile.clutterLoop, blockCount) : blockCount;
+    return loop > 0 ? (fromArpIdx + arpIdx) % loop : 0;
+}
 
-    input.seekg(0, ios_base::beg);
-    input.read((char *) &arpUs, sizeof(u32));
-    input.read((char *) &acpCnt, sizeof(u32));
-    input.read((char *) &trigUs, sizeof(u32));
-    input.read((char *) &trigSize, sizeof(u32));
-    input.read((char *) &blockCount, sizeof(u32));
+u32 SimulatorHandler::commitClutterRotation(MapSource &source, u32 arpIdx) {
+    // the slots are whole rotations, the first one holding the starting ARP
+    auto slot = arpIdx % clutterRing.slotCount();
 
-    auto headerOffset = (u32) input.tellg();
-    auto fileBlockByteSize = acpCnt * TRIG_WORD_CNT * WORD_SIZE;
+    // the sources copy word by word, keep that in cached memory and only burst new rows out
+    auto rotation = clutterRotation(source, arpIdx);
+    source.readRows(rotation, 0, calAcpCnt, stagingMem);
+    auto mapHash = captureRecorder.isRecording() ? rowsHash(stagingMem, calAcpCnt, captureKeys) : 0;
 
-    // a zero based, non modulo, set of indexes for the circular queue of a fixed size
-    auto currArp = MAX(ctrl->simAcpIdx / calAcpCnt, 0);
-    clutterArpLoadIdx = MAX(clutterArpLoadIdx, 0);
+    // the clouds drift in scenario time while the clutter map loops
+    weatherCells.render(fromArpIdx + arpIdx, calArpUs, calAcpCnt, stagingMem);
+    seaClutterModel.render(fromArpIdx + arpIdx, calArpUs, calAcpCnt, stagingMem);
+    noiseGenerator.render(fromArpIdx + arpIdx, calAcpCnt, stagingMem);
 
-    // early exit for full queue
-    auto queueSize = MAX(clutterArpLoadIdx - currArp, 0);
-    if (queueSize >= CL_BLK_CNT) {
-//        cout << "DBG_STOP_CL_QUEUE_FULL="
-//             << clutterArpLoadIdx << "/"
-//             << currArp << "/"
-//             << queueSize
-//             << endl;
+    clutterBlanking.apply(0, calAcpCnt, stagingMem);
+
+    auto changedRows = clutterRing.commit(slot, stagingMem);
+    captureCommit(clutterRing, SubSystem::CLUTTER, slot, arpIdx, rotation, mapHash);
+    return changedRows;
+}
+
+u32 SimulatorHandler::commitTargetSector(MapSource &source, u32 sectorIdx) {
+    auto sectorCnt = targetRing.slotCount();
+    auto slot = sectorIdx % sectorCnt;
+    auto firstRow = targetRing.slotFirstRow(slot);
+    auto rowCount = targetRing.slotRowCount(slot);
+
+    // ensure we don't go over the EOF
+    auto blockFilePos = MIN(fromArpIdx + sectorIdx / sectorCnt, source.header().blockCount - 1);
+    source.readRows(blockFilePos, firstRow, rowCount, stagingMem);
+    auto mapHash = captureRecorder.isRecording() ? rowsHash(stagingMem, rowCount, captureKeys) : 0;
+
+    // the layers play in scenario time from their own start ARP
+    targetLayers.composite(fromArpIdx + sectorIdx / sectorCnt, firstRow, rowCount, stagingMem);
+
+    // live targets go on top of the map in every refill until they are removed
+    liveTargets.render(sweepClock(), sectorIdx / sectorCnt * calAcpCnt + firstRow, rowCount, stagingMem);
+
+    targetBlanking.apply(firstRow, rowCount, stagingMem);
+
+    auto changedRows = targetRing.commit(slot, stagingMem);
+    captureCommit(targetRing, SubSystem::MOVING_TARGET, slot, sectorIdx, blockFilePos, mapHash);
+    return changedRows;
+}
+
+void SimulatorHandler::captureCommit(PooledRing &ring, SubSystem::type subSystem, u32 slot, u32 loadIdx, u32 mapRotation,
+                                     u64 mapHash) {
+    if (!captureRecorder.isRecording()) {
         return;
     }
 
-//    cout << "DBG_LOAD_NEXT_CLUTTER_MAP_FILE_BYTE_BLOCK_SIZE=" << fileBlockByteSize << "/" << blockByteSize << endl;
-//    cout << "DBG_LOAD_NEXT_CLUTTER_MAP_IDX=" << targetArpLoadIdx << "/" << currArp << "/" << CL_BLK_CNT - 1 << endl;
-//    cout << "CURR_ARP_IDX=" << currArp << "/" << currArp % CL_BLK_CNT << endl;
+    CaptureRecord record;
+    record.subSystem = subSystem;
+    record.slot = slot;
+    record.loadIdx = loadIdx;
+    record.fromArpIdx = fromArpIdx;
+    record.mapRotation = mapRotation;
+    record.firstAcp = ring.slotFirstRow(slot);
+    record.rowCount = ring.slotRowCount(slot);
+    record.beamAcp = ctrl->simAcpIdx;
 
-    auto runCount = 0;
-    while (queueSize < CL_BLK_CNT && runCount < CL_BLK_CNT) {
-        // prevent endless loop
-        runCount++;
+    // hashed from the pool row keys, i.e. what the BDs point to and not what was staged
+    record.hash = ring.slotHash(slot);
 
-        // ensure we don't go over the EOF
-        auto blockFilePos = MIN(fromArpIdx + clutterArpLoadIdx, blockCount - 1);
+    // the pool row keys are those of the staged rows, no need to hash them again
+    record.mapHash = mapHash;
+    record.flags = record.hash != mapHash ? CAPTURE_OVERLAID : 0;
 
-        // block index to write (circular buffer) with 0 being the starting ARP (fromArpIdx)
-        auto writeBlockIdx = clutterArpLoadIdx % CL_BLK_CNT;
-        char *memPtr = ((char *) clutterMemPtr) + writeBlockIdx * blockByteSize;
-
-        // rewind the file past the headers to correct position of next block to load
-        size_t offset = headerOffset + blockFilePos * fileBlockByteSize;
-        input.seekg(offset);
-        if (input.eof()) {
-            cout << "STOP_CL_EOF" << endl;
-            break;
-        }
+    captureRecorder.record(record, stagingMem);
+}
 
-        // read from file or clear
-        input.read(memPtr, blockByteSize);
+void SimulatorHandler::patchTargetSectors(const std::string &name) {
 
-        cout << "LOAD_CL_ARP_MAP="
-             << clutterArpLoadIdx << "/"
-             << writeBlockIdx << "/"
-             << offset << "/"
-             << PADHEX(8, addrToPhysical((UINTPTR) memPtr)) << "/"
-             << dec << blockCount
-             << endl;
+    auto startTime = chrono::steady_clock::now();
 
-        clutterArpLoadIdx = clutterArpLoadIdx + 1;
-        queueSize = MAX(clutterArpLoadIdx - currArp, 0);
+    lock_guard<mutex> lock(ringMutex);
+    if (!targetSource) {
+        return;
     }
 
-    cout << "LOAD_CL_COMPLETE="
-         << clutterArpLoadIdx << "/"
-         << currArp << "/"
-         << queueSize
+    // the DMA may already have fetched the BDs of the sector under the beam
+    auto firstSector = beamSector() + (ctrl->enabled ? 1 : 0);
+
+    u32 sectors = 0;
+    u32 changedRows = 0;
+    for (auto sectorIdx = firstSector; sectorIdx < targetSectorLoadIdx; sectorIdx++) {
+        changedRows += commitTargetSector(*targetSource, sectorIdx);
+        sectors++;
+    }
+
+    cout << "TARGET_PATCH="
+         << name << "/"
+         << sectors << "/"
+         << changedRows << "/"
+         << rowPool.takeCopiedRows() << "/"
+         << chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - startTime).count()
+         << endl;
+}
+
+void SimulatorHandler::patchClutterRotations(const std::string &name) {
+
+    auto startTime = chrono::steady_clock::now();
+
+    lock_guard<mutex> lock(ringMutex);
+    if (!clutterSource) {
+        return;
+    }
+
+    // the rotation under the beam keeps its rows, the DMA may be fetching them
+    auto firstArp = ctrl->simAcpIdx / calAcpCnt + (ctrl->enabled ? 1 : 0);
+
+    u32 rotations = 0;
+    u32 changedRows = 0;
+    for (auto arpIdx = firstArp; arpIdx < clutterArpLoadIdx; arpIdx++) {
+        changedRows += commitClutterRotation(*clutterSource, arpIdx);
+        rotations++;
+    }
+
+    cout << "CLUTTER_PATCH="
+         << name << "/"
+         << rotations << "/"
+         << changedRows << "/"
+         << rowPool.takeCopiedRows() << "/"
+         << chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - startTime).count()
+         << endl;
+}
+
+u32 SimulatorHandler::beamSector() {
+    auto currAcp = ctrl->simAcpIdx;
+    return currAcp / calAcpCnt * targetRing.slotCount() + currAcp % calAcpCnt / ringProfile.sectorAcpCnt;
+}
+
+SweepClock SimulatorHandler::sweepClock() {
+    return SweepClock {chrono::steady_clock::now(), ctrl->simAcpIdx, (double) calArpUs / calAcpCnt, calAcpCnt};
+}
+
+long SimulatorHandler::refillPeriodNs() {
+    auto sectorNs = (u64) calArpUs * 1000 * ringProfile.sectorAcpCnt / MAX(calAcpCnt, 1u);
+    return (long) MIN(sectorNs, (u64) REFILL_PERIOD_NS);
+}
+
+void SimulatorHandler::benchmarkCommit() {
+
+    // right after the zero row, none of the pool rows is handed out yet
+    auto poolPtr = (u32 *) addrToVirtual(rowPool.rowAddress(POOL_ZERO_ROW + 1));
+
+    // a rotation with every word set, so nothing can shortcut the copy
+    memset(stagingMem, 0xFF, blockByteSize);
+
+    auto startTime = chrono::steady_clock::now();
+    for (u32 i = 0; i < COMMIT_BENCH_ROUNDS; i++) {
+        memcpy(poolPtr, stagingMem, blockByteSize);
+    }
+    auto directTime = chrono::steady_clock::now();
+    for (u32 i = 0; i < COMMIT_BENCH_ROUNDS; i++) {
+        commitRows(poolPtr, stagingMem, blockByteSize);
+    }
+    auto commitTime = chrono::steady_clock::now();
+    for (u32 i = 0; i < COMMIT_BENCH_ROUNDS; i++) {
+        memset(poolPtr, 0x0, blockByteSize);
+    }
+    auto directClearTime = chrono::steady_clock::now();
+    for (u32 i = 0; i < COMMIT_BENCH_ROUNDS; i++) {
+        clearRows(poolPtr, blockByteSize);
+    }
+    auto clearTime = chrono::steady_clock::now();
+
+    memset(stagingMem, 0x0, blockByteSize);
+
+    cout << "COMMIT_BENCH_US="
+         << chrono::duration_cast<chrono::microseconds>(directTime - startTime).count() / COMMIT_BENCH_ROUNDS << "/"
+         << chrono::duration_cast<chrono::microseconds>(commitTime - directTime).count() / COMMIT_BENCH_ROUNDS << "/"
+         << chrono::duration_cast<chrono::microseconds>(directClearTime - commitTime).count() / COMMIT_BENCH_ROUNDS << "/"
+         << chrono::duration_cast<chrono::microseconds>(clearTime - directClearTime).count() / COMMIT_BENCH_ROUNDS << "/"
+         << blockByteSize
          << endl;
 }
 
@@ -751,12 +1276,8 @@ void SimulatorHandler::calibrate() {
     u32 mem_blk_word_cnt = calAcpCnt * TRIG_WORD_CNT;
 
     // store the block size in
-//    blockByteSize = roundUp(mem_blk_word_cnt * WORD_SIZE, DMA_DATA_WIDTH);
+//    blockByteSize = ROUND_UP(mem_blk_word_cnt * WORD_SIZE, DMA_DATA_WIDTH);
     blockByteSize = mem_blk_word_cnt * WORD_SIZE;
     cout << "CAL_BLOCK_BYTE_SIZE=" << dec << blockByteSize << endl;
 
-    // calculate the needed sizes for the individual block sizes
-    targetMapWordSize = MT_BLK_CNT * mem_blk_word_cnt;
-    clutterMapWordSize = CL_BLK_CNT * mem_blk_word_cnt;
-
 }
\ No newline at end of file
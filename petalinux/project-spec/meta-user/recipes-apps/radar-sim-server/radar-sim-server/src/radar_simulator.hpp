@@ -10,12 +10,33 @@
 
 #include "thrift/Simulator.h"
 
+#include "radar_map.hpp"
+#include "scenario_cache.hpp"
+#include "scenario_ingest.hpp"
+#include "chunk_ingest.hpp"
+#include "rt_profile.hpp"
+#include "commit_kernels.hpp"
+#include "row_pool.hpp"
+#include "live_targets.hpp"
+#include "weather_cells.hpp"
+#include "noise_generator.hpp"
+#include "sea_clutter.hpp"
+#include "target_layers.hpp"
+#include "blanking_mask.hpp"
+#include "map_resampling.hpp"
+#include "command_scheduler.hpp"
+#include "capture_recorder.hpp"
+#include "dma_monitor.hpp"
+
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
 #include <chrono>
 #include <ctime>
 #include <thread>         // std::thread
+#include <memory>
+#include <mutex>
+#include <atomic>
 
 using namespace std;
 using namespace ::hr::franp::rsim;
@@ -28,35 +49,54 @@ using namespace ::hr::franp::rsim;
 //#define FDEBUG
 
 /**  CONSTANTS **/
-#define WORD_SIZE               (sizeof(u32))
-#define WORD_BITS               (8 * WORD_SIZE)
-#define MAX_TRIG_BITS           (3072)
-#define TRIG_WORD_CNT           (MAX_TRIG_BITS / WORD_BITS)
-
 #define CL_DMA_DEV_ID           XPAR_AXIDMA_0_DEVICE_ID
 #define MT_DMA_DEV_ID           XPAR_AXIDMA_1_DEVICE_ID
 #define DMA_DATA_WIDTH          XPAR_AXI_DMA_MT_M_AXI_MM2S_DATA_WIDTH
 
+/** Polls of the reset bit before a DMA reset is given up on, as the Xilinx driver does **/
+#define DMA_RESET_TIMEOUT       500
+
 #define MEM_BASE_ADDR           0x19000000
 #define MEM_HIGH_ADDR           (MEM_BASE_ADDR + 0x05848000)
 #define MEM_SCRATCH_SIZE        (MEM_HIGH_ADDR - MEM_BASE_ADDR + 1)
 
-#define CL_BD_SPACE_BASE        (MEM_BASE_ADDR)
-#define CL_BD_SPACE_HIGH        (MEM_BASE_ADDR + 0x00000FFF)
+/** The BD spaces (one BD per row) and the row pool are laid out from MEM_BASE_ADDR once calibrated **/
+#define BD_SPACE_ALIGNMENT      0x1000
+
+/** The clutter ring queues whole rotations ahead of the beam, looping over the clutter map **/
+#define CL_DEFAULT_DEPTH            2
+#define CL_MAX_DEPTH                16
 
-#define MT_BD_SPACE_BASE        (MEM_BASE_ADDR + 0x00001000)
-#define MT_BD_SPACE_HIGH        (MEM_BASE_ADDR + 0x00001FFF)
+/** The target ring holds one rotation, refilled sector by sector a fixed number of sectors ahead of the beam **/
+#define MT_SECTOR_DEFAULT_ACP_CNT   64
+#define MT_SECTOR_DEFAULT_LEAD      8
 
-#define DATA_BASE               (MEM_BASE_ADDR + 0x00100000)
+#define REFILL_PERIOD_NS        1000000000L
+#define REFILL_STATS_INTERVAL   60
 
-#define CL_BLK_CNT              1
-#define MT_BLK_CNT              4
+/** Rotations written per path when benchmarking the ring commit at startup **/
+#define COMMIT_BENCH_ROUNDS     4
 
 // AXI LITE Register Address Map for the control/statistics IP
 #define    RSIM_CTRL_REGISTER_LOCATION           (XPAR_RADAR_SIM_SUBSYTEM_RADAR_SIMULATOR_RADAR_SIM_CTRL_AXI_BASEADDR)
 
 /** STRUCTS **/
 
+/**
+ * Layout of the clutter and target rings, set from the command line.
+ *
+ * The target ring is split into azimuth sectors, the sector lead being the number of sectors
+ * beyond the one under the beam the refill keeps committed, i.e. how long new target data
+ * takes to reach the output. The clutter ring holds clutterDepth rotations and plays the first
+ * clutterLoop rotations of the clutter map over and over, all of them if zero.
+ */
+struct RingProfile {
+    u32 sectorAcpCnt = MT_SECTOR_DEFAULT_ACP_CNT;
+    u32 sectorLead = MT_SECTOR_DEFAULT_LEAD;
+    u32 clutterDepth = CL_DEFAULT_DEPTH;
+    u32 clutterLoop = 0;
+};
+
 struct Simulator {
     u32 enabled;
     u32 mtiEnabled;
@@ -80,6 +120,10 @@ struct Simulator {
 
 EXCEPTION(Exception, NoAccessToDevMemException);
 
+EXCEPTION(Exception, StagingAllocFailedException);
+
+EXCEPTION(Exception, ScratchTooSmallException);
+
 EXCEPTION(Exception, DmaConfigNotFoundException);
 
 EXCEPTION(Exception, DmaInitFailedException);
@@ -90,7 +134,8 @@ EXCEPTION(Exception, ScatterGatherInitException);
 
 class SimulatorHandler : virtual public SimulatorIf {
 public:
-    SimulatorHandler();
+    explicit SimulatorHandler(const RtProfile &rtProfile = RtProfile(),
+                              const RingProfile &ringProfile = RingProfile());
 
     /**
      * Frees the reserved memory.
@@ -146,12 +191,14 @@ public:
     void disableNorm();
 
     /**
-     * Loads the clutter and target map data from the common location.
+     * Loads the clutter and target map data from the common location, turned clockwise by the given number
+     * of ACPs to align the scenario north with the radar.
      *
      *
      * @param arpPosition
+     * @param acpOffset
      */
-    void loadMap(const int32_t arpPosition);
+    void loadMap(const int32_t arpPosition, const int32_t acpOffset);
 
     /**
      * Returns the state of the simulator.
@@ -159,6 +206,239 @@ public:
      */
     void getState(SimState &_return);
 
+    /**
+     * Lists the scenarios stored on the board and the ones resident in the scenario cache.
+     *
+     */
+    void listScenarios(std::vector<ScenarioInfo> &_return);
+
+    /**
+     * Loads the named scenario into the scenario cache, evicting the least recently used ones if needed.
+     *
+     *
+     * @param name
+     */
+    void preloadScenario(const std::string &name);
+
+    /**
+     * Fills the ring from the resident named scenario, starting at the given ARP position.
+     *
+     *
+     * @param name
+     * @param arpPosition
+     */
+    void activateScenario(const std::string &name, const int32_t arpPosition);
+
+    /**
+     * Drops the named scenario from the scenario cache.
+     *
+     *
+     * @param name
+     */
+    void evictScenario(const std::string &name);
+
+    /**
+     * Starts a deduplicated upload of a map file and returns the rotations the server does not have yet.
+     * An empty name stands for the common location loaded by loadMap.
+     * The header is followed by the segment table of the file, if it has one.
+     *
+     *
+     * @param name
+     * @param subSystem
+     * @param header
+     * @param rotationHashes
+     */
+    void beginUpload(std::vector<int32_t> &_return,
+                     const std::string &name,
+                     const SubSystem::type subSystem,
+                     const std::string &header,
+                     const std::vector<int64_t> &rotationHashes);
+
+    /**
+     * Uploads one of the rotations requested by beginUpload.
+     *
+     *
+     * @param name
+     * @param subSystem
+     * @param rotation
+     * @param data
+     */
+    void uploadRotation(const std::string &name, const SubSystem::type subSystem, const int32_t rotation, const std::string &data);
+
+    /**
+     * Assembles the uploaded map file from the uploaded rotations and the ones already on the board.
+     *
+     *
+     * @param name
+     * @param subSystem
+     */
+    void commitUpload(const std::string &name, const SubSystem::type subSystem);
+
+    /**
+     * Starts a chunked map file ingest, or resumes the unfinished one of the same size, and returns the chunks
+     * still to be streamed to the ingest port. An empty name stands for the common location loaded by loadMap.
+     *
+     *
+     * @param name
+     * @param subSystem
+     * @param fileByteSize
+     * @param chunkByteSize
+     */
+    void beginIngest(IngestState &_return,
+                     const std::string &name,
+                     const SubSystem::type subSystem,
+                     const int64_t fileByteSize,
+                     const int32_t chunkByteSize);
+
+    /**
+     * Returns the progress of a chunked map file ingest.
+     *
+     *
+     * @param name
+     * @param subSystem
+     */
+    void getIngestState(IngestState &_return, const std::string &name, const SubSystem::type subSystem);
+
+    /**
+     * Adds a target to the running simulation, its path starts at the time of the call.
+     * The target rows the beam has not reached yet are patched right away.
+     *
+     *
+     * @param target
+     */
+    void addTarget(const LiveTarget &target);
+
+    /**
+     * Replaces the live target of the same name, its path restarts at the time of the call.
+     *
+     *
+     * @param target
+     */
+    void modifyTarget(const LiveTarget &target);
+
+    /**
+     * Removes the live target from the simulation.
+     *
+     *
+     * @param name
+     */
+    void removeTarget(const std::string &name);
+
+    /**
+     * Replaces the weather cells rendered into the clutter, their paths flown in scenario time from the ARP 0.
+     * The clutter rotations refilled from then on show them.
+     *
+     *
+     * @param cells
+     */
+    void setWeatherCells(const std::vector<WeatherCell> &cells);
+
+    /**
+     * Replaces the noise regions whose false hits are ORed into the clutter, the same seed giving the same hits.
+     * The clutter rotations refilled from then on show them.
+     *
+     *
+     * @param seed
+     * @param regions
+     */
+    void setNoise(const int64_t seed, const std::vector<NoiseRegion> &regions);
+
+    /**
+     * Replaces the sea clutter rendered into the clutter, the same seed giving the same clutter.
+     * The clutter rotations refilled from then on show it.
+     *
+     *
+     * @param seaClutter
+     */
+    void setSeaClutter(const SeaClutter &seaClutter);
+
+    /**
+     * Lists the target layers ORed over the target map.
+     */
+    void listTargetLayers(std::vector<TargetLayer> &_return);
+
+    /**
+     * Adds the target map of a stored scenario as a layer ORed over the target map, or replaces the layer of the
+     * same scenario. The target sectors the beam has not reached yet are patched right away.
+     *
+     *
+     * @param layer
+     */
+    void addTargetLayer(const TargetLayer &layer);
+
+    /**
+     * Enables or disables the target layer from the next sector on.
+     *
+     *
+     * @param scenario
+     * @param enabled
+     */
+    void enableTargetLayer(const std::string &scenario, const bool enabled);
+
+    /**
+     * Removes the target layer from the next sector on.
+     *
+     *
+     * @param scenario
+     */
+    void removeTargetLayer(const std::string &scenario);
+
+    /**
+     * Replaces the sectors blanked on the output of the given subsystem, an empty list blanking nothing.
+     * Targets are blanked from the next sector on, clutter from the next rotation on.
+     *
+     *
+     * @param subSystem
+     * @param sectors
+     */
+    void setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> &sectors);
+
+    /**
+     * Queues the commands to fire at their ACP, the ones already due firing right away.
+     * The ACP index counts on from the simulation ACP index the queue was empty at.
+     *
+     *
+     * @param commands
+     */
+    void scheduleCommands(const std::vector<ScheduledCommand> &commands);
+
+    /**
+     * Lists the commands still queued, in the order they fire.
+     *
+     */
+    void listScheduledCommands(std::vector<ScheduledCommand> &_return);
+
+    /**
+     * Drops the commands still queued.
+     *
+     */
+    void clearSchedule();
+
+    /**
+     * Starts recording every ring slot committed to the DMA into a capture of the given name, replacing the running
+     * capture. With row payloads the committed rows are kept too, compressed.
+     *
+     * @param name
+     * @param rowPayloads
+     */
+    void startCapture(const std::string &name, const bool rowPayloads);
+
+    /**
+     * Stops the running capture once its records are written.
+     *
+     */
+    void stopCapture();
+
+    /**
+     * Returns the health of the clutter and target DMA channels, which are reset and re-armed on a halt, an error
+     * or a stall with the ring contents kept.
+     *
+     */
+    void getDmaHealth(std::vector<DmaHealth> &_return);
+
+    /**
+     * Points every BD of both rings back to the zero row.
+     */
     void clearAll();
 
     void clearClutterMap();
@@ -168,6 +448,15 @@ public:
 private:
     thread refreshThread = thread();
 
+    /** Scheduling profile of the refresh thread **/
+    RtProfile rtProfile;
+
+    /** Ring layout as requested, clamped to the calibrated ACP count **/
+    RingProfile ringProfile;
+
+    /** Wakeup latency of the refresh thread **/
+    WakeupStats wakeupStats;
+
     /** Device handle to /dev/mem **/
     int devMemHandle;
 
@@ -185,21 +474,32 @@ private:
     /** Calculated block size for one antenna rotation **/
     u32 blockByteSize;
 
-    /** Clutter map memory region **/
-    u32 *clutterMemPtr;
+    /** Cached buffer one rotation is prepared in before it is committed to a ring **/
+    u32 *stagingMem = NULL;
 
-    u32 clutterArpLoadIdx;
+    /** BD spaces of the clutter and target DMA, physical address and size **/
+    UINTPTR clutterBdSpace;
+    u32 clutterBdSpaceSize;
+    UINTPTR targetBdSpace;
+    u32 targetBdSpaceSize;
+
+    /** Rows the BDs of both rings point to, the rest of the scratch memory **/
+    RowPool rowPool;
+
+    /** Clutter ring, a BD per row of clutterDepth rotations, a slot per rotation **/
+    PooledRing clutterRing = PooledRing(rowPool);
 
-    /** Clutter memory region size in 32bit words **/
-    u32 clutterMapWordSize;
+    u32 clutterArpLoadIdx;
 
-    /** Target map memory region **/
-    u32 *targetMemPtr;
+    /** Target ring, a BD per row of one rotation, a slot per sector **/
+    PooledRing targetRing = PooledRing(rowPool);
 
-    u32 targetArpLoadIdx;
+    /** Next target sector to load, counted from the starting ARP on **/
+    u32 targetSectorLoadIdx;
 
-    /** Target memory region size in 32bit words **/
-    u32 targetMapWordSize;
+    /** Rows changed and copied into the pool by the target sectors loaded since the last LOAD_MT_ARP_MAP **/
+    u64 targetChangedRows;
+    u64 targetCopiedRows;
 
     /** AXI DMA for clutter maps **/
     XAxiDma clutterDma;
@@ -210,6 +510,69 @@ private:
     /** initial ARP offset **/
     u32 fromArpIdx;
 
+    /** ACPs the loaded scenario is turned by **/
+    s32 loadAcpOffset = 0;
+
+    /** Sources as loaded, before they are played **/
+    shared_ptr<MapSource> clutterMap;
+    shared_ptr<MapSource> targetMap;
+
+    /** Sources the rings are refilled from **/
+    shared_ptr<MapSource> clutterSource;
+    shared_ptr<MapSource> targetSource;
+
+    /** Resident named scenarios **/
+    ScenarioCache scenarioCache = ScenarioCache(SCENARIO_ROOT_DIR, SCENARIO_CACHE_BYTE_SIZE);
+
+    /** Deduplicated map file uploads **/
+    ScenarioIngest scenarioIngest;
+
+    /** Chunked parallel map file uploads **/
+    ChunkIngest chunkIngest;
+
+    /** Name of the scenario feeding the rings, empty for the common location files **/
+    string activeScenario;
+
+    /** Targets rendered on top of the target map **/
+    LiveTargets liveTargets;
+
+    /** Clouds rendered on top of the clutter map **/
+    WeatherCells weatherCells;
+
+    /** False hits ORed into the clutter **/
+    NoiseGenerator noiseGenerator;
+
+    /** Sea clutter ORed into the clutter **/
+    SeaClutterModel seaClutterModel;
+
+    /** Target maps of stored scenarios ORed over the target map **/
+    TargetLayers targetLayers;
+
+    /** Sectors blanked on the output of each ring **/
+    BlankingMask clutterBlanking;
+    BlankingMask targetBlanking;
+
+    /** Serializes the refill with the live target patches, both commit to the rings **/
+    mutex ringMutex;
+
+    /** Serializes the scheduled commands with the enable, disable and load calls **/
+    recursive_mutex controlMutex;
+
+    /** Exercise commands fired at their ACP **/
+    CommandScheduler commandScheduler;
+
+    /** Audit trail of the committed ring slots **/
+    CaptureRecorder captureRecorder;
+
+    /** Row keys of the map rows hashed for a capture, kept to not allocate on every commit **/
+    std::vector<u64> captureKeys;
+
+    /** Both DMA channels run between the enable and the disable **/
+    atomic<bool> dmaArmed {false};
+
+    /** Watches the DMA channels and recovers the faulty ones **/
+    DmaMonitor dmaMonitor;
+
     /**
      * Converts a virtual (mmap-ed) address to the physical address.
      */
@@ -221,12 +584,17 @@ private:
     UINTPTR addrToVirtual(UINTPTR physicalAddress);
 
     /**
-     * Initializes the memory pointers and region to the clutter maps and DMA engine.
+     * Lays out the BD spaces and the row pool in the scratch memory for the calibrated ACP count.
+     */
+    void initRowPool();
+
+    /**
+     * Initializes the clutter DMA engine and its BD space.
      */
     void initClutterDma();
 
     /**
-     * Initializes the memory pointers and region to the target maps and DMA engine.
+     * Initializes the target DMA engine and its BD space.
      */
     void initTargetDma();
 
@@ -242,21 +610,113 @@ private:
     static void initScatterGatherBufferDescriptors(XAxiDma *dma, UINTPTR virtDataAddr, UINTPTR physDataAddr, long size);
 
     /**
-     * Initiates the AXI DMA engine using the Xilinx APIs.
+     * Initiates the AXI DMA engine using the Xilinx APIs, the first BD handed to it pointing
+     * to the given ring row.
+     */
+    static void startDmaTransfer(XAxiDma *dmaPtr, PooledRing &ring, u32 firstRow);
+
+    /**
+     * Resets the DMA engine, which halts it. Returns false if the reset did not complete.
      */
-    static XAxiDma_Bd *startDmaTransfer(XAxiDma *dmaPtr, UINTPTR physMemAddr, u32 simBlockByteSize, int blockCount, XAxiDma_Bd *oldFirstBtPtr);
+    static bool stopDmaTransfer(XAxiDma *dmaPtr);
 
-    void stopDmaTransfer(XAxiDma *dmaPtr);
+    /**
+     * Resets and reinitializes the DMA engine of the subsystem and hands it the ring from the
+     * given row on. Expects the ring mutex to be held.
+     */
+    void armDma(SubSystem::type subSystem, u32 firstRow);
+
+    /**
+     * Reads the status of the DMA channel for the monitor.
+     */
+    DmaProbe probeDma(SubSystem::type subSystem);
+
+    /**
+     * Re-arms a faulty DMA channel at the row under the beam, returns false if the simulator
+     * was disabled in the meantime.
+     */
+    bool recoverDma(SubSystem::type subSystem);
+
+    /**
+     * Stops the simulator and fills the rings from the given sources, starting at the given ARP position
+     * and turned by the given ACPs.
+     */
+    void loadSources(shared_ptr<MapSource> clutter, shared_ptr<MapSource> targets, u32 arpPosition, s32 acpOffset);
+
+    /**
+     * Reloads the loaded maps from the given ARP position, the simulator enabled again if it was.
+     */
+    void seek(u32 arpPosition);
+
+    /**
+     * Executes a command the scheduler fired, logging instead of raising what goes wrong.
+     */
+    void runScheduledCommand(const ScheduledCommand &command);
+
+    /**
+     * The source as played into the rings, its segments resolved, turned by the load ACP offset and
+     * its rows resampled to the calibrated ACP count and trigger period.
+     */
+    shared_ptr<MapSource> playedSource(shared_ptr<MapSource> source);
 
     void loadNextMaps();
 
-    void loadNextTargetMap(istream &input);
+    void loadNextTargetMap(MapSource &source);
 
-    void loadNextClutterMap(istream &input);
+    void loadNextClutterMap(MapSource &source);
 
-    XAxiDma_Bd *firstClutterBdPtr;
+    /**
+     * Clutter map rotation played the given number of rotations after the starting ARP.
+     */
+    u32 clutterRotation(MapSource &source, u32 arpIdx);
+
+    /**
+     * Reads the clutter rotation played the given number of rotations after the starting ARP,
+     * merges the weather cells, the sea clutter and the noise into it, blanks it and points its
+     * ring slot at the rows. Returns the number of BDs changed.
+     */
+    u32 commitClutterRotation(MapSource &source, u32 arpIdx);
+
+    /**
+     * Reads the target sector from the source, merges the target layers and the live targets
+     * into it, blanks it and points its ring slot at the rows. Returns the number of BDs changed.
+     */
+    u32 commitTargetSector(MapSource &source, u32 sectorIdx);
+
+    /**
+     * Records the slot just committed from the staging memory if a capture is running,
+     * mapHash being the rowsHash of the rows read from the map before the overlays.
+     */
+    void captureCommit(PooledRing &ring, SubSystem::type subSystem, u32 slot, u32 loadIdx, u32 mapRotation,
+                       u64 mapHash);
+
+    /**
+     * Recommits the target sectors loaded ahead of the beam after a live target or layer change.
+     */
+    void patchTargetSectors(const std::string &name);
+
+    /**
+     * Recommits the clutter rotations queued after the one under the beam.
+     */
+    void patchClutterRotations(const std::string &name);
+
+    /**
+     * Sector the beam is in, counted from the starting ARP on like targetSectorLoadIdx.
+     */
+    u32 beamSector();
 
-    XAxiDma_Bd *firstTargetBdPtr;
+    SweepClock sweepClock();
+
+    /**
+     * Refill period, one target sector but at most REFILL_PERIOD_NS.
+     */
+    long refillPeriodNs();
+
+    /**
+     * Times writing a rotation straight into the uncached row pool against committing it
+     * from the staging buffer, before any row is in use.
+     */
+    void benchmarkCommit();
 
 };
 
@@ -0,0 +1,218 @@
+/*
+ * row_pool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <iostream>
+
+#include "radar_map.hpp"
+#include "row_pool.hpp"
+
+using namespace std;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+void RowPool::init(u32 *memPtr, UINTPTR physAddr, u32 rowCapacity) {
+    this->memPtr = memPtr;
+    this->physAddr = physAddr;
+
+    refCounts.assign(rowCapacity, 0);
+    rowKeys.assign(rowCapacity, 0);
+    rowKeys[POOL_ZERO_ROW] = EMPTY_ROW_KEY_FLAG;
+    rowsByKey.clear();
+    copiedRows = 0;
+
+    // hand out the lower rows first
+    freeRows.clear();
+    for (u32 poolRow = rowCapacity - 1; poolRow > POOL_ZERO_ROW; poolRow--) {
+        freeRows.push_back(poolRow);
+    }
+
+    clearRows(memPtr + POOL_ZERO_ROW * TRIG_WORD_CNT, ROW_BYTE_SIZE);
+}
+
+u32 RowPool::acquire(const u32 *row) {
+
+    // the member hides the free function of the same name
+    auto key = ::rowKey(row);
+    if (key == EMPTY_ROW_KEY_FLAG) {
+        return POOL_ZERO_ROW;
+    }
+
+    auto it = rowsByKey.find(key);
+    if (it != rowsByKey.end()) {
+        refCounts[it->second]++;
+        return it->second;
+    }
+
+    if (freeRows.empty()) {
+        // the pool is sized for every BD to reference a row of its own
+        cerr << "ERR=Row pool exhausted" << endl;
+        return POOL_ZERO_ROW;
+    }
+
+    auto poolRow = freeRows.back();
+    freeRows.pop_back();
+
+    commitRows(memPtr + poolRow * TRIG_WORD_CNT, row, ROW_BYTE_SIZE);
+    copiedRows++;
+
+    refCounts[poolRow] = 1;
+    rowKeys[poolRow] = key;
+    rowsByKey[key] = poolRow;
+    return poolRow;
+}
+
+void RowPool::release(u32 poolRow) {
+    if (poolRow == POOL_ZERO_ROW) {
+        return;
+    }
+    if (--refCounts[poolRow] == 0) {
+        rowsByKey.erase(rowKeys[poolRow]);
+        freeRows.push_back(poolRow);
+    }
+}
+
+UINTPTR RowPool::rowAddress(u32 poolRow) const {
+    return physAddr + poolRow * ROW_BYTE_SIZE;
+}
+
+u64 RowPool::rowKey(u32 poolRow) const {
+    return rowKeys[poolRow];
+}
+
+u32 RowPool::capacity() const {
+    return refCounts.size();
+}
+
+u32 RowPool::usedRows() const {
+    return refCounts.size() - freeRows.size();
+}
+
+u32 RowPool::takeCopiedRows() {
+    auto cnt = copiedRows;
+    copiedRows = 0;
+    return cnt;
+}
+
+PooledRing::PooledRing(RowPool &pool) : pool(pool) {
+}
+
+void PooledRing::resize(u32 rowCount, u32 slotRowCount) {
+    slotRowCnt = slotRowCount;
+    bdRows.assign(rowCount, POOL_ZERO_ROW);
+    bdPtrs.clear();
+
+    auto slotCnt = (rowCount + slotRowCnt - 1) / slotRowCnt;
+    // all bitmaps sized alike, so swapping them never reallocates
+    slotRows.resize(slotCnt);
+    for (auto &rows : slotRows) {
+        rows.resize(slotRowCnt);
+    }
+    stagedRows.resize(slotRowCnt);
+
+    dirtySlots.assign(slotCnt, false);
+    trackedSlots.assign(slotCnt, false);
+}
+
+u32 PooledRing::commit(u32 slot, const u32 *staging) {
+    auto firstRow = slotFirstRow(slot);
+    auto rowCnt = slotRowCount(slot);
+
+    scanOccupancy(staging, rowCnt, stagedRows);
+
+    auto tracked = trackedSlots[slot];
+    auto &before = slotRows[slot];
+
+    u32 changed = 0;
+    for (u32 row = 0; row < rowCnt; row++) {
+        if (tracked && !before.test(row) && !stagedRows.test(row)) {
+            continue;
+        }
+        if (point(firstRow + row, pool.acquire(staging + row * TRIG_WORD_CNT))) {
+            changed++;
+        }
+    }
+
+    swap(before.words, stagedRows.words);
+    trackedSlots[slot] = true;
+    dirtySlots[slot] = true;
+    return changed;
+}
+
+void PooledRing::clear(u32 firstSlot) {
+    for (u32 slot = firstSlot; slot < slotCount(); slot++) {
+        if (dirtySlots[slot]) {
+            auto firstRow = slotFirstRow(slot);
+            for (u32 row = 0; row < slotRowCount(slot); row++) {
+                point(firstRow + row, POOL_ZERO_ROW);
+            }
+            dirtySlots[slot] = false;
+            // the zero rows lost their ACP index, the next commit has to visit them all
+            trackedSlots[slot] = false;
+        }
+    }
+}
+
+u32 PooledRing::bdCount() const {
+    return bdRows.size();
+}
+
+u32 PooledRing::slotCount() const {
+    return slotRows.size();
+}
+
+u32 PooledRing::slotFirstRow(u32 slot) const {
+    return slot * slotRowCnt;
+}
+
+u32 PooledRing::slotRowCount(u32 slot) const {
+    return MIN(slotRowCnt, (u32) bdRows.size() - slotFirstRow(slot));
+}
+
+u64 PooledRing::slotHash(u32 slot) {
+    auto firstRow = slotFirstRow(slot);
+    auto rowCnt = slotRowCount(slot);
+
+    slotKeys.resize(rowCnt);
+    for (u32 row = 0; row < rowCnt; row++) {
+        slotKeys[row] = pool.rowKey(bdRows[firstRow + row]);
+    }
+    return contentHash(slotKeys.data(), slotKeys.size() * sizeof(u64));
+}
+
+vector<UINTPTR> PooledRing::rowAddresses() const {
+    vector<UINTPTR> addresses(bdRows.size());
+    for (u32 i = 0; i < bdRows.size(); i++) {
+        addresses[i] = pool.rowAddress(bdRows[i]);
+    }
+    return addresses;
+}
+
+void PooledRing::attach(XAxiDma_BdRing *txRingPtr, XAxiDma_Bd *firstBdPtr, u32 firstRow) {
+    bdPtrs.resize(bdRows.size());
+    auto currBdPtr = firstBdPtr;
+    for (u32 i = 0; i < bdPtrs.size(); i++) {
+        bdPtrs[(firstRow + i) % bdPtrs.size()] = currBdPtr;
+        currBdPtr = (XAxiDma_Bd *) XAxiDma_BdRingNext(txRingPtr, currBdPtr);
+    }
+}
+
+bool PooledRing::point(u32 bdIdx, u32 poolRow) {
+    auto oldRow = bdRows[bdIdx];
+    if (oldRow == poolRow) {
+        pool.release(poolRow);
+        return false;
+    }
+
+    bdRows[bdIdx] = poolRow;
+    if (!bdPtrs.empty()) {
+        // rows are aligned, no need for the checks of XAxiDma_BdSetBufAddr
+        XAxiDma_BdWrite(bdPtrs[bdIdx], XAXIDMA_BD_BUFA_OFFSET, pool.rowAddress(poolRow));
+    }
+
+    // only now nothing refers to the old row anymore
+    pool.release(oldRow);
+    return true;
+}
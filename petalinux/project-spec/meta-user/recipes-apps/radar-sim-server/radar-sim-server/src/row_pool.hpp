@@ -0,0 +1,161 @@
+/*
+ * row_pool.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ROW_POOL_
+#define ROW_POOL_
+
+#include "xilinx/xil_types.h"
+#include "xilinx/xaxidma.h"
+
+#include "commit_kernels.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Pool row every BD points to as long as there is nothing to emit, all zeros **/
+#define POOL_ZERO_ROW           0
+
+/**  CLASSES **/
+
+/**
+ * Content addressed store of map rows in the DMA window.
+ *
+ * Every distinct row is stored once, no matter how many BDs of the clutter and target
+ * rings reference it, and is written exactly once when it enters the pool. A row returns
+ * to the free list as soon as the last BD stops referencing it.
+ */
+class RowPool {
+public:
+    /**
+     * Takes over the given memory region, dropping all rows, and writes the zero row.
+     */
+    void init(u32 *memPtr, UINTPTR physAddr, u32 rowCapacity);
+
+    /**
+     * Returns a reference to the pool row with the given content, storing it if needed.
+     */
+    u32 acquire(const u32 *row);
+
+    void release(u32 poolRow);
+
+    UINTPTR rowAddress(u32 poolRow) const;
+
+    /**
+     * The rowKey of the pool row contents.
+     */
+    u64 rowKey(u32 poolRow) const;
+
+    u32 capacity() const;
+
+    u32 usedRows() const;
+
+    /**
+     * Returns and resets the number of rows written since the last call.
+     */
+    u32 takeCopiedRows();
+
+private:
+    u32 *memPtr = NULL;
+
+    UINTPTR physAddr = 0;
+
+    std::vector<u32> refCounts;
+
+    std::vector<u64> rowKeys;
+
+    std::vector<u32> freeRows;
+
+    std::unordered_map<u64, u32> rowsByKey;
+
+    u32 copiedRows = 0;
+};
+
+/**
+ * A cyclic DMA ring with one BD per row pointing into the row pool, refilled slot by slot.
+ * A slot is a run of consecutive rows, a whole rotation or an azimuth sector of it, the last
+ * slot is shorter if the slot size does not divide the ring. Refilling a slot means pointing
+ * its BDs at the new rows, only rows new to the pool are copied.
+ */
+class PooledRing {
+public:
+    explicit PooledRing(RowPool &pool);
+
+    /**
+     * Sizes the ring once the ACP count is calibrated, every BD points to the zero row.
+     */
+    void resize(u32 rowCount, u32 slotRowCount);
+
+    /**
+     * Points the slot at the staged rows. Rows without hits before and after are
+     * skipped when the slot content is known. Returns the number of BDs changed.
+     */
+    u32 commit(u32 slot, const u32 *staging);
+
+    /**
+     * Points the slots from firstSlot on back to the zero row.
+     */
+    void clear(u32 firstSlot);
+
+    u32 bdCount() const;
+
+    u32 slotCount() const;
+
+    /**
+     * First ring row of the slot.
+     */
+    u32 slotFirstRow(u32 slot) const;
+
+    u32 slotRowCount(u32 slot) const;
+
+    /**
+     * The rowsHash of the rows the slot's BDs point to, i.e. of what the DMA plays.
+     */
+    u64 slotHash(u32 slot);
+
+    /**
+     * Physical address of the row each BD has to point to, in ring order.
+     */
+    std::vector<UINTPTR> rowAddresses() const;
+
+    /**
+     * Remembers the BDs the ring was handed to the DMA with, the first one pointing to the
+     * given row, from then on commits update them in place.
+     */
+    void attach(XAxiDma_BdRing *txRingPtr, XAxiDma_Bd *firstBdPtr, u32 firstRow);
+
+private:
+    /**
+     * Points the BD at the pool row, which has been acquired for it. Returns false if
+     * it already pointed there.
+     */
+    bool point(u32 bdIdx, u32 poolRow);
+
+    RowPool &pool;
+
+    u32 slotRowCnt = 0;
+
+    /** Pool row per BD **/
+    std::vector<u32> bdRows;
+
+    /** BDs in ring order once attached **/
+    std::vector<XAxiDma_Bd *> bdPtrs;
+
+    /** Slots pointing at anything but the zero row **/
+    std::vector<bool> dirtySlots;
+
+    /** Slots whose row bitmap matches the rows pointed to **/
+    std::vector<bool> trackedSlots;
+
+    std::vector<RowBitmap> slotRows;
+
+    RowBitmap stagedRows;
+
+    std::vector<u64> slotKeys;
+};
+
+#endif /* ROW_POOL_ */
@@ -0,0 +1,141 @@
+/*
+ * rt_profile.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include "rt_profile.hpp"
+
+using namespace std;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+static void pinThread(int cpu) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+
+    auto status = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    if (status != 0) {
+        cerr << "ERR=Unable to pin thread to CPU " << cpu << ": " << strerror(status) << endl;
+    }
+}
+
+void applyServiceProfile(const RtProfile &profile) {
+    if (!profile.enabled) {
+        return;
+    }
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        cerr << "ERR=Unable to lock memory: " << strerror(errno) << endl;
+    }
+
+    pinThread(profile.serviceCpu);
+
+    cout << "RT_PROFILE="
+         << profile.priority << "/"
+         << profile.refillCpu << "/"
+         << profile.serviceCpu
+         << endl;
+}
+
+static void setFifoPriority(int priority) {
+    struct sched_param param;
+    memset(&param, 0x0, sizeof(param));
+    param.sched_priority = priority;
+
+    auto status = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (status != 0) {
+        cerr << "ERR=Unable to set SCHED_FIFO priority " << priority << ": " << strerror(status) << endl;
+    }
+}
+
+void applyRefillProfile(const RtProfile &profile) {
+    if (!profile.enabled) {
+        return;
+    }
+
+    pinThread(profile.refillCpu);
+    setFifoPriority(profile.priority);
+
+    // fault in the stack the refill path will use
+    volatile char stack[RT_PREFAULT_STACK_SIZE];
+    for (size_t i = 0; i < sizeof(stack); i += sysconf(_SC_PAGESIZE)) {
+        stack[i] = 0;
+    }
+}
+
+void applySchedulerProfile(const RtProfile &profile) {
+    if (!profile.enabled) {
+        return;
+    }
+
+    pinThread(profile.refillCpu);
+    setFifoPriority(MIN(profile.priority + 1, sched_get_priority_max(SCHED_FIFO)));
+}
+
+void prefaultMemory(volatile u32 *memPtr, size_t byteSize) {
+    auto pageWordCnt = sysconf(_SC_PAGESIZE) / sizeof(u32);
+    for (size_t i = 0; i < byteSize / sizeof(u32); i += pageWordCnt) {
+        memPtr[i];
+    }
+}
+
+WakeupStats::WakeupStats() : buckets(WAKEUP_BUCKET_CNT + 1) {
+    reset();
+}
+
+void WakeupStats::record(const struct timespec &deadline, const struct timespec &wakeup) {
+
+    auto latencyNs = (wakeup.tv_sec - deadline.tv_sec) * 1000000000LL + (wakeup.tv_nsec - deadline.tv_nsec);
+    auto latencyUs = (u32) (latencyNs > 0 ? latencyNs / 1000 : 0);
+
+    lock_guard<mutex> lock(statsMutex);
+    buckets[MIN(latencyUs / WAKEUP_BUCKET_US, (u32) WAKEUP_BUCKET_CNT)]++;
+    sampleCount++;
+    if (latencyUs > maxLatencyUs) {
+        maxLatencyUs = latencyUs;
+    }
+}
+
+void WakeupStats::reset() {
+    lock_guard<mutex> lock(statsMutex);
+    fill(buckets.begin(), buckets.end(), 0);
+    sampleCount = 0;
+    maxLatencyUs = 0;
+}
+
+u32 WakeupStats::count() {
+    lock_guard<mutex> lock(statsMutex);
+    return sampleCount;
+}
+
+u32 WakeupStats::percentileUs(u32 percentile) {
+    lock_guard<mutex> lock(statsMutex);
+
+    auto threshold = ((u64) sampleCount * percentile + 99) / 100;
+    u64 cumulated = 0;
+    for (u32 i = 0; i < buckets.size(); i++) {
+        cumulated += buckets[i];
+        if (cumulated >= threshold && cumulated > 0) {
+            // the overflow bucket only knows about the maximum
+            return i < WAKEUP_BUCKET_CNT ? (i + 1) * WAKEUP_BUCKET_US : maxLatencyUs;
+        }
+    }
+    return 0;
+}
+
+u32 WakeupStats::maxUs() {
+    lock_guard<mutex> lock(statsMutex);
+    return maxLatencyUs;
+}
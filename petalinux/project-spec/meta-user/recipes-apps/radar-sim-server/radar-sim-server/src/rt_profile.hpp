@@ -0,0 +1,102 @@
+/*
+ * rt_profile.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef RT_PROFILE_
+#define RT_PROFILE_
+
+#include "xilinx/xil_types.h"
+
+#include <time.h>
+
+#include <mutex>
+#include <vector>
+
+/**  CONSTANTS **/
+#define RT_DEFAULT_PRIORITY         80
+#define RT_DEFAULT_REFILL_CPU       1
+#define RT_DEFAULT_SERVICE_CPU      0
+
+/** Stack the refill thread touches up front so it never page faults later **/
+#define RT_PREFAULT_STACK_SIZE      (64 * 1024)
+
+/** Wakeup latency histogram resolution and range **/
+#define WAKEUP_BUCKET_US            10
+#define WAKEUP_BUCKET_CNT           1000
+
+/** STRUCTS **/
+
+/**
+ * Real-time scheduling profile of the refill path, set from the command line.
+ *
+ * When enabled, the refill thread runs SCHED_FIFO pinned to its own core while the Thrift
+ * service and every other thread stay SCHED_OTHER on the service core, and all memory is
+ * locked and pre-faulted.
+ */
+struct RtProfile {
+    bool enabled = false;
+    int priority = RT_DEFAULT_PRIORITY;
+    int refillCpu = RT_DEFAULT_REFILL_CPU;
+    int serviceCpu = RT_DEFAULT_SERVICE_CPU;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Locks all memory and pins the calling thread, and every thread it creates later on,
+ * to the service core.
+ */
+void applyServiceProfile(const RtProfile &profile);
+
+/**
+ * Makes the calling thread the real-time refill thread.
+ */
+void applyRefillProfile(const RtProfile &profile);
+
+/**
+ * Makes the calling thread the real-time command scheduler or DMA monitor thread, sharing the
+ * refill core one priority above the refill thread as they only wake up briefly.
+ */
+void applySchedulerProfile(const RtProfile &profile);
+
+/**
+ * Touches one word per page so the mapping is populated before it is needed.
+ */
+void prefaultMemory(volatile u32 *memPtr, size_t byteSize);
+
+/**  CLASSES **/
+
+/**
+ * Latency histogram of the refill thread wakeups, i.e. how late after its deadline the
+ * thread actually ran.
+ */
+class WakeupStats {
+public:
+    WakeupStats();
+
+    void record(const struct timespec &deadline, const struct timespec &wakeup);
+
+    void reset();
+
+    u32 count();
+
+    /**
+     * Returns the given percentile of the wakeup latency in µs, with WAKEUP_BUCKET_US resolution.
+     */
+    u32 percentileUs(u32 percentile);
+
+    u32 maxUs();
+
+private:
+    std::mutex statsMutex;
+
+    std::vector<u32> buckets;
+
+    u32 sampleCount;
+
+    u32 maxLatencyUs;
+};
+
+#endif /* RT_PROFILE_ */
@@ -0,0 +1,325 @@
+/*
+ * scenario_cache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#include "scenario_cache.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+/** Bookkeeping bytes per stored row, next to the row itself **/
+#define SPARSE_ROW_BYTE_SIZE    (ROW_BYTE_SIZE + sizeof(u32))
+
+bool isValidScenarioName(const string &name) {
+    return !name.empty() && name[0] != '.' && name.find('/') == string::npos;
+}
+
+void raiseScenarioException(const string &name, const string &reason) {
+    cerr << "ERR=Scenario " << name << ": " << reason << endl;
+    auto ex = ScenarioException();
+    ex.name = name;
+    ex.reason = reason;
+    throw ex;
+}
+
+static u64 fileByteSize(const string &path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return 0;
+    }
+    return (u64) st.st_size;
+}
+
+/**
+ * Rotations the map plays through its segments, an endless loop shows as -1.
+ */
+static int32_t playedRotations(MapSource &source) {
+    return (int32_t) (source.segments().empty()
+                      ? source.header().blockCount
+                      : playbackRotationCount(source.segments()));
+}
+
+SparseMapSource::SparseMapSource(MapSource &source, u64 maxByteSize) {
+
+    mapHeader = source.header();
+    mapSegments = source.segments();
+    rowTotal = source.rowCount();
+
+    if (mapHeader.acpCnt == 0 || rowTotal > UINT32_MAX) {
+        RAISE(MapTooLargeException, "Unsupported map of " << rowTotal << " rows");
+    }
+
+    // scan one rotation at a time and keep only the rows with hits
+    vector<u32> buffer(mapHeader.acpCnt * TRIG_WORD_CNT);
+    for (u64 first = 0; first < rowTotal; first += mapHeader.acpCnt) {
+
+        auto rows = (u32) MIN(rowTotal - first, (u64) mapHeader.acpCnt);
+        source.readRows((u32) (first / mapHeader.acpCnt), 0, rows, buffer.data());
+
+        for (u32 i = 0; i < rows; i++) {
+            auto row = &buffer[i * TRIG_WORD_CNT];
+            auto rowIdx = (u32) (first + i);
+
+            // an empty row holds only its own ACP index
+            bool empty = row[0] == rowIdx % mapHeader.acpCnt;
+            for (u32 w = 1; empty && w < TRIG_WORD_CNT; w++) {
+                empty = row[w] == 0;
+            }
+            if (empty) {
+                continue;
+            }
+
+            if ((rowIndexes.size() + 1) * SPARSE_ROW_BYTE_SIZE > maxByteSize) {
+                RAISE(MapTooLargeException, "Map needs more than " << maxByteSize << " bytes");
+            }
+
+            rowIndexes.push_back(rowIdx);
+            rowWords.insert(rowWords.end(), row, row + TRIG_WORD_CNT);
+        }
+    }
+
+    rowIndexes.shrink_to_fit();
+    rowWords.shrink_to_fit();
+}
+
+void SparseMapSource::readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+
+    auto first = (u64) rotation * mapHeader.acpCnt + firstRow;
+
+    auto stored = lower_bound(rowIndexes.begin(), rowIndexes.end(), first);
+    for (u32 i = 0; i < rowCount; i++) {
+        auto rowIdx = first + i;
+        auto row = dst + i * TRIG_WORD_CNT;
+
+        if (stored != rowIndexes.end() && *stored == rowIdx) {
+            memcpy(row, &rowWords[(stored - rowIndexes.begin()) * TRIG_WORD_CNT], ROW_BYTE_SIZE);
+            stored++;
+        } else {
+            memset(row, 0x0, ROW_BYTE_SIZE);
+            if (rowIdx < rowTotal) {
+                row[0] = (u32) (rowIdx % mapHeader.acpCnt);
+            }
+        }
+    }
+}
+
+u64 SparseMapSource::rowCount() const {
+    return rowTotal;
+}
+
+u64 SparseMapSource::residentByteSize() const {
+    return rowIndexes.size() * SPARSE_ROW_BYTE_SIZE;
+}
+
+ScenarioCache::ScenarioCache(const string &rootDir, u64 maxByteSize)
+    : rootDir(rootDir), maxByteSize(maxByteSize), usedByteSize(0), useCounter(0) {
+}
+
+void ScenarioCache::list(vector<ScenarioInfo> &_return, const string &activeName) {
+
+    // collect both the scenarios on disk and the resident ones, sorted by name
+    map<string, ScenarioInfo> infos;
+
+    auto dir = opendir(rootDir.c_str());
+    if (dir) {
+        struct dirent *dirEntry;
+        while ((dirEntry = readdir(dir)) != NULL) {
+            string name = dirEntry->d_name;
+            if (name.empty() || name[0] == '.') {
+                continue;
+            }
+
+            auto clutterFile = scenarioPath(name, SCENARIO_CLUTTER_FILE);
+            auto targetsFile = scenarioPath(name, SCENARIO_TARGETS_FILE);
+            FileMapSource targets(targetsFile);
+            if (!targets.isOpen()) {
+                continue;
+            }
+
+            auto &info = infos[name];
+            info.name = name;
+            info.rotations = playedRotations(targets);
+            info.fileByteSize = (int64_t) (fileByteSize(clutterFile) + fileByteSize(targetsFile));
+        }
+        closedir(dir);
+    }
+
+    for (auto &entry : entries) {
+        // the files on disk are listed already, the resident copy is only missing if they are gone
+        auto onDisk = infos.count(entry.first) > 0;
+        auto &info = infos[entry.first];
+        info.name = entry.first;
+        if (!onDisk) {
+            info.rotations = playedRotations(*entry.second.targets);
+        }
+        info.resident = true;
+        info.residentByteSize = (int64_t) entryByteSize(entry.second);
+    }
+
+    for (auto &info : infos) {
+        info.second.active = info.first == activeName;
+        _return.push_back(info.second);
+    }
+}
+
+void ScenarioCache::preload(const string &name) {
+    load(name);
+}
+
+void ScenarioCache::get(const string &name, shared_ptr<MapSource> &clutter, shared_ptr<MapSource> &targets) {
+    auto &entry = load(name);
+    clutter = entry.clutter;
+    targets = entry.targets;
+}
+
+void ScenarioCache::evict(const string &name) {
+    releaseRetired();
+
+    auto it = entries.find(name);
+    if (it == entries.end()) {
+        return;
+    }
+
+    // a scenario feeding the ring stays accounted for until the ring lets go of it
+    if (isInUse(it->second)) {
+        retired.push_back(make_pair(name, it->second));
+        entries.erase(it);
+
+        cout << "SCENARIO_RETIRED=" << name << "/" << usedByteSize << endl;
+        return;
+    }
+
+    usedByteSize -= entryByteSize(it->second);
+    entries.erase(it);
+
+    cout << "SCENARIO_EVICTED=" << name << "/" << usedByteSize << endl;
+}
+
+void ScenarioCache::releaseRetired() {
+    for (auto it = retired.begin(); it != retired.end();) {
+        if (isInUse(it->second)) {
+            it++;
+            continue;
+        }
+
+        usedByteSize -= entryByteSize(it->second);
+        cout << "SCENARIO_EVICTED=" << it->first << "/" << usedByteSize << endl;
+        it = retired.erase(it);
+    }
+}
+
+ScenarioCache::Entry &ScenarioCache::load(const string &name) {
+
+    if (!isValidScenarioName(name)) {
+        raiseScenarioException(name, "Invalid scenario name");
+    }
+
+    // a resident scenario is reloaded once its files were replaced by an upload
+    auto version = scenarioVersion(name);
+    auto it = entries.find(name);
+    if (it != entries.end() && (version == 0 || version == it->second.version)) {
+        it->second.lastUsed = ++useCounter;
+        return it->second;
+    }
+    evict(name);
+
+    FileMapSource clFile(scenarioPath(name, SCENARIO_CLUTTER_FILE));
+    if (!clFile.isOpen()) {
+        raiseScenarioException(name, "Unable to open " SCENARIO_CLUTTER_FILE);
+    }
+
+    FileMapSource mtFile(scenarioPath(name, SCENARIO_TARGETS_FILE));
+    if (!mtFile.isOpen()) {
+        raiseScenarioException(name, "Unable to open " SCENARIO_TARGETS_FILE);
+    }
+
+    auto startTime = chrono::steady_clock::now();
+
+    Entry entry;
+    try {
+        entry.clutter = make_shared<SparseMapSource>(clFile, maxByteSize);
+        entry.targets = make_shared<SparseMapSource>(mtFile, maxByteSize - entry.clutter->residentByteSize());
+    } catch (MapTooLargeException &e) {
+        raiseScenarioException(name, "Scenario does not fit into the cache");
+    }
+
+    auto byteSize = entryByteSize(entry);
+    makeRoom(byteSize, name);
+
+    entry.lastUsed = ++useCounter;
+    entry.version = version;
+    usedByteSize += byteSize;
+    auto &resident = entries[name] = entry;
+
+    auto loadMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count();
+    cout << "SCENARIO_RESIDENT="
+         << name << "/"
+         << byteSize << "/"
+         << usedByteSize << "/"
+         << loadMs
+         << endl;
+
+    return resident;
+}
+
+void ScenarioCache::makeRoom(u64 byteSize, const string &name) {
+    releaseRetired();
+
+    while (usedByteSize + byteSize > maxByteSize) {
+
+        // least recently used entry not feeding the ring right now
+        auto lru = entries.end();
+        for (auto it = entries.begin(); it != entries.end(); it++) {
+            if (!isInUse(it->second) && (lru == entries.end() || it->second.lastUsed < lru->second.lastUsed)) {
+                lru = it;
+            }
+        }
+
+        if (lru == entries.end()) {
+            raiseScenarioException(name, "Scenario does not fit next to the active one");
+        }
+
+        evict(lru->first);
+    }
+}
+
+string ScenarioCache::scenarioPath(const string &name, const char *fileName) const {
+    return rootDir + "/" + name + "/" + fileName;
+}
+
+u64 ScenarioCache::scenarioVersion(const string &name) const {
+    struct stat clutterStat, targetsStat;
+    if (stat(scenarioPath(name, SCENARIO_CLUTTER_FILE).c_str(), &clutterStat) != 0
+        || stat(scenarioPath(name, SCENARIO_TARGETS_FILE).c_str(), &targetsStat) != 0) {
+        return 0;
+    }
+
+    u64 fields[] = {
+        (u64) clutterStat.st_ino, (u64) clutterStat.st_size,
+        (u64) clutterStat.st_mtim.tv_sec, (u64) clutterStat.st_mtim.tv_nsec,
+        (u64) targetsStat.st_ino, (u64) targetsStat.st_size,
+        (u64) targetsStat.st_mtim.tv_sec, (u64) targetsStat.st_mtim.tv_nsec
+    };
+    // never 0, that stands for missing files
+    return contentHash(fields, sizeof(fields)) | 1;
+}
+
+u64 ScenarioCache::entryByteSize(const Entry &entry) {
+    return entry.clutter->residentByteSize() + entry.targets->residentByteSize();
+}
+
+bool ScenarioCache::isInUse(const Entry &entry) {
+    return entry.clutter.use_count() > 1 || entry.targets.use_count() > 1;
+}
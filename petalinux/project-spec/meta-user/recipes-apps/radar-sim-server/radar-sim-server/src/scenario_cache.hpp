@@ -0,0 +1,153 @@
+/*
+ * scenario_cache.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SCENARIO_CACHE_
+#define SCENARIO_CACHE_
+
+#include "thrift/sim_types.h"
+
+#include "inc/exceptions.hpp"
+#include "radar_map.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**  CONSTANTS **/
+#define SCENARIO_ROOT_DIR           "/var/scenarios"
+#define SCENARIO_CLUTTER_FILE       "clutter.bin"
+#define SCENARIO_TARGETS_FILE       "targets.bin"
+
+/** RAM budget for all resident scenarios **/
+#define SCENARIO_CACHE_BYTE_SIZE    (64 * 1024 * 1024)
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Scenario names are plain directory names below SCENARIO_ROOT_DIR.
+ */
+bool isValidScenarioName(const std::string &name);
+
+/**
+ * Logs and throws the Thrift ScenarioException.
+ */
+void raiseScenarioException(const std::string &name, const std::string &reason);
+
+/**  CLASSES **/
+
+EXCEPTION(Exception, MapTooLargeException);
+
+/**
+ * A map held in RAM in sparse form: only the rows with hits are stored, the empty
+ * rows (nothing but their own ACP index) are regenerated on read.
+ */
+class SparseMapSource : public MapSource {
+public:
+    /**
+     * Reads the whole map from the given source and keeps the non-empty rows.
+     * Raises MapTooLargeException once more than maxByteSize would be needed.
+     */
+    SparseMapSource(MapSource &source, u64 maxByteSize);
+
+    void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+
+    u64 rowCount() const;
+
+    /**
+     * Returns the number of bytes the map occupies in RAM.
+     */
+    u64 residentByteSize() const;
+
+private:
+    /** Linear (rotation * acpCnt + row) indexes of the stored rows, ascending **/
+    std::vector<u32> rowIndexes;
+
+    /** Stored rows, TRIG_WORD_CNT words each **/
+    std::vector<u32> rowWords;
+
+    u64 rowTotal;
+};
+
+/**
+ * Named scenarios (a clutter and a target map each) kept resident for instant switching.
+ *
+ * Scenarios are read from SCENARIO_ROOT_DIR/<name>/ and the least recently used ones are
+ * evicted once the RAM budget is exceeded. Scenarios currently feeding the ring are never
+ * evicted, dropping one explicitly only retires it: its RAM counts against the budget until
+ * the ring lets go of it.
+ */
+class ScenarioCache {
+public:
+    ScenarioCache(const std::string &rootDir, u64 maxByteSize);
+
+    /**
+     * Lists all scenarios found on disk along with their residency.
+     */
+    void list(std::vector<::hr::franp::rsim::ScenarioInfo> &_return, const std::string &activeName);
+
+    /**
+     * Makes the scenario resident, loading it from disk if needed.
+     */
+    void preload(const std::string &name);
+
+    /**
+     * Returns the resident clutter and target maps of the scenario, loading it if needed.
+     */
+    void get(const std::string &name, std::shared_ptr<MapSource> &clutter, std::shared_ptr<MapSource> &targets);
+
+    /**
+     * Drops the scenario from RAM, or retires it while it still feeds the ring.
+     */
+    void evict(const std::string &name);
+
+private:
+    struct Entry {
+        std::shared_ptr<SparseMapSource> clutter;
+        std::shared_ptr<SparseMapSource> targets;
+        u64 lastUsed;
+
+        /** Fingerprint of the files the maps were read from, see scenarioVersion **/
+        u64 version;
+    };
+
+    std::string rootDir;
+
+    u64 maxByteSize;
+
+    u64 usedByteSize;
+
+    /** Monotonic use counter for the LRU order **/
+    u64 useCounter;
+
+    std::map<std::string, Entry> entries;
+
+    /** Dropped entries still referenced by the ring, accounted for in usedByteSize **/
+    std::vector<std::pair<std::string, Entry>> retired;
+
+    Entry &load(const std::string &name);
+
+    void makeRoom(u64 byteSize, const std::string &name);
+
+    /**
+     * Releases the RAM of the retired entries nothing references any more.
+     */
+    void releaseRetired();
+
+    std::string scenarioPath(const std::string &name, const char *fileName) const;
+
+    /**
+     * Hashes inode, size and modification time of both files, 0 if one is missing. An upload
+     * renames a new file into place, so the inode changes even within the same second.
+     */
+    u64 scenarioVersion(const std::string &name) const;
+
+    static u64 entryByteSize(const Entry &entry);
+
+    static bool isInUse(const Entry &entry);
+};
+
+#endif /* SCENARIO_CACHE_ */
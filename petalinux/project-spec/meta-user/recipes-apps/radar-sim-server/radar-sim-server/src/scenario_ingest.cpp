@@ -0,0 +1,303 @@
+/*
+ * scenario_ingest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+#include "scenario_cache.hpp"
+#include "scenario_ingest.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+static bool readFully(int fd, void *data, size_t byteSize, off_t offset) {
+    auto bytes = (char *) data;
+    while (byteSize > 0) {
+        auto cnt = pread(fd, bytes, byteSize, offset);
+        if (cnt <= 0) {
+            return false;
+        }
+        bytes += cnt;
+        byteSize -= cnt;
+        offset += cnt;
+    }
+    return true;
+}
+
+static bool writeFully(int fd, const void *data, size_t byteSize, off_t offset) {
+    auto bytes = (const char *) data;
+    while (byteSize > 0) {
+        auto cnt = pwrite(fd, bytes, byteSize, offset);
+        if (cnt <= 0) {
+            return false;
+        }
+        bytes += cnt;
+        byteSize -= cnt;
+        offset += cnt;
+    }
+    return true;
+}
+
+static off_t rotationOffset(u64 rotationByteSize, u32 rotation) {
+    return (off_t) (MAP_HEADER_BYTE_SIZE + rotation * rotationByteSize);
+}
+
+ScenarioIngest::~ScenarioIngest() {
+    for (auto &upload : uploads) {
+        close(upload.second.fd);
+    }
+}
+
+string ScenarioIngest::mapPath(const string &name, SubSystem::type subSystem) {
+
+    if (!name.empty()) {
+        if (!isValidScenarioName(name)) {
+            raiseScenarioException(name, "Invalid scenario name");
+        }
+
+        // make sure the scenario directory exists
+        mkdir(SCENARIO_ROOT_DIR, 0755);
+        mkdir((string(SCENARIO_ROOT_DIR) + "/" + name).c_str(), 0755);
+    }
+
+    return mapFilePath(name, subSystem);
+}
+
+string ScenarioIngest::mapFilePath(const string &name, SubSystem::type subSystem) {
+
+    if (name.empty()) {
+        return subSystem == SubSystem::CLUTTER ? CLUTTER_MAP_FILE : TARGET_MAP_FILE;
+    }
+
+    return string(SCENARIO_ROOT_DIR) + "/" + name + "/"
+           + (subSystem == SubSystem::CLUTTER ? SCENARIO_CLUTTER_FILE : SCENARIO_TARGETS_FILE);
+}
+
+void ScenarioIngest::begin(vector<int32_t> &_return,
+                           const string &path,
+                           const string &header,
+                           const vector<int64_t> &rotationHashes) {
+
+    // restart an interrupted upload from scratch
+    discard(path);
+
+    if (header.size() < MAP_HEADER_BYTE_SIZE) {
+        raiseScenarioException(path, "Invalid map header");
+    }
+
+    Upload upload;
+    memcpy(&upload.header, header.data(), MAP_HEADER_BYTE_SIZE);
+    upload.rotationByteSize = (u64) upload.header.acpCnt * ROW_BYTE_SIZE;
+    if (upload.rotationByteSize == 0) {
+        raiseScenarioException(path, "Invalid map header");
+    }
+
+    auto rotationCount = (u32) rotationHashes.size();
+    upload.hashes.assign(rotationHashes.begin(), rotationHashes.end());
+    upload.origins.assign(rotationCount, UPLOADED);
+    upload.sourceRotations.assign(rotationCount, 0);
+    upload.received.assign(rotationCount, false);
+
+    // index the rotations already on the board by content
+    unordered_map<u64, pair<Origin, u32>> known;
+    auto oldHashes = currentHashes(path, upload.header.acpCnt);
+    for (u32 i = 0; i < oldHashes.size(); i++) {
+        known.emplace(oldHashes[i], make_pair(CURRENT_FILE, i));
+    }
+
+    u32 reused = 0;
+    for (u32 i = 0; i < rotationCount; i++) {
+        auto it = known.find(upload.hashes[i]);
+        if (it != known.end()) {
+            upload.origins[i] = it->second.first;
+            upload.sourceRotations[i] = it->second.second;
+            reused++;
+        } else {
+            // later repeats of this rotation are copied from the uploaded one
+            known.emplace(upload.hashes[i], make_pair(NEW_FILE, i));
+            _return.push_back((int32_t) i);
+        }
+    }
+
+    auto partPath = path + INGEST_PART_SUFFIX;
+    upload.fd = open(partPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (upload.fd < 0) {
+        raiseScenarioException(path, "Unable to create " + partPath);
+    }
+
+    // the segment table, if any, trails the rotations
+    auto trailerByteSize = header.size() - MAP_HEADER_BYTE_SIZE;
+    auto trailerOffset = rotationOffset(upload.rotationByteSize, rotationCount);
+    if (ftruncate(upload.fd, trailerOffset + trailerByteSize) != 0
+        || !writeFully(upload.fd, header.data(), MAP_HEADER_BYTE_SIZE, 0)
+        || !writeFully(upload.fd, header.data() + MAP_HEADER_BYTE_SIZE, trailerByteSize, trailerOffset)) {
+        close(upload.fd);
+        raiseScenarioException(path, "Unable to allocate " + partPath);
+    }
+
+    uploads[path] = upload;
+
+    cout << "UPLOAD_BEGIN="
+         << path << "/"
+         << rotationCount << "/"
+         << reused << "/"
+         << _return.size()
+         << endl;
+}
+
+void ScenarioIngest::put(const string &path, u32 rotation, const string &data) {
+
+    auto &upload = this->upload(path);
+
+    if (rotation >= upload.hashes.size() || upload.origins[rotation] != UPLOADED) {
+        raiseScenarioException(path, "Unexpected rotation " + to_string(rotation));
+    }
+
+    if (data.size() != upload.rotationByteSize || contentHash(data.data(), data.size()) != upload.hashes[rotation]) {
+        raiseScenarioException(path, "Corrupted rotation " + to_string(rotation));
+    }
+
+    if (!writeFully(upload.fd, data.data(), data.size(), rotationOffset(upload.rotationByteSize, rotation))) {
+        raiseScenarioException(path, "Unable to write rotation " + to_string(rotation));
+    }
+
+    upload.received[rotation] = true;
+}
+
+void ScenarioIngest::commit(const string &path) {
+
+    auto startTime = chrono::steady_clock::now();
+    auto &upload = this->upload(path);
+
+    auto currentFd = open(path.c_str(), O_RDONLY);
+
+    // fill in the rotations that were not uploaded
+    vector<char> buffer(upload.rotationByteSize);
+    u32 copied = 0;
+    for (u32 i = 0; i < upload.hashes.size(); i++) {
+        bool ok = false;
+        switch (upload.origins[i]) {
+            case UPLOADED:
+                ok = upload.received[i];
+                break;
+            case CURRENT_FILE:
+                ok = currentFd >= 0
+                     && readFully(currentFd, buffer.data(), buffer.size(), rotationOffset(upload.rotationByteSize, upload.sourceRotations[i]))
+                     && contentHash(buffer.data(), buffer.size()) == upload.hashes[i]
+                     && writeFully(upload.fd, buffer.data(), buffer.size(), rotationOffset(upload.rotationByteSize, i));
+                copied++;
+                break;
+            case NEW_FILE:
+                ok = upload.received[upload.sourceRotations[i]]
+                     && readFully(upload.fd, buffer.data(), buffer.size(), rotationOffset(upload.rotationByteSize, upload.sourceRotations[i]))
+                     && writeFully(upload.fd, buffer.data(), buffer.size(), rotationOffset(upload.rotationByteSize, i));
+                copied++;
+                break;
+        }
+
+        if (!ok) {
+            if (currentFd >= 0) {
+                close(currentFd);
+            }
+            discard(path);
+            raiseScenarioException(path, "Rotation " + to_string(i) + " is missing, upload again");
+        }
+    }
+
+    if (currentFd >= 0) {
+        close(currentFd);
+    }
+
+    fsync(upload.fd);
+    close(upload.fd);
+    auto hashes = upload.hashes;
+    uploads.erase(path);
+
+    // the old hashes must not outlive the old file, readers keep the old file open
+    auto hashesPath = path + INGEST_HASHES_SUFFIX;
+    unlink(hashesPath.c_str());
+    if (rename((path + INGEST_PART_SUFFIX).c_str(), path.c_str()) != 0) {
+        raiseScenarioException(path, "Unable to replace the map file");
+    }
+    writeHashes(path, hashes);
+
+    auto commitMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count();
+    cout << "UPLOAD_COMMIT="
+         << path << "/"
+         << hashes.size() << "/"
+         << copied << "/"
+         << commitMs
+         << endl;
+}
+
+ScenarioIngest::Upload &ScenarioIngest::upload(const string &path) {
+    auto it = uploads.find(path);
+    if (it == uploads.end()) {
+        raiseScenarioException(path, "No upload in progress");
+    }
+    return it->second;
+}
+
+void ScenarioIngest::discard(const string &path) {
+    auto it = uploads.find(path);
+    if (it != uploads.end()) {
+        close(it->second.fd);
+        unlink((path + INGEST_PART_SUFFIX).c_str());
+        uploads.erase(it);
+    }
+}
+
+vector<u64> ScenarioIngest::currentHashes(const string &path, u32 acpCnt) {
+
+    vector<u64> hashes;
+
+    FileMapSource current(path);
+    if (!current.isOpen() || current.header().acpCnt != acpCnt) {
+        return hashes;
+    }
+
+    auto rotationCount = current.rowCount() / acpCnt;
+
+    // reuse the side file written at the last commit unless the map changed since
+    auto hashesPath = path + INGEST_HASHES_SUFFIX;
+    struct stat mapStat, hashesStat;
+    if (stat(path.c_str(), &mapStat) == 0
+        && stat(hashesPath.c_str(), &hashesStat) == 0
+        && hashesStat.st_mtime >= mapStat.st_mtime
+        && (u64) hashesStat.st_size == rotationCount * sizeof(u64)) {
+
+        hashes.resize(rotationCount);
+        ifstream input(hashesPath, ios_base::in | ios_base::binary);
+        input.read((char *) hashes.data(), hashesStat.st_size);
+        if (input.gcount() == hashesStat.st_size) {
+            return hashes;
+        }
+        hashes.clear();
+    }
+
+    cout << "UPLOAD_HASHING=" << path << "/" << rotationCount << endl;
+
+    vector<u32> rotation(acpCnt * TRIG_WORD_CNT);
+    for (u32 i = 0; i < rotationCount; i++) {
+        current.readRows(i, 0, acpCnt, rotation.data());
+        hashes.push_back(contentHash(rotation.data(), rotation.size() * WORD_SIZE));
+    }
+
+    writeHashes(path, hashes);
+    return hashes;
+}
+
+void ScenarioIngest::writeHashes(const string &path, const vector<u64> &hashes) {
+    ofstream output(path + INGEST_HASHES_SUFFIX, ios_base::out | ios_base::binary | ios_base::trunc);
+    output.write((const char *) hashes.data(), hashes.size() * sizeof(u64));
+}
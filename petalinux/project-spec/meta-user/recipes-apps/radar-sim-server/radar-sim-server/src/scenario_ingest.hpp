@@ -0,0 +1,106 @@
+/*
+ * scenario_ingest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SCENARIO_INGEST_
+#define SCENARIO_INGEST_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**  CONSTANTS **/
+#define INGEST_PART_SUFFIX      ".part"
+#define INGEST_HASHES_SUFFIX    ".hashes"
+
+/**  CLASSES **/
+
+/**
+ * Block level deduplicated upload of map files.
+ *
+ * The client announces the header and the content hash of every rotation of the new file,
+ * gets back the rotations the server does not already have (in the current file or earlier
+ * in the new one), uploads only those and commits. The new file is assembled next to the
+ * current one and renamed over it, so a running simulation keeps reading the old data.
+ *
+ * Rotation hashes of committed files are kept in a side file, so they are only calculated
+ * once for files that arrived another way.
+ */
+class ScenarioIngest {
+public:
+    ~ScenarioIngest();
+
+    /**
+     * Returns the map file the scenario and subsystem are stored in, an empty name stands
+     * for the common location loaded by loadMap.
+     */
+    static std::string mapPath(const std::string &name, ::hr::franp::rsim::SubSystem::type subSystem);
+
+    /**
+     * Returns the same path as mapPath, without checking the name or creating the scenario
+     * directory.
+     */
+    static std::string mapFilePath(const std::string &name, ::hr::franp::rsim::SubSystem::type subSystem);
+
+    /**
+     * Starts the upload of a new version of the file and returns the rotations to upload.
+     * The header may be followed by the segment table, which goes after the rotations.
+     */
+    void begin(std::vector<int32_t> &_return,
+               const std::string &path,
+               const std::string &header,
+               const std::vector<int64_t> &rotationHashes);
+
+    /**
+     * Stores one uploaded rotation, verifying its hash.
+     */
+    void put(const std::string &path, u32 rotation, const std::string &data);
+
+    /**
+     * Assembles the rotations not uploaded and replaces the file.
+     */
+    void commit(const std::string &path);
+
+private:
+    enum Origin {
+        UPLOADED,
+        CURRENT_FILE,
+        NEW_FILE
+    };
+
+    struct Upload {
+        int fd;
+        MapHeader header;
+        u64 rotationByteSize;
+        std::vector<u64> hashes;
+
+        /** Where each rotation comes from and, unless uploaded, its index there **/
+        std::vector<Origin> origins;
+        std::vector<u32> sourceRotations;
+
+        std::vector<bool> received;
+    };
+
+    std::map<std::string, Upload> uploads;
+
+    Upload &upload(const std::string &path);
+
+    void discard(const std::string &path);
+
+    /**
+     * Returns the rotation hashes of the current file, empty if it does not exist or has an
+     * incompatible row layout.
+     */
+    static std::vector<u64> currentHashes(const std::string &path, u32 acpCnt);
+
+    static void writeHashes(const std::string &path, const std::vector<u64> &hashes);
+};
+
+#endif /* SCENARIO_INGEST_ */
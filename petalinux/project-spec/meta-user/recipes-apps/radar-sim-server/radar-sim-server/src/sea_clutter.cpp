@@ -0,0 +1,176 @@
+/*
+ * sea_clutter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+
+#include <iostream>
+
+#include "sea_clutter.hpp"
+#include "live_targets.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+/** Hit probability at the reference range per sea state, falling off with the range cubed beyond it **/
+#define SEA_REFLECTIVITY_STEP       0.05
+#define SEA_REFERENCE_KM            6.0
+#define SEA_MAX_PROBABILITY         0.5
+
+/** Upwind clutter is this much stronger, downwind this much weaker, than crosswind clutter **/
+#define SEA_WIND_CONTRAST           0.5
+
+/** Size and downwind drift of the sea patches, growing with the sea state **/
+#define SEA_PATCH_BASE_KM           0.4
+#define SEA_PATCH_STEP_KM           0.15
+#define SEA_DRIFT_BASE_KMS          0.004
+#define SEA_DRIFT_STEP_KMS          0.002
+
+/** Hit probabilities are quantized to 1/256, each bit costs a random word **/
+#define SEA_PROBABILITY_BITS        8
+
+#define BYTE_BITS                   8
+
+/**
+ * Uniform value in [0, 1] of a patch lattice point.
+ */
+static double latticeValue(u64 seed, s32 ix, s32 iy, u32 generation) {
+    auto z = seed
+             ^ ((u64) (u32) ix * 0x9e3779b97f4a7c15ULL)
+             ^ ((u64) (u32) iy * 0xc2b2ae3d27d4eb4fULL)
+             ^ ((u64) generation * 0x165667b19e3779f9ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    return (z >> 32) / 4294967296.0;
+}
+
+static double smoothStep(double f) {
+    return f * f * (3 - 2 * f);
+}
+
+void SeaClutterModel::set(const SeaClutter &seaClutter) {
+    lock_guard<mutex> lock(seaMutex);
+
+    sea = seaClutter;
+    sea.seaState = MIN(MAX(sea.seaState, 0), SEA_MAX_STATE);
+
+    auto rangeBits = sea.maxRangeKm * LIVE_SIGNAL_US_PER_KM;
+    lastBit = sea.seaState > 0 && rangeBits >= WORD_BITS ? (u32) MIN(rangeBits, MAX_TRIG_BITS - 1.0) : 0;
+
+    cout << "SEA_CLUTTER="
+         << sea.seaState << "/"
+         << sea.windFromDeg << "/"
+         << sea.maxRangeKm << "/"
+         << lastBit
+         << endl;
+}
+
+void SeaClutterModel::render(u32 rotation, double arpUs, u32 acpCnt, u32 *rows) {
+    lock_guard<mutex> lock(seaMutex);
+    if (lastBit == 0) {
+        return;
+    }
+
+    random.seed((u64) sea.seed, rotation);
+
+    auto tS = rotation * arpUs / 1000000;
+    auto windRad = sea.windFromDeg * M_PI / 180;
+    auto reflectivity = sea.seaState * SEA_REFLECTIVITY_STEP;
+    auto lastWord = lastBit / WORD_BITS;
+
+    // per range word of the block: the lowest probability bit set in any byte, and a byte
+    // mask for each probability bit selecting the bytes that have it set
+    u32 firstProbabilityBit[TRIG_WORD_CNT];
+    u32 selectors[TRIG_WORD_CNT][SEA_PROBABILITY_BITS];
+
+    for (u32 firstAcp = 0; firstAcp < acpCnt; firstAcp += SEA_BLOCK_ACP_CNT) {
+        auto blockAcpCnt = MIN((u32) SEA_BLOCK_ACP_CNT, acpCnt - firstAcp);
+        auto azRad = (firstAcp + blockAcpCnt / 2.0) / acpCnt * 2 * M_PI;
+        auto wind = 1 + SEA_WIND_CONTRAST * cos(azRad - windRad);
+        auto sinAz = sin(azRad);
+        auto cosAz = cos(azRad);
+
+        for (u32 w = 1; w <= lastWord; w++) {
+            u32 anyBits = 0;
+            for (u32 i = 0; i < SEA_PROBABILITY_BITS; i++) {
+                selectors[w][i] = 0;
+            }
+
+            for (u32 b = 0; b < WORD_SIZE; b++) {
+                auto rKm = (w * WORD_BITS + b * BYTE_BITS + BYTE_BITS / 2.0) / LIVE_SIGNAL_US_PER_KM;
+                auto falloff = rKm <= SEA_REFERENCE_KM ? 1 : pow(SEA_REFERENCE_KM / rKm, 3);
+                auto p = reflectivity * wind * falloff * texture(rKm * sinAz, rKm * cosAz, tS);
+                auto quantized = (u32) (MIN(p, SEA_MAX_PROBABILITY) * (1 << SEA_PROBABILITY_BITS));
+
+                anyBits |= quantized;
+                for (u32 i = 0; i < SEA_PROBABILITY_BITS; i++) {
+                    if ((quantized >> i) & 1) {
+                        selectors[w][i] |= 0xFFu << (b * BYTE_BITS);
+                    }
+                }
+            }
+            firstProbabilityBit[w] = anyBits != 0 ? __builtin_ctz(anyBits) : SEA_PROBABILITY_BITS;
+        }
+
+        for (auto acp = firstAcp; acp < firstAcp + blockAcpCnt; acp++) {
+            auto row = rows + acp * TRIG_WORD_CNT;
+
+            for (u32 w = 1; w <= lastWord; w++) {
+                // from the least significant probability bit up, a set bit ORs a random word in
+                // and a clear one ANDs it, leaving every bit set with the probability of its byte
+                u32 hits = 0;
+                for (auto i = firstProbabilityBit[w]; i < SEA_PROBABILITY_BITS; i++) {
+                    auto r = random.next();
+                    hits = (hits & r) | (selectors[w][i] & (hits | r));
+                }
+
+                if (w == lastWord && lastBit % WORD_BITS != WORD_BITS - 1) {
+                    hits &= (2u << (lastBit % WORD_BITS)) - 1;
+                }
+                row[w] |= hits;
+            }
+        }
+    }
+}
+
+double SeaClutterModel::texture(double xKm, double yKm, double tS) {
+    // the patches drift downwind, i.e. the sea seen at a position came from upwind of it
+    auto windRad = sea.windFromDeg * M_PI / 180;
+    auto driftKm = (SEA_DRIFT_BASE_KMS + sea.seaState * SEA_DRIFT_STEP_KMS) * tS;
+    xKm += sin(windRad) * driftKm;
+    yKm += cos(windRad) * driftKm;
+
+    auto g = tS / SEA_TEXTURE_PERIOD_S;
+    auto generation = (u32) floor(g);
+    auto n = patchNoise(xKm, yKm, generation);
+    n += (patchNoise(xKm, yKm, generation + 1) - n) * smoothStep(g - generation);
+
+    // spiky, a few patches carry most of the clutter
+    return 3 * n * n;
+}
+
+double SeaClutterModel::patchNoise(double xKm, double yKm, u32 generation) {
+    auto patchKm = SEA_PATCH_BASE_KM + sea.seaState * SEA_PATCH_STEP_KM;
+    auto gx = xKm / patchKm;
+    auto gy = yKm / patchKm;
+    auto ix = (s32) floor(gx);
+    auto iy = (s32) floor(gy);
+    auto fx = smoothStep(gx - ix);
+    auto fy = smoothStep(gy - iy);
+
+    auto seed = (u64) sea.seed;
+    auto v00 = latticeValue(seed, ix, iy, generation);
+    auto v10 = latticeValue(seed, ix + 1, iy, generation);
+    auto v01 = latticeValue(seed, ix, iy + 1, generation);
+    auto v11 = latticeValue(seed, ix + 1, iy + 1, generation);
+
+    auto v0 = v00 + (v10 - v00) * fx;
+    auto v1 = v01 + (v11 - v01) * fx;
+    return v0 + (v1 - v0) * fy;
+}
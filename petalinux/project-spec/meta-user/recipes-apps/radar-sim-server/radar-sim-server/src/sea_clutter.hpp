@@ -0,0 +1,72 @@
+/*
+ * sea_clutter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SEA_CLUTTER_
+#define SEA_CLUTTER_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+#include "noise_generator.hpp"
+
+#include <mutex>
+
+/**  CONSTANTS **/
+
+#define SEA_MAX_STATE               9
+
+/** ACPs sharing one hit probability, it is evaluated per ACP block and range byte **/
+#define SEA_BLOCK_ACP_CNT           8
+
+/** Time the texture of a patch takes to change completely **/
+#define SEA_TEXTURE_PERIOD_S        30.0
+
+/**  CLASSES **/
+
+/**
+ * Statistical sea clutter rendered into every clutter rotation as it is refilled.
+ *
+ * The hit probability of each range bit is the sea state reflectivity, falling off with the
+ * third power of the range, strongest looking upwind, times a spiky texture of sea patches.
+ * The patches drift downwind and slowly blend into new ones, so consecutive rotations show
+ * correlated clutter while the hits themselves are drawn anew. The probability is evaluated
+ * once per ACP block and range byte and the 32 hits of a word are drawn at once, bit-sliced
+ * from the random words of NoiseRandom, each byte with its own probability.
+ */
+class SeaClutterModel {
+public:
+    /**
+     * Replaces the sea, the sea state is clamped to [0, SEA_MAX_STATE].
+     */
+    void set(const ::hr::franp::rsim::SeaClutter &seaClutter);
+
+    /**
+     * ORs the sea clutter of the given scenario rotation into its acpCnt rows.
+     */
+    void render(u32 rotation, double arpUs, u32 acpCnt, u32 *rows);
+
+private:
+    std::mutex seaMutex;
+
+    ::hr::franp::rsim::SeaClutter sea;
+
+    /** Last range bit with clutter, 0 for a calm sea **/
+    u32 lastBit = 0;
+
+    NoiseRandom random;
+
+    /**
+     * Texture of the sea around the given position, with a mean of about one.
+     */
+    double texture(double xKm, double yKm, double tS);
+
+    /**
+     * Value noise of the given texture generation, in [0, 1].
+     */
+    double patchNoise(double xKm, double yKm, u32 generation);
+};
+
+#endif /* SEA_CLUTTER_ */
@@ -0,0 +1,97 @@
+/*
+ * target_layers.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <iostream>
+
+#include "target_layers.hpp"
+#include "commit_kernels.hpp"
+#include "scenario_cache.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+TargetLayers::~TargetLayers() {
+    freeStaging(layerRows);
+}
+
+void TargetLayers::add(const TargetLayer &layer, shared_ptr<MapSource> map, const PlayFunc &play) {
+    auto source = play(map);
+
+    lock_guard<mutex> lock(layersMutex);
+    layers[layer.scenario] = Layer {layer, map, source};
+    cout << "TARGET_LAYER_ADDED="
+         << layer.scenario << "/"
+         << layer.startArp << "/"
+         << layer.enabled << "/"
+         << layers.size()
+         << endl;
+}
+
+void TargetLayers::replay(const PlayFunc &play) {
+    lock_guard<mutex> lock(layersMutex);
+    for (auto &entry : layers) {
+        entry.second.source = play(entry.second.map);
+    }
+}
+
+void TargetLayers::enable(const string &scenario, bool enabled) {
+    lock_guard<mutex> lock(layersMutex);
+    auto it = layers.find(scenario);
+    if (it == layers.end()) {
+        raiseScenarioException(scenario, "no such target layer");
+    }
+    it->second.definition.enabled = enabled;
+    cout << "TARGET_LAYER_ENABLED=" << scenario << "/" << enabled << endl;
+}
+
+void TargetLayers::remove(const string &scenario) {
+    lock_guard<mutex> lock(layersMutex);
+    if (layers.erase(scenario) == 0) {
+        raiseScenarioException(scenario, "no such target layer");
+    }
+    cout << "TARGET_LAYER_REMOVED=" << scenario << "/" << layers.size() << endl;
+}
+
+void TargetLayers::list(vector<TargetLayer> &_return) {
+    lock_guard<mutex> lock(layersMutex);
+    for (auto &entry : layers) {
+        _return.push_back(entry.second.definition);
+    }
+}
+
+u32 TargetLayers::composite(u32 rotation, u32 firstRow, u32 rowCount, u32 *rows) {
+    lock_guard<mutex> lock(layersMutex);
+
+    u32 composited = 0;
+    for (auto &entry : layers) {
+        auto &layer = entry.second;
+        if (!layer.definition.enabled) {
+            continue;
+        }
+
+        // not started yet or played to its end
+        auto layerRotation = (s64) rotation - layer.definition.startArp;
+        if (layerRotation < 0 || layerRotation >= layer.source->header().blockCount) {
+            continue;
+        }
+
+        if (rowCount > layerRowCapacity) {
+            freeStaging(layerRows);
+            layerRows = allocStaging((size_t) rowCount * ROW_BYTE_SIZE);
+            layerRowCapacity = layerRows != NULL ? rowCount : 0;
+        }
+        if (layerRows == NULL) {
+            cerr << "ERR=Target layer staging allocation failed" << endl;
+            return composited;
+        }
+
+        // the rows carry the same ACP indexes, ORing the whole rows keeps them
+        layer.source->readRows((u32) layerRotation, firstRow, rowCount, layerRows);
+        orRows(rows, layerRows, (size_t) rowCount * ROW_BYTE_SIZE);
+        composited++;
+    }
+    return composited;
+}
@@ -0,0 +1,83 @@
+/*
+ * target_layers.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef TARGET_LAYERS_
+#define TARGET_LAYERS_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**  CLASSES **/
+
+/**
+ * Target maps of stored scenarios ORed over the target map whenever a target ring sector is
+ * committed, e.g. a recorded formation plus a pop-up target, each playing from its own start
+ * ARP and switched on and off without regenerating or uploading anything.
+ */
+class TargetLayers {
+public:
+    typedef std::function<std::shared_ptr<MapSource>(std::shared_ptr<MapSource>)> PlayFunc;
+
+    ~TargetLayers();
+
+    /**
+     * Adds the layer of the scenario target map, played through play, or replaces the one
+     * of the same scenario.
+     */
+    void add(const ::hr::franp::rsim::TargetLayer &layer, std::shared_ptr<MapSource> map, const PlayFunc &play);
+
+    /**
+     * Plays every layer through play again, once the main maps are played with another ACP
+     * offset or calibration.
+     */
+    void replay(const PlayFunc &play);
+
+    /**
+     * Raises ScenarioException if there is no layer of the scenario.
+     */
+    void enable(const std::string &scenario, bool enabled);
+
+    /**
+     * Raises ScenarioException if there is no layer of the scenario.
+     */
+    void remove(const std::string &scenario);
+
+    void list(std::vector<::hr::franp::rsim::TargetLayer> &_return);
+
+    /**
+     * ORs the rows of all enabled layers into the given rows of a scenario rotation.
+     * Returns the number of layers that had rows there.
+     */
+    u32 composite(u32 rotation, u32 firstRow, u32 rowCount, u32 *rows);
+
+private:
+    struct Layer {
+        ::hr::franp::rsim::TargetLayer definition;
+
+        /** Scenario target map as stored and the source it is played through **/
+        std::shared_ptr<MapSource> map;
+        std::shared_ptr<MapSource> source;
+    };
+
+    std::mutex layersMutex;
+
+    std::map<std::string, Layer> layers;
+
+    /** Rows of one layer, before they are ORed in **/
+    u32 *layerRows = NULL;
+
+    u32 layerRowCapacity = 0;
+};
+
+#endif /* TARGET_LAYERS_ */
@@ -71,18 +71,244 @@ class SimulatorIf {
   virtual void disableNorm() = 0;
 
   /**
-   * Loads the clutter and target map data from the common location.
+   * Loads the clutter and target map data from the common location, turned clockwise by the given number
+   * of ACPs to align the scenario north with the radar.
    * 
    * 
    * @param arpPosition
+   * @param acpOffset
    */
-  virtual void loadMap(const int32_t arpPosition) = 0;
+  virtual void loadMap(const int32_t arpPosition, const int32_t acpOffset) = 0;
 
   /**
    * Returns the state of the simulator.
    * 
    */
   virtual void getState(SimState& _return) = 0;
+
+  /**
+   * Lists the scenarios stored on the board and the ones resident in the scenario cache.
+   * 
+   */
+  virtual void listScenarios(std::vector<ScenarioInfo> & _return) = 0;
+
+  /**
+   * Loads the named scenario into the scenario cache, evicting the least recently used ones if needed.
+   * 
+   * 
+   * @param name
+   */
+  virtual void preloadScenario(const std::string& name) = 0;
+
+  /**
+   * Fills the ring from the resident named scenario, starting at the given ARP position.
+   * 
+   * 
+   * @param name
+   * @param arpPosition
+   */
+  virtual void activateScenario(const std::string& name, const int32_t arpPosition) = 0;
+
+  /**
+   * Drops the named scenario from the scenario cache.
+   * 
+   * 
+   * @param name
+   */
+  virtual void evictScenario(const std::string& name) = 0;
+
+  /**
+   * Starts a deduplicated upload of a map file and returns the rotations the server does not have yet.
+   * An empty name stands for the common location loaded by loadMap.
+   * The header is followed by the segment table of the file, if it has one.
+   * 
+   * 
+   * @param name
+   * @param subSystem
+   * @param header
+   * @param rotationHashes
+   */
+  virtual void beginUpload(std::vector<int32_t> & _return, const std::string& name, const SubSystem::type subSystem, const std::string& header, const std::vector<int64_t> & rotationHashes) = 0;
+
+  /**
+   * Uploads one of the rotations requested by beginUpload.
+   * 
+   * 
+   * @param name
+   * @param subSystem
+   * @param rotation
+   * @param data
+   */
+  virtual void uploadRotation(const std::string& name, const SubSystem::type subSystem, const int32_t rotation, const std::string& data) = 0;
+
+  /**
+   * Assembles the uploaded map file from the uploaded rotations and the ones already on the board.
+   * 
+   * 
+   * @param name
+   * @param subSystem
+   */
+  virtual void commitUpload(const std::string& name, const SubSystem::type subSystem) = 0;
+
+  /**
+   * Starts a chunked map file ingest, or resumes the unfinished one of the same size, and returns the chunks
+   * still to be streamed to the ingest port. An empty name stands for the common location loaded by loadMap.
+   * 
+   * 
+   * @param name
+   * @param subSystem
+   * @param fileByteSize
+   * @param chunkByteSize
+   */
+  virtual void beginIngest(IngestState& _return, const std::string& name, const SubSystem::type subSystem, const int64_t fileByteSize, const int32_t chunkByteSize) = 0;
+
+  /**
+   * Returns the progress of a chunked map file ingest.
+   * 
+   * 
+   * @param name
+   * @param subSystem
+   */
+  virtual void getIngestState(IngestState& _return, const std::string& name, const SubSystem::type subSystem) = 0;
+
+  /**
+   * Adds a target to the running simulation, its path starts at the time of the call.
+   * The target rows the beam has not reached yet are patched right away.
+   * 
+   * 
+   * @param target
+   */
+  virtual void addTarget(const LiveTarget& target) = 0;
+
+  /**
+   * Replaces the live target of the same name, its path restarts at the time of the call.
+   * 
+   * 
+   * @param target
+   */
+  virtual void modifyTarget(const LiveTarget& target) = 0;
+
+  /**
+   * Removes the live target from the simulation.
+   * 
+   * 
+   * @param name
+   */
+  virtual void removeTarget(const std::string& name) = 0;
+
+  /**
+   * Replaces the weather cells rendered into the clutter, their paths flown in scenario time from the ARP 0.
+   * The clutter rotations refilled from then on show them.
+   * 
+   * 
+   * @param cells
+   */
+  virtual void setWeatherCells(const std::vector<WeatherCell> & cells) = 0;
+
+  /**
+   * Replaces the noise regions whose false hits are ORed into the clutter, the same seed giving the same hits.
+   * The clutter rotations refilled from then on show them.
+   * 
+   * 
+   * @param seed
+   * @param regions
+   */
+  virtual void setNoise(const int64_t seed, const std::vector<NoiseRegion> & regions) = 0;
+
+  /**
+   * Replaces the sea clutter rendered into the clutter, the same seed giving the same clutter.
+   * The clutter rotations refilled from then on show it.
+   * 
+   * 
+   * @param seaClutter
+   */
+  virtual void setSeaClutter(const SeaClutter& seaClutter) = 0;
+
+  /**
+   * Lists the target layers ORed over the target map.
+   * 
+   */
+  virtual void listTargetLayers(std::vector<TargetLayer> & _return) = 0;
+
+  /**
+   * Adds the target map of a stored scenario as a layer ORed over the target map, or replaces the layer of the
+   * same scenario. The target sectors the beam has not reached yet are patched right away.
+   * 
+   * 
+   * @param layer
+   */
+  virtual void addTargetLayer(const TargetLayer& layer) = 0;
+
+  /**
+   * Enables or disables the target layer from the next sector on.
+   * 
+   * 
+   * @param scenario
+   * @param enabled
+   */
+  virtual void enableTargetLayer(const std::string& scenario, const bool enabled) = 0;
+
+  /**
+   * Removes the target layer from the next sector on.
+   * 
+   * 
+   * @param scenario
+   */
+  virtual void removeTargetLayer(const std::string& scenario) = 0;
+
+  /**
+   * Replaces the sectors blanked on the output of the given subsystem, an empty list blanking nothing.
+   * Targets are blanked from the next sector on, clutter from the next rotation on.
+   * 
+   * 
+   * @param subSystem
+   * @param sectors
+   */
+  virtual void setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> & sectors) = 0;
+
+  /**
+   * Queues the commands to fire at their ACP, the ones already due firing right away.
+   * The ACP index counts on from the simulation ACP index the queue was empty at.
+   * 
+   * 
+   * @param commands
+   */
+  virtual void scheduleCommands(const std::vector<ScheduledCommand> & commands) = 0;
+
+  /**
+   * Lists the commands still queued, in the order they fire.
+   * 
+   */
+  virtual void listScheduledCommands(std::vector<ScheduledCommand> & _return) = 0;
+
+  /**
+   * Drops the commands still queued.
+   * 
+   */
+  virtual void clearSchedule() = 0;
+
+  /**
+   * Starts recording every ring slot committed to the DMA into a capture of the given name, replacing the running
+   * capture. With row payloads the committed rows are kept too, compressed.
+   * 
+   * 
+   * @param name
+   * @param rowPayloads
+   */
+  virtual void startCapture(const std::string& name, const bool rowPayloads) = 0;
+
+  /**
+   * Stops the running capture once its records are written.
+   * 
+   */
+  virtual void stopCapture() = 0;
+
+  /**
+   * Returns the health of the clutter and target DMA channels, which are reset and re-armed on a halt, an error
+   * or a stall with the ring contents kept.
+   * 
+   */
+  virtual void getDmaHealth(std::vector<DmaHealth> & _return) = 0;
 };
 
 class SimulatorIfFactory {
@@ -136,12 +362,90 @@ class SimulatorNull : virtual public SimulatorIf {
   void disableNorm() {
     return;
   }
-  void loadMap(const int32_t /* arpPosition */) {
+  void loadMap(const int32_t /* arpPosition */, const int32_t /* acpOffset */) {
     return;
   }
   void getState(SimState& /* _return */) {
     return;
   }
+  void listScenarios(std::vector<ScenarioInfo> & /* _return */) {
+    return;
+  }
+  void preloadScenario(const std::string& /* name */) {
+    return;
+  }
+  void activateScenario(const std::string& /* name */, const int32_t /* arpPosition */) {
+    return;
+  }
+  void evictScenario(const std::string& /* name */) {
+    return;
+  }
+  void beginUpload(std::vector<int32_t> & /* _return */, const std::string& /* name */, const SubSystem::type /* subSystem */, const std::string& /* header */, const std::vector<int64_t> & /* rotationHashes */) {
+    return;
+  }
+  void uploadRotation(const std::string& /* name */, const SubSystem::type /* subSystem */, const int32_t /* rotation */, const std::string& /* data */) {
+    return;
+  }
+  void commitUpload(const std::string& /* name */, const SubSystem::type /* subSystem */) {
+    return;
+  }
+  void beginIngest(IngestState& /* _return */, const std::string& /* name */, const SubSystem::type /* subSystem */, const int64_t /* fileByteSize */, const int32_t /* chunkByteSize */) {
+    return;
+  }
+  void getIngestState(IngestState& /* _return */, const std::string& /* name */, const SubSystem::type /* subSystem */) {
+    return;
+  }
+  void addTarget(const LiveTarget& /* target */) {
+    return;
+  }
+  void modifyTarget(const LiveTarget& /* target */) {
+    return;
+  }
+  void removeTarget(const std::string& /* name */) {
+    return;
+  }
+  void setWeatherCells(const std::vector<WeatherCell> & /* cells */) {
+    return;
+  }
+  void setNoise(const int64_t /* seed */, const std::vector<NoiseRegion> & /* regions */) {
+    return;
+  }
+  void setSeaClutter(const SeaClutter& /* seaClutter */) {
+    return;
+  }
+  void listTargetLayers(std::vector<TargetLayer> & /* _return */) {
+    return;
+  }
+  void addTargetLayer(const TargetLayer& /* layer */) {
+    return;
+  }
+  void enableTargetLayer(const std::string& /* scenario */, const bool /* enabled */) {
+    return;
+  }
+  void removeTargetLayer(const std::string& /* scenario */) {
+    return;
+  }
+  void setBlanking(const SubSystem::type /* subSystem */, const std::vector<BlankingSector> & /* sectors */) {
+    return;
+  }
+  void scheduleCommands(const std::vector<ScheduledCommand> & /* commands */) {
+    return;
+  }
+  void listScheduledCommands(std::vector<ScheduledCommand> & /* _return */) {
+    return;
+  }
+  void clearSchedule() {
+    return;
+  }
+  void startCapture(const std::string& /* name */, const bool /* rowPayloads */) {
+    return;
+  }
+  void stopCapture() {
+    return;
+  }
+  void getDmaHealth(std::vector<DmaHealth> & /* _return */) {
+    return;
+  }
 };
 
 
@@ -763,8 +1067,9 @@ class Simulator_disableNorm_presult {
 };
 
 typedef struct _Simulator_loadMap_args__isset {
-  _Simulator_loadMap_args__isset() : arpPosition(false) {}
+  _Simulator_loadMap_args__isset() : arpPosition(false), acpOffset(false) {}
   bool arpPosition :1;
+  bool acpOffset :1;
 } _Simulator_loadMap_args__isset;
 
 class Simulator_loadMap_args {
@@ -772,20 +1077,25 @@ class Simulator_loadMap_args {
 
   Simulator_loadMap_args(const Simulator_loadMap_args&);
   Simulator_loadMap_args& operator=(const Simulator_loadMap_args&);
-  Simulator_loadMap_args() : arpPosition(0) {
+  Simulator_loadMap_args() : arpPosition(0), acpOffset(0) {
   }
 
   virtual ~Simulator_loadMap_args() throw();
   int32_t arpPosition;
+  int32_t acpOffset;
 
   _Simulator_loadMap_args__isset __isset;
 
   void __set_arpPosition(const int32_t val);
 
+  void __set_acpOffset(const int32_t val);
+
   bool operator == (const Simulator_loadMap_args & rhs) const
   {
     if (!(arpPosition == rhs.arpPosition))
       return false;
+    if (!(acpOffset == rhs.acpOffset))
+      return false;
     return true;
   }
   bool operator != (const Simulator_loadMap_args &rhs) const {
@@ -806,6 +1116,7 @@ class Simulator_loadMap_pargs {
 
   virtual ~Simulator_loadMap_pargs() throw();
   const int32_t* arpPosition;
+  const int32_t* acpOffset;
 
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
@@ -958,72 +1269,2810 @@ class Simulator_getState_presult {
 
 };
 
-class SimulatorClient : virtual public SimulatorIf {
+
+class Simulator_listScenarios_args {
  public:
-  SimulatorClient(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-    setProtocol(prot);
-  }
-  SimulatorClient(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, boost::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    setProtocol(iprot,oprot);
+
+  Simulator_listScenarios_args(const Simulator_listScenarios_args&);
+  Simulator_listScenarios_args& operator=(const Simulator_listScenarios_args&);
+  Simulator_listScenarios_args() {
   }
- private:
-  void setProtocol(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-  setProtocol(prot,prot);
+
+  virtual ~Simulator_listScenarios_args() throw();
+
+  bool operator == (const Simulator_listScenarios_args & /* rhs */) const
+  {
+    return true;
   }
-  void setProtocol(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, boost::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    piprot_=iprot;
-    poprot_=oprot;
-    iprot_ = iprot.get();
-    oprot_ = oprot.get();
+  bool operator != (const Simulator_listScenarios_args &rhs) const {
+    return !(*this == rhs);
   }
+
+  bool operator < (const Simulator_listScenarios_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_listScenarios_pargs {
  public:
-  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
-    return piprot_;
-  }
-  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
-    return poprot_;
-  }
-  void reset();
-  void send_reset();
-  void recv_reset();
-  void calibrate();
-  void send_calibrate();
-  void recv_calibrate();
-  void enable();
-  void send_enable();
-  void recv_enable();
-  void enableMti();
-  void send_enableMti();
-  void recv_enableMti();
-  void enableNorm();
-  void send_enableNorm();
-  void recv_enableNorm();
-  void disable();
-  void send_disable();
-  void recv_disable();
-  void disableMti();
-  void send_disableMti();
-  void recv_disableMti();
-  void disableNorm();
-  void send_disableNorm();
-  void recv_disableNorm();
-  void loadMap(const int32_t arpPosition);
-  void send_loadMap(const int32_t arpPosition);
-  void recv_loadMap();
-  void getState(SimState& _return);
-  void send_getState();
-  void recv_getState(SimState& _return);
- protected:
-  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
-  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
-  ::apache::thrift::protocol::TProtocol* iprot_;
-  ::apache::thrift::protocol::TProtocol* oprot_;
+
+
+  virtual ~Simulator_listScenarios_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
 };
 
-class SimulatorProcessor : public ::apache::thrift::TDispatchProcessor {
- protected:
-  boost::shared_ptr<SimulatorIf> iface_;
-  virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
+typedef struct _Simulator_listScenarios_result__isset {
+  _Simulator_listScenarios_result__isset() : success(false) {}
+  bool success :1;
+} _Simulator_listScenarios_result__isset;
+
+class Simulator_listScenarios_result {
+ public:
+
+  Simulator_listScenarios_result(const Simulator_listScenarios_result&);
+  Simulator_listScenarios_result& operator=(const Simulator_listScenarios_result&);
+  Simulator_listScenarios_result() {
+  }
+
+  virtual ~Simulator_listScenarios_result() throw();
+  std::vector<ScenarioInfo>  success;
+
+  _Simulator_listScenarios_result__isset __isset;
+
+  void __set_success(const std::vector<ScenarioInfo> & val);
+
+  bool operator == (const Simulator_listScenarios_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_listScenarios_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_listScenarios_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_listScenarios_presult__isset {
+  _Simulator_listScenarios_presult__isset() : success(false) {}
+  bool success :1;
+} _Simulator_listScenarios_presult__isset;
+
+class Simulator_listScenarios_presult {
+ public:
+
+
+  virtual ~Simulator_listScenarios_presult() throw();
+  std::vector<ScenarioInfo> * success;
+
+  _Simulator_listScenarios_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_preloadScenario_args__isset {
+  _Simulator_preloadScenario_args__isset() : name(false) {}
+  bool name :1;
+} _Simulator_preloadScenario_args__isset;
+
+class Simulator_preloadScenario_args {
+ public:
+
+  Simulator_preloadScenario_args(const Simulator_preloadScenario_args&);
+  Simulator_preloadScenario_args& operator=(const Simulator_preloadScenario_args&);
+  Simulator_preloadScenario_args() : name() {
+  }
+
+  virtual ~Simulator_preloadScenario_args() throw();
+  std::string name;
+
+  _Simulator_preloadScenario_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  bool operator == (const Simulator_preloadScenario_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_preloadScenario_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_preloadScenario_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_preloadScenario_pargs {
+ public:
+
+
+  virtual ~Simulator_preloadScenario_pargs() throw();
+  const std::string* name;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_preloadScenario_result__isset {
+  _Simulator_preloadScenario_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_preloadScenario_result__isset;
+
+class Simulator_preloadScenario_result {
+ public:
+
+  Simulator_preloadScenario_result(const Simulator_preloadScenario_result&);
+  Simulator_preloadScenario_result& operator=(const Simulator_preloadScenario_result&);
+  Simulator_preloadScenario_result() {
+  }
+
+  virtual ~Simulator_preloadScenario_result() throw();
+  ScenarioException se;
+
+  _Simulator_preloadScenario_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_preloadScenario_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_preloadScenario_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_preloadScenario_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_preloadScenario_presult__isset {
+  _Simulator_preloadScenario_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_preloadScenario_presult__isset;
+
+class Simulator_preloadScenario_presult {
+ public:
+
+
+  virtual ~Simulator_preloadScenario_presult() throw();
+  ScenarioException se;
+
+  _Simulator_preloadScenario_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_activateScenario_args__isset {
+  _Simulator_activateScenario_args__isset() : name(false), arpPosition(false) {}
+  bool name :1;
+  bool arpPosition :1;
+} _Simulator_activateScenario_args__isset;
+
+class Simulator_activateScenario_args {
+ public:
+
+  Simulator_activateScenario_args(const Simulator_activateScenario_args&);
+  Simulator_activateScenario_args& operator=(const Simulator_activateScenario_args&);
+  Simulator_activateScenario_args() : name(), arpPosition(0) {
+  }
+
+  virtual ~Simulator_activateScenario_args() throw();
+  std::string name;
+  int32_t arpPosition;
+
+  _Simulator_activateScenario_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_arpPosition(const int32_t val);
+
+  bool operator == (const Simulator_activateScenario_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(arpPosition == rhs.arpPosition))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_activateScenario_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_activateScenario_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_activateScenario_pargs {
+ public:
+
+
+  virtual ~Simulator_activateScenario_pargs() throw();
+  const std::string* name;
+  const int32_t* arpPosition;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_activateScenario_result__isset {
+  _Simulator_activateScenario_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_activateScenario_result__isset;
+
+class Simulator_activateScenario_result {
+ public:
+
+  Simulator_activateScenario_result(const Simulator_activateScenario_result&);
+  Simulator_activateScenario_result& operator=(const Simulator_activateScenario_result&);
+  Simulator_activateScenario_result() {
+  }
+
+  virtual ~Simulator_activateScenario_result() throw();
+  ScenarioException se;
+
+  _Simulator_activateScenario_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_activateScenario_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_activateScenario_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_activateScenario_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_activateScenario_presult__isset {
+  _Simulator_activateScenario_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_activateScenario_presult__isset;
+
+class Simulator_activateScenario_presult {
+ public:
+
+
+  virtual ~Simulator_activateScenario_presult() throw();
+  ScenarioException se;
+
+  _Simulator_activateScenario_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_evictScenario_args__isset {
+  _Simulator_evictScenario_args__isset() : name(false) {}
+  bool name :1;
+} _Simulator_evictScenario_args__isset;
+
+class Simulator_evictScenario_args {
+ public:
+
+  Simulator_evictScenario_args(const Simulator_evictScenario_args&);
+  Simulator_evictScenario_args& operator=(const Simulator_evictScenario_args&);
+  Simulator_evictScenario_args() : name() {
+  }
+
+  virtual ~Simulator_evictScenario_args() throw();
+  std::string name;
+
+  _Simulator_evictScenario_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  bool operator == (const Simulator_evictScenario_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_evictScenario_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_evictScenario_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_evictScenario_pargs {
+ public:
+
+
+  virtual ~Simulator_evictScenario_pargs() throw();
+  const std::string* name;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_evictScenario_result {
+ public:
+
+  Simulator_evictScenario_result(const Simulator_evictScenario_result&);
+  Simulator_evictScenario_result& operator=(const Simulator_evictScenario_result&);
+  Simulator_evictScenario_result() {
+  }
+
+  virtual ~Simulator_evictScenario_result() throw();
+
+  bool operator == (const Simulator_evictScenario_result & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_evictScenario_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_evictScenario_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_evictScenario_presult {
+ public:
+
+
+  virtual ~Simulator_evictScenario_presult() throw();
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_beginUpload_args__isset {
+  _Simulator_beginUpload_args__isset() : name(false), subSystem(false), header(false), rotationHashes(false) {}
+  bool name :1;
+  bool subSystem :1;
+  bool header :1;
+  bool rotationHashes :1;
+} _Simulator_beginUpload_args__isset;
+
+class Simulator_beginUpload_args {
+ public:
+
+  Simulator_beginUpload_args(const Simulator_beginUpload_args&);
+  Simulator_beginUpload_args& operator=(const Simulator_beginUpload_args&);
+  Simulator_beginUpload_args() : name(), subSystem((SubSystem::type)0), header() {
+  }
+
+  virtual ~Simulator_beginUpload_args() throw();
+  std::string name;
+  SubSystem::type subSystem;
+  std::string header;
+  std::vector<int64_t>  rotationHashes;
+
+  _Simulator_beginUpload_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_subSystem(const SubSystem::type val);
+
+  void __set_header(const std::string& val);
+
+  void __set_rotationHashes(const std::vector<int64_t> & val);
+
+  bool operator == (const Simulator_beginUpload_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    if (!(header == rhs.header))
+      return false;
+    if (!(rotationHashes == rhs.rotationHashes))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_beginUpload_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_beginUpload_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_beginUpload_pargs {
+ public:
+
+
+  virtual ~Simulator_beginUpload_pargs() throw();
+  const std::string* name;
+  const SubSystem::type* subSystem;
+  const std::string* header;
+  const std::vector<int64_t> * rotationHashes;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_beginUpload_result__isset {
+  _Simulator_beginUpload_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _Simulator_beginUpload_result__isset;
+
+class Simulator_beginUpload_result {
+ public:
+
+  Simulator_beginUpload_result(const Simulator_beginUpload_result&);
+  Simulator_beginUpload_result& operator=(const Simulator_beginUpload_result&);
+  Simulator_beginUpload_result() {
+  }
+
+  virtual ~Simulator_beginUpload_result() throw();
+  std::vector<int32_t>  success;
+  ScenarioException se;
+
+  _Simulator_beginUpload_result__isset __isset;
+
+  void __set_success(const std::vector<int32_t> & val);
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_beginUpload_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_beginUpload_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_beginUpload_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_beginUpload_presult__isset {
+  _Simulator_beginUpload_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _Simulator_beginUpload_presult__isset;
+
+class Simulator_beginUpload_presult {
+ public:
+
+
+  virtual ~Simulator_beginUpload_presult() throw();
+  std::vector<int32_t> * success;
+  ScenarioException se;
+
+  _Simulator_beginUpload_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_uploadRotation_args__isset {
+  _Simulator_uploadRotation_args__isset() : name(false), subSystem(false), rotation(false), data(false) {}
+  bool name :1;
+  bool subSystem :1;
+  bool rotation :1;
+  bool data :1;
+} _Simulator_uploadRotation_args__isset;
+
+class Simulator_uploadRotation_args {
+ public:
+
+  Simulator_uploadRotation_args(const Simulator_uploadRotation_args&);
+  Simulator_uploadRotation_args& operator=(const Simulator_uploadRotation_args&);
+  Simulator_uploadRotation_args() : name(), subSystem((SubSystem::type)0), rotation(0), data() {
+  }
+
+  virtual ~Simulator_uploadRotation_args() throw();
+  std::string name;
+  SubSystem::type subSystem;
+  int32_t rotation;
+  std::string data;
+
+  _Simulator_uploadRotation_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_subSystem(const SubSystem::type val);
+
+  void __set_rotation(const int32_t val);
+
+  void __set_data(const std::string& val);
+
+  bool operator == (const Simulator_uploadRotation_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    if (!(rotation == rhs.rotation))
+      return false;
+    if (!(data == rhs.data))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_uploadRotation_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_uploadRotation_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_uploadRotation_pargs {
+ public:
+
+
+  virtual ~Simulator_uploadRotation_pargs() throw();
+  const std::string* name;
+  const SubSystem::type* subSystem;
+  const int32_t* rotation;
+  const std::string* data;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_uploadRotation_result__isset {
+  _Simulator_uploadRotation_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_uploadRotation_result__isset;
+
+class Simulator_uploadRotation_result {
+ public:
+
+  Simulator_uploadRotation_result(const Simulator_uploadRotation_result&);
+  Simulator_uploadRotation_result& operator=(const Simulator_uploadRotation_result&);
+  Simulator_uploadRotation_result() {
+  }
+
+  virtual ~Simulator_uploadRotation_result() throw();
+  ScenarioException se;
+
+  _Simulator_uploadRotation_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_uploadRotation_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_uploadRotation_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_uploadRotation_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_uploadRotation_presult__isset {
+  _Simulator_uploadRotation_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_uploadRotation_presult__isset;
+
+class Simulator_uploadRotation_presult {
+ public:
+
+
+  virtual ~Simulator_uploadRotation_presult() throw();
+  ScenarioException se;
+
+  _Simulator_uploadRotation_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_commitUpload_args__isset {
+  _Simulator_commitUpload_args__isset() : name(false), subSystem(false) {}
+  bool name :1;
+  bool subSystem :1;
+} _Simulator_commitUpload_args__isset;
+
+class Simulator_commitUpload_args {
+ public:
+
+  Simulator_commitUpload_args(const Simulator_commitUpload_args&);
+  Simulator_commitUpload_args& operator=(const Simulator_commitUpload_args&);
+  Simulator_commitUpload_args() : name(), subSystem((SubSystem::type)0) {
+  }
+
+  virtual ~Simulator_commitUpload_args() throw();
+  std::string name;
+  SubSystem::type subSystem;
+
+  _Simulator_commitUpload_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_subSystem(const SubSystem::type val);
+
+  bool operator == (const Simulator_commitUpload_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_commitUpload_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_commitUpload_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_commitUpload_pargs {
+ public:
+
+
+  virtual ~Simulator_commitUpload_pargs() throw();
+  const std::string* name;
+  const SubSystem::type* subSystem;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_commitUpload_result__isset {
+  _Simulator_commitUpload_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_commitUpload_result__isset;
+
+class Simulator_commitUpload_result {
+ public:
+
+  Simulator_commitUpload_result(const Simulator_commitUpload_result&);
+  Simulator_commitUpload_result& operator=(const Simulator_commitUpload_result&);
+  Simulator_commitUpload_result() {
+  }
+
+  virtual ~Simulator_commitUpload_result() throw();
+  ScenarioException se;
+
+  _Simulator_commitUpload_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_commitUpload_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_commitUpload_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_commitUpload_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_commitUpload_presult__isset {
+  _Simulator_commitUpload_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_commitUpload_presult__isset;
+
+class Simulator_commitUpload_presult {
+ public:
+
+
+  virtual ~Simulator_commitUpload_presult() throw();
+  ScenarioException se;
+
+  _Simulator_commitUpload_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_beginIngest_args__isset {
+  _Simulator_beginIngest_args__isset() : name(false), subSystem(false), fileByteSize(false), chunkByteSize(false) {}
+  bool name :1;
+  bool subSystem :1;
+  bool fileByteSize :1;
+  bool chunkByteSize :1;
+} _Simulator_beginIngest_args__isset;
+
+class Simulator_beginIngest_args {
+ public:
+
+  Simulator_beginIngest_args(const Simulator_beginIngest_args&);
+  Simulator_beginIngest_args& operator=(const Simulator_beginIngest_args&);
+  Simulator_beginIngest_args() : name(), subSystem((SubSystem::type)0), fileByteSize(0), chunkByteSize(0) {
+  }
+
+  virtual ~Simulator_beginIngest_args() throw();
+  std::string name;
+  SubSystem::type subSystem;
+  int64_t fileByteSize;
+  int32_t chunkByteSize;
+
+  _Simulator_beginIngest_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_subSystem(const SubSystem::type val);
+
+  void __set_fileByteSize(const int64_t val);
+
+  void __set_chunkByteSize(const int32_t val);
+
+  bool operator == (const Simulator_beginIngest_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    if (!(fileByteSize == rhs.fileByteSize))
+      return false;
+    if (!(chunkByteSize == rhs.chunkByteSize))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_beginIngest_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_beginIngest_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_beginIngest_pargs {
+ public:
+
+
+  virtual ~Simulator_beginIngest_pargs() throw();
+  const std::string* name;
+  const SubSystem::type* subSystem;
+  const int64_t* fileByteSize;
+  const int32_t* chunkByteSize;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_beginIngest_result__isset {
+  _Simulator_beginIngest_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _Simulator_beginIngest_result__isset;
+
+class Simulator_beginIngest_result {
+ public:
+
+  Simulator_beginIngest_result(const Simulator_beginIngest_result&);
+  Simulator_beginIngest_result& operator=(const Simulator_beginIngest_result&);
+  Simulator_beginIngest_result() {
+  }
+
+  virtual ~Simulator_beginIngest_result() throw();
+  IngestState success;
+  ScenarioException se;
+
+  _Simulator_beginIngest_result__isset __isset;
+
+  void __set_success(const IngestState& val);
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_beginIngest_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_beginIngest_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_beginIngest_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_beginIngest_presult__isset {
+  _Simulator_beginIngest_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _Simulator_beginIngest_presult__isset;
+
+class Simulator_beginIngest_presult {
+ public:
+
+
+  virtual ~Simulator_beginIngest_presult() throw();
+  IngestState* success;
+  ScenarioException se;
+
+  _Simulator_beginIngest_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_getIngestState_args__isset {
+  _Simulator_getIngestState_args__isset() : name(false), subSystem(false) {}
+  bool name :1;
+  bool subSystem :1;
+} _Simulator_getIngestState_args__isset;
+
+class Simulator_getIngestState_args {
+ public:
+
+  Simulator_getIngestState_args(const Simulator_getIngestState_args&);
+  Simulator_getIngestState_args& operator=(const Simulator_getIngestState_args&);
+  Simulator_getIngestState_args() : name(), subSystem((SubSystem::type)0) {
+  }
+
+  virtual ~Simulator_getIngestState_args() throw();
+  std::string name;
+  SubSystem::type subSystem;
+
+  _Simulator_getIngestState_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_subSystem(const SubSystem::type val);
+
+  bool operator == (const Simulator_getIngestState_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_getIngestState_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_getIngestState_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_getIngestState_pargs {
+ public:
+
+
+  virtual ~Simulator_getIngestState_pargs() throw();
+  const std::string* name;
+  const SubSystem::type* subSystem;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_getIngestState_result__isset {
+  _Simulator_getIngestState_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _Simulator_getIngestState_result__isset;
+
+class Simulator_getIngestState_result {
+ public:
+
+  Simulator_getIngestState_result(const Simulator_getIngestState_result&);
+  Simulator_getIngestState_result& operator=(const Simulator_getIngestState_result&);
+  Simulator_getIngestState_result() {
+  }
+
+  virtual ~Simulator_getIngestState_result() throw();
+  IngestState success;
+  ScenarioException se;
+
+  _Simulator_getIngestState_result__isset __isset;
+
+  void __set_success(const IngestState& val);
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_getIngestState_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_getIngestState_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_getIngestState_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_getIngestState_presult__isset {
+  _Simulator_getIngestState_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _Simulator_getIngestState_presult__isset;
+
+class Simulator_getIngestState_presult {
+ public:
+
+
+  virtual ~Simulator_getIngestState_presult() throw();
+  IngestState* success;
+  ScenarioException se;
+
+  _Simulator_getIngestState_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_addTarget_args__isset {
+  _Simulator_addTarget_args__isset() : target(false) {}
+  bool target :1;
+} _Simulator_addTarget_args__isset;
+
+class Simulator_addTarget_args {
+ public:
+
+  Simulator_addTarget_args(const Simulator_addTarget_args&);
+  Simulator_addTarget_args& operator=(const Simulator_addTarget_args&);
+  Simulator_addTarget_args() {
+  }
+
+  virtual ~Simulator_addTarget_args() throw();
+  LiveTarget target;
+
+  _Simulator_addTarget_args__isset __isset;
+
+  void __set_target(const LiveTarget& val);
+
+  bool operator == (const Simulator_addTarget_args & rhs) const
+  {
+    if (!(target == rhs.target))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_addTarget_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_addTarget_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_addTarget_pargs {
+ public:
+
+
+  virtual ~Simulator_addTarget_pargs() throw();
+  const LiveTarget* target;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_addTarget_result__isset {
+  _Simulator_addTarget_result__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_addTarget_result__isset;
+
+class Simulator_addTarget_result {
+ public:
+
+  Simulator_addTarget_result(const Simulator_addTarget_result&);
+  Simulator_addTarget_result& operator=(const Simulator_addTarget_result&);
+  Simulator_addTarget_result() {
+  }
+
+  virtual ~Simulator_addTarget_result() throw();
+  LiveTargetException lte;
+
+  _Simulator_addTarget_result__isset __isset;
+
+  void __set_lte(const LiveTargetException& val);
+
+  bool operator == (const Simulator_addTarget_result & rhs) const
+  {
+    if (!(lte == rhs.lte))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_addTarget_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_addTarget_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_addTarget_presult__isset {
+  _Simulator_addTarget_presult__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_addTarget_presult__isset;
+
+class Simulator_addTarget_presult {
+ public:
+
+
+  virtual ~Simulator_addTarget_presult() throw();
+  LiveTargetException lte;
+
+  _Simulator_addTarget_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_modifyTarget_args__isset {
+  _Simulator_modifyTarget_args__isset() : target(false) {}
+  bool target :1;
+} _Simulator_modifyTarget_args__isset;
+
+class Simulator_modifyTarget_args {
+ public:
+
+  Simulator_modifyTarget_args(const Simulator_modifyTarget_args&);
+  Simulator_modifyTarget_args& operator=(const Simulator_modifyTarget_args&);
+  Simulator_modifyTarget_args() {
+  }
+
+  virtual ~Simulator_modifyTarget_args() throw();
+  LiveTarget target;
+
+  _Simulator_modifyTarget_args__isset __isset;
+
+  void __set_target(const LiveTarget& val);
+
+  bool operator == (const Simulator_modifyTarget_args & rhs) const
+  {
+    if (!(target == rhs.target))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_modifyTarget_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_modifyTarget_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_modifyTarget_pargs {
+ public:
+
+
+  virtual ~Simulator_modifyTarget_pargs() throw();
+  const LiveTarget* target;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_modifyTarget_result__isset {
+  _Simulator_modifyTarget_result__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_modifyTarget_result__isset;
+
+class Simulator_modifyTarget_result {
+ public:
+
+  Simulator_modifyTarget_result(const Simulator_modifyTarget_result&);
+  Simulator_modifyTarget_result& operator=(const Simulator_modifyTarget_result&);
+  Simulator_modifyTarget_result() {
+  }
+
+  virtual ~Simulator_modifyTarget_result() throw();
+  LiveTargetException lte;
+
+  _Simulator_modifyTarget_result__isset __isset;
+
+  void __set_lte(const LiveTargetException& val);
+
+  bool operator == (const Simulator_modifyTarget_result & rhs) const
+  {
+    if (!(lte == rhs.lte))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_modifyTarget_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_modifyTarget_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_modifyTarget_presult__isset {
+  _Simulator_modifyTarget_presult__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_modifyTarget_presult__isset;
+
+class Simulator_modifyTarget_presult {
+ public:
+
+
+  virtual ~Simulator_modifyTarget_presult() throw();
+  LiveTargetException lte;
+
+  _Simulator_modifyTarget_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_removeTarget_args__isset {
+  _Simulator_removeTarget_args__isset() : name(false) {}
+  bool name :1;
+} _Simulator_removeTarget_args__isset;
+
+class Simulator_removeTarget_args {
+ public:
+
+  Simulator_removeTarget_args(const Simulator_removeTarget_args&);
+  Simulator_removeTarget_args& operator=(const Simulator_removeTarget_args&);
+  Simulator_removeTarget_args() : name() {
+  }
+
+  virtual ~Simulator_removeTarget_args() throw();
+  std::string name;
+
+  _Simulator_removeTarget_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  bool operator == (const Simulator_removeTarget_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_removeTarget_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_removeTarget_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_removeTarget_pargs {
+ public:
+
+
+  virtual ~Simulator_removeTarget_pargs() throw();
+  const std::string* name;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_removeTarget_result__isset {
+  _Simulator_removeTarget_result__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_removeTarget_result__isset;
+
+class Simulator_removeTarget_result {
+ public:
+
+  Simulator_removeTarget_result(const Simulator_removeTarget_result&);
+  Simulator_removeTarget_result& operator=(const Simulator_removeTarget_result&);
+  Simulator_removeTarget_result() {
+  }
+
+  virtual ~Simulator_removeTarget_result() throw();
+  LiveTargetException lte;
+
+  _Simulator_removeTarget_result__isset __isset;
+
+  void __set_lte(const LiveTargetException& val);
+
+  bool operator == (const Simulator_removeTarget_result & rhs) const
+  {
+    if (!(lte == rhs.lte))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_removeTarget_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_removeTarget_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_removeTarget_presult__isset {
+  _Simulator_removeTarget_presult__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_removeTarget_presult__isset;
+
+class Simulator_removeTarget_presult {
+ public:
+
+
+  virtual ~Simulator_removeTarget_presult() throw();
+  LiveTargetException lte;
+
+  _Simulator_removeTarget_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_setWeatherCells_args__isset {
+  _Simulator_setWeatherCells_args__isset() : cells(false) {}
+  bool cells :1;
+} _Simulator_setWeatherCells_args__isset;
+
+class Simulator_setWeatherCells_args {
+ public:
+
+  Simulator_setWeatherCells_args(const Simulator_setWeatherCells_args&);
+  Simulator_setWeatherCells_args& operator=(const Simulator_setWeatherCells_args&);
+  Simulator_setWeatherCells_args() {
+  }
+
+  virtual ~Simulator_setWeatherCells_args() throw();
+  std::vector<WeatherCell>  cells;
+
+  _Simulator_setWeatherCells_args__isset __isset;
+
+  void __set_cells(const std::vector<WeatherCell> & val);
+
+  bool operator == (const Simulator_setWeatherCells_args & rhs) const
+  {
+    if (!(cells == rhs.cells))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_setWeatherCells_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setWeatherCells_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setWeatherCells_pargs {
+ public:
+
+
+  virtual ~Simulator_setWeatherCells_pargs() throw();
+  const std::vector<WeatherCell> * cells;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_setWeatherCells_result__isset {
+  _Simulator_setWeatherCells_result__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_setWeatherCells_result__isset;
+
+class Simulator_setWeatherCells_result {
+ public:
+
+  Simulator_setWeatherCells_result(const Simulator_setWeatherCells_result&);
+  Simulator_setWeatherCells_result& operator=(const Simulator_setWeatherCells_result&);
+  Simulator_setWeatherCells_result() {
+  }
+
+  virtual ~Simulator_setWeatherCells_result() throw();
+  LiveTargetException lte;
+
+  _Simulator_setWeatherCells_result__isset __isset;
+
+  void __set_lte(const LiveTargetException& val);
+
+  bool operator == (const Simulator_setWeatherCells_result & rhs) const
+  {
+    if (!(lte == rhs.lte))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_setWeatherCells_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setWeatherCells_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_setWeatherCells_presult__isset {
+  _Simulator_setWeatherCells_presult__isset() : lte(false) {}
+  bool lte :1;
+} _Simulator_setWeatherCells_presult__isset;
+
+class Simulator_setWeatherCells_presult {
+ public:
+
+
+  virtual ~Simulator_setWeatherCells_presult() throw();
+  LiveTargetException lte;
+
+  _Simulator_setWeatherCells_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_setNoise_args__isset {
+  _Simulator_setNoise_args__isset() : seed(false), regions(false) {}
+  bool seed :1;
+  bool regions :1;
+} _Simulator_setNoise_args__isset;
+
+class Simulator_setNoise_args {
+ public:
+
+  Simulator_setNoise_args(const Simulator_setNoise_args&);
+  Simulator_setNoise_args& operator=(const Simulator_setNoise_args&);
+  Simulator_setNoise_args() : seed(0) {
+  }
+
+  virtual ~Simulator_setNoise_args() throw();
+  int64_t seed;
+  std::vector<NoiseRegion>  regions;
+
+  _Simulator_setNoise_args__isset __isset;
+
+  void __set_seed(const int64_t val);
+
+  void __set_regions(const std::vector<NoiseRegion> & val);
+
+  bool operator == (const Simulator_setNoise_args & rhs) const
+  {
+    if (!(seed == rhs.seed))
+      return false;
+    if (!(regions == rhs.regions))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_setNoise_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setNoise_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setNoise_pargs {
+ public:
+
+
+  virtual ~Simulator_setNoise_pargs() throw();
+  const int64_t* seed;
+  const std::vector<NoiseRegion> * regions;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setNoise_result {
+ public:
+
+  Simulator_setNoise_result(const Simulator_setNoise_result&);
+  Simulator_setNoise_result& operator=(const Simulator_setNoise_result&);
+  Simulator_setNoise_result() {
+  }
+
+  virtual ~Simulator_setNoise_result() throw();
+
+  bool operator == (const Simulator_setNoise_result & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_setNoise_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setNoise_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setNoise_presult {
+ public:
+
+
+  virtual ~Simulator_setNoise_presult() throw();
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_setSeaClutter_args__isset {
+  _Simulator_setSeaClutter_args__isset() : seaClutter(false) {}
+  bool seaClutter :1;
+} _Simulator_setSeaClutter_args__isset;
+
+class Simulator_setSeaClutter_args {
+ public:
+
+  Simulator_setSeaClutter_args(const Simulator_setSeaClutter_args&);
+  Simulator_setSeaClutter_args& operator=(const Simulator_setSeaClutter_args&);
+  Simulator_setSeaClutter_args() {
+  }
+
+  virtual ~Simulator_setSeaClutter_args() throw();
+  SeaClutter seaClutter;
+
+  _Simulator_setSeaClutter_args__isset __isset;
+
+  void __set_seaClutter(const SeaClutter& val);
+
+  bool operator == (const Simulator_setSeaClutter_args & rhs) const
+  {
+    if (!(seaClutter == rhs.seaClutter))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_setSeaClutter_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setSeaClutter_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setSeaClutter_pargs {
+ public:
+
+
+  virtual ~Simulator_setSeaClutter_pargs() throw();
+  const SeaClutter* seaClutter;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setSeaClutter_result {
+ public:
+
+  Simulator_setSeaClutter_result(const Simulator_setSeaClutter_result&);
+  Simulator_setSeaClutter_result& operator=(const Simulator_setSeaClutter_result&);
+  Simulator_setSeaClutter_result() {
+  }
+
+  virtual ~Simulator_setSeaClutter_result() throw();
+
+  bool operator == (const Simulator_setSeaClutter_result & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_setSeaClutter_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setSeaClutter_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setSeaClutter_presult {
+ public:
+
+
+  virtual ~Simulator_setSeaClutter_presult() throw();
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+
+class Simulator_listTargetLayers_args {
+ public:
+
+  Simulator_listTargetLayers_args(const Simulator_listTargetLayers_args&);
+  Simulator_listTargetLayers_args& operator=(const Simulator_listTargetLayers_args&);
+  Simulator_listTargetLayers_args() {
+  }
+
+  virtual ~Simulator_listTargetLayers_args() throw();
+
+  bool operator == (const Simulator_listTargetLayers_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_listTargetLayers_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_listTargetLayers_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_listTargetLayers_pargs {
+ public:
+
+
+  virtual ~Simulator_listTargetLayers_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_listTargetLayers_result__isset {
+  _Simulator_listTargetLayers_result__isset() : success(false) {}
+  bool success :1;
+} _Simulator_listTargetLayers_result__isset;
+
+class Simulator_listTargetLayers_result {
+ public:
+
+  Simulator_listTargetLayers_result(const Simulator_listTargetLayers_result&);
+  Simulator_listTargetLayers_result& operator=(const Simulator_listTargetLayers_result&);
+  Simulator_listTargetLayers_result() {
+  }
+
+  virtual ~Simulator_listTargetLayers_result() throw();
+  std::vector<TargetLayer>  success;
+
+  _Simulator_listTargetLayers_result__isset __isset;
+
+  void __set_success(const std::vector<TargetLayer> & val);
+
+  bool operator == (const Simulator_listTargetLayers_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_listTargetLayers_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_listTargetLayers_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_listTargetLayers_presult__isset {
+  _Simulator_listTargetLayers_presult__isset() : success(false) {}
+  bool success :1;
+} _Simulator_listTargetLayers_presult__isset;
+
+class Simulator_listTargetLayers_presult {
+ public:
+
+
+  virtual ~Simulator_listTargetLayers_presult() throw();
+  std::vector<TargetLayer> * success;
+
+  _Simulator_listTargetLayers_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_addTargetLayer_args__isset {
+  _Simulator_addTargetLayer_args__isset() : layer(false) {}
+  bool layer :1;
+} _Simulator_addTargetLayer_args__isset;
+
+class Simulator_addTargetLayer_args {
+ public:
+
+  Simulator_addTargetLayer_args(const Simulator_addTargetLayer_args&);
+  Simulator_addTargetLayer_args& operator=(const Simulator_addTargetLayer_args&);
+  Simulator_addTargetLayer_args() {
+  }
+
+  virtual ~Simulator_addTargetLayer_args() throw();
+  TargetLayer layer;
+
+  _Simulator_addTargetLayer_args__isset __isset;
+
+  void __set_layer(const TargetLayer& val);
+
+  bool operator == (const Simulator_addTargetLayer_args & rhs) const
+  {
+    if (!(layer == rhs.layer))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_addTargetLayer_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_addTargetLayer_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_addTargetLayer_pargs {
+ public:
+
+
+  virtual ~Simulator_addTargetLayer_pargs() throw();
+  const TargetLayer* layer;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_addTargetLayer_result__isset {
+  _Simulator_addTargetLayer_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_addTargetLayer_result__isset;
+
+class Simulator_addTargetLayer_result {
+ public:
+
+  Simulator_addTargetLayer_result(const Simulator_addTargetLayer_result&);
+  Simulator_addTargetLayer_result& operator=(const Simulator_addTargetLayer_result&);
+  Simulator_addTargetLayer_result() {
+  }
+
+  virtual ~Simulator_addTargetLayer_result() throw();
+  ScenarioException se;
+
+  _Simulator_addTargetLayer_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_addTargetLayer_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_addTargetLayer_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_addTargetLayer_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_addTargetLayer_presult__isset {
+  _Simulator_addTargetLayer_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_addTargetLayer_presult__isset;
+
+class Simulator_addTargetLayer_presult {
+ public:
+
+
+  virtual ~Simulator_addTargetLayer_presult() throw();
+  ScenarioException se;
+
+  _Simulator_addTargetLayer_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_enableTargetLayer_args__isset {
+  _Simulator_enableTargetLayer_args__isset() : scenario(false), enabled(false) {}
+  bool scenario :1;
+  bool enabled :1;
+} _Simulator_enableTargetLayer_args__isset;
+
+class Simulator_enableTargetLayer_args {
+ public:
+
+  Simulator_enableTargetLayer_args(const Simulator_enableTargetLayer_args&);
+  Simulator_enableTargetLayer_args& operator=(const Simulator_enableTargetLayer_args&);
+  Simulator_enableTargetLayer_args() : scenario(), enabled(0) {
+  }
+
+  virtual ~Simulator_enableTargetLayer_args() throw();
+  std::string scenario;
+  bool enabled;
+
+  _Simulator_enableTargetLayer_args__isset __isset;
+
+  void __set_scenario(const std::string& val);
+
+  void __set_enabled(const bool val);
+
+  bool operator == (const Simulator_enableTargetLayer_args & rhs) const
+  {
+    if (!(scenario == rhs.scenario))
+      return false;
+    if (!(enabled == rhs.enabled))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_enableTargetLayer_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_enableTargetLayer_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_enableTargetLayer_pargs {
+ public:
+
+
+  virtual ~Simulator_enableTargetLayer_pargs() throw();
+  const std::string* scenario;
+  const bool* enabled;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_enableTargetLayer_result__isset {
+  _Simulator_enableTargetLayer_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_enableTargetLayer_result__isset;
+
+class Simulator_enableTargetLayer_result {
+ public:
+
+  Simulator_enableTargetLayer_result(const Simulator_enableTargetLayer_result&);
+  Simulator_enableTargetLayer_result& operator=(const Simulator_enableTargetLayer_result&);
+  Simulator_enableTargetLayer_result() {
+  }
+
+  virtual ~Simulator_enableTargetLayer_result() throw();
+  ScenarioException se;
+
+  _Simulator_enableTargetLayer_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_enableTargetLayer_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_enableTargetLayer_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_enableTargetLayer_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_enableTargetLayer_presult__isset {
+  _Simulator_enableTargetLayer_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_enableTargetLayer_presult__isset;
+
+class Simulator_enableTargetLayer_presult {
+ public:
+
+
+  virtual ~Simulator_enableTargetLayer_presult() throw();
+  ScenarioException se;
+
+  _Simulator_enableTargetLayer_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_removeTargetLayer_args__isset {
+  _Simulator_removeTargetLayer_args__isset() : scenario(false) {}
+  bool scenario :1;
+} _Simulator_removeTargetLayer_args__isset;
+
+class Simulator_removeTargetLayer_args {
+ public:
+
+  Simulator_removeTargetLayer_args(const Simulator_removeTargetLayer_args&);
+  Simulator_removeTargetLayer_args& operator=(const Simulator_removeTargetLayer_args&);
+  Simulator_removeTargetLayer_args() : scenario() {
+  }
+
+  virtual ~Simulator_removeTargetLayer_args() throw();
+  std::string scenario;
+
+  _Simulator_removeTargetLayer_args__isset __isset;
+
+  void __set_scenario(const std::string& val);
+
+  bool operator == (const Simulator_removeTargetLayer_args & rhs) const
+  {
+    if (!(scenario == rhs.scenario))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_removeTargetLayer_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_removeTargetLayer_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_removeTargetLayer_pargs {
+ public:
+
+
+  virtual ~Simulator_removeTargetLayer_pargs() throw();
+  const std::string* scenario;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_removeTargetLayer_result__isset {
+  _Simulator_removeTargetLayer_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_removeTargetLayer_result__isset;
+
+class Simulator_removeTargetLayer_result {
+ public:
+
+  Simulator_removeTargetLayer_result(const Simulator_removeTargetLayer_result&);
+  Simulator_removeTargetLayer_result& operator=(const Simulator_removeTargetLayer_result&);
+  Simulator_removeTargetLayer_result() {
+  }
+
+  virtual ~Simulator_removeTargetLayer_result() throw();
+  ScenarioException se;
+
+  _Simulator_removeTargetLayer_result__isset __isset;
+
+  void __set_se(const ScenarioException& val);
+
+  bool operator == (const Simulator_removeTargetLayer_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_removeTargetLayer_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_removeTargetLayer_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_removeTargetLayer_presult__isset {
+  _Simulator_removeTargetLayer_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_removeTargetLayer_presult__isset;
+
+class Simulator_removeTargetLayer_presult {
+ public:
+
+
+  virtual ~Simulator_removeTargetLayer_presult() throw();
+  ScenarioException se;
+
+  _Simulator_removeTargetLayer_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_setBlanking_args__isset {
+  _Simulator_setBlanking_args__isset() : subSystem(false), sectors(false) {}
+  bool subSystem :1;
+  bool sectors :1;
+} _Simulator_setBlanking_args__isset;
+
+class Simulator_setBlanking_args {
+ public:
+
+  Simulator_setBlanking_args(const Simulator_setBlanking_args&);
+  Simulator_setBlanking_args& operator=(const Simulator_setBlanking_args&);
+  Simulator_setBlanking_args() : subSystem((SubSystem::type)0) {
+  }
+
+  virtual ~Simulator_setBlanking_args() throw();
+  SubSystem::type subSystem;
+  std::vector<BlankingSector>  sectors;
+
+  _Simulator_setBlanking_args__isset __isset;
+
+  void __set_subSystem(const SubSystem::type val);
+
+  void __set_sectors(const std::vector<BlankingSector> & val);
+
+  bool operator == (const Simulator_setBlanking_args & rhs) const
+  {
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    if (!(sectors == rhs.sectors))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_setBlanking_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setBlanking_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setBlanking_pargs {
+ public:
+
+
+  virtual ~Simulator_setBlanking_pargs() throw();
+  const SubSystem::type* subSystem;
+  const std::vector<BlankingSector> * sectors;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setBlanking_result {
+ public:
+
+  Simulator_setBlanking_result(const Simulator_setBlanking_result&);
+  Simulator_setBlanking_result& operator=(const Simulator_setBlanking_result&);
+  Simulator_setBlanking_result() {
+  }
+
+  virtual ~Simulator_setBlanking_result() throw();
+
+  bool operator == (const Simulator_setBlanking_result & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_setBlanking_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_setBlanking_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_setBlanking_presult {
+ public:
+
+
+  virtual ~Simulator_setBlanking_presult() throw();
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_scheduleCommands_args__isset {
+  _Simulator_scheduleCommands_args__isset() : commands(false) {}
+  bool commands :1;
+} _Simulator_scheduleCommands_args__isset;
+
+class Simulator_scheduleCommands_args {
+ public:
+
+  Simulator_scheduleCommands_args(const Simulator_scheduleCommands_args&);
+  Simulator_scheduleCommands_args& operator=(const Simulator_scheduleCommands_args&);
+  Simulator_scheduleCommands_args() {
+  }
+
+  virtual ~Simulator_scheduleCommands_args() throw();
+  std::vector<ScheduledCommand>  commands;
+
+  _Simulator_scheduleCommands_args__isset __isset;
+
+  void __set_commands(const std::vector<ScheduledCommand> & val);
+
+  bool operator == (const Simulator_scheduleCommands_args & rhs) const
+  {
+    if (!(commands == rhs.commands))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_scheduleCommands_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_scheduleCommands_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_scheduleCommands_pargs {
+ public:
+
+
+  virtual ~Simulator_scheduleCommands_pargs() throw();
+  const std::vector<ScheduledCommand> * commands;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_scheduleCommands_result__isset {
+  _Simulator_scheduleCommands_result__isset() : se(false) {}
+  bool se :1;
+} _Simulator_scheduleCommands_result__isset;
+
+class Simulator_scheduleCommands_result {
+ public:
+
+  Simulator_scheduleCommands_result(const Simulator_scheduleCommands_result&);
+  Simulator_scheduleCommands_result& operator=(const Simulator_scheduleCommands_result&);
+  Simulator_scheduleCommands_result() {
+  }
+
+  virtual ~Simulator_scheduleCommands_result() throw();
+  ScheduleException se;
+
+  _Simulator_scheduleCommands_result__isset __isset;
+
+  void __set_se(const ScheduleException& val);
+
+  bool operator == (const Simulator_scheduleCommands_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_scheduleCommands_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_scheduleCommands_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_scheduleCommands_presult__isset {
+  _Simulator_scheduleCommands_presult__isset() : se(false) {}
+  bool se :1;
+} _Simulator_scheduleCommands_presult__isset;
+
+class Simulator_scheduleCommands_presult {
+ public:
+
+
+  virtual ~Simulator_scheduleCommands_presult() throw();
+  ScheduleException se;
+
+  _Simulator_scheduleCommands_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+
+class Simulator_listScheduledCommands_args {
+ public:
+
+  Simulator_listScheduledCommands_args(const Simulator_listScheduledCommands_args&);
+  Simulator_listScheduledCommands_args& operator=(const Simulator_listScheduledCommands_args&);
+  Simulator_listScheduledCommands_args() {
+  }
+
+  virtual ~Simulator_listScheduledCommands_args() throw();
+
+  bool operator == (const Simulator_listScheduledCommands_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_listScheduledCommands_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_listScheduledCommands_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_listScheduledCommands_pargs {
+ public:
+
+
+  virtual ~Simulator_listScheduledCommands_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_listScheduledCommands_result__isset {
+  _Simulator_listScheduledCommands_result__isset() : success(false) {}
+  bool success :1;
+} _Simulator_listScheduledCommands_result__isset;
+
+class Simulator_listScheduledCommands_result {
+ public:
+
+  Simulator_listScheduledCommands_result(const Simulator_listScheduledCommands_result&);
+  Simulator_listScheduledCommands_result& operator=(const Simulator_listScheduledCommands_result&);
+  Simulator_listScheduledCommands_result() {
+  }
+
+  virtual ~Simulator_listScheduledCommands_result() throw();
+  std::vector<ScheduledCommand>  success;
+
+  _Simulator_listScheduledCommands_result__isset __isset;
+
+  void __set_success(const std::vector<ScheduledCommand> & val);
+
+  bool operator == (const Simulator_listScheduledCommands_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_listScheduledCommands_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_listScheduledCommands_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_listScheduledCommands_presult__isset {
+  _Simulator_listScheduledCommands_presult__isset() : success(false) {}
+  bool success :1;
+} _Simulator_listScheduledCommands_presult__isset;
+
+class Simulator_listScheduledCommands_presult {
+ public:
+
+
+  virtual ~Simulator_listScheduledCommands_presult() throw();
+  std::vector<ScheduledCommand> * success;
+
+  _Simulator_listScheduledCommands_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+
+class Simulator_clearSchedule_args {
+ public:
+
+  Simulator_clearSchedule_args(const Simulator_clearSchedule_args&);
+  Simulator_clearSchedule_args& operator=(const Simulator_clearSchedule_args&);
+  Simulator_clearSchedule_args() {
+  }
+
+  virtual ~Simulator_clearSchedule_args() throw();
+
+  bool operator == (const Simulator_clearSchedule_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_clearSchedule_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_clearSchedule_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_clearSchedule_pargs {
+ public:
+
+
+  virtual ~Simulator_clearSchedule_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_clearSchedule_result {
+ public:
+
+  Simulator_clearSchedule_result(const Simulator_clearSchedule_result&);
+  Simulator_clearSchedule_result& operator=(const Simulator_clearSchedule_result&);
+  Simulator_clearSchedule_result() {
+  }
+
+  virtual ~Simulator_clearSchedule_result() throw();
+
+  bool operator == (const Simulator_clearSchedule_result & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_clearSchedule_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_clearSchedule_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_clearSchedule_presult {
+ public:
+
+
+  virtual ~Simulator_clearSchedule_presult() throw();
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _Simulator_startCapture_args__isset {
+  _Simulator_startCapture_args__isset() : name(false), rowPayloads(false) {}
+  bool name :1;
+  bool rowPayloads :1;
+} _Simulator_startCapture_args__isset;
+
+class Simulator_startCapture_args {
+ public:
+
+  Simulator_startCapture_args(const Simulator_startCapture_args&);
+  Simulator_startCapture_args& operator=(const Simulator_startCapture_args&);
+  Simulator_startCapture_args() : name(), rowPayloads(0) {
+  }
+
+  virtual ~Simulator_startCapture_args() throw();
+  std::string name;
+  bool rowPayloads;
+
+  _Simulator_startCapture_args__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_rowPayloads(const bool val);
+
+  bool operator == (const Simulator_startCapture_args & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(rowPayloads == rhs.rowPayloads))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_startCapture_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_startCapture_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_startCapture_pargs {
+ public:
+
+
+  virtual ~Simulator_startCapture_pargs() throw();
+  const std::string* name;
+  const bool* rowPayloads;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_startCapture_result__isset {
+  _Simulator_startCapture_result__isset() : ce(false) {}
+  bool ce :1;
+} _Simulator_startCapture_result__isset;
+
+class Simulator_startCapture_result {
+ public:
+
+  Simulator_startCapture_result(const Simulator_startCapture_result&);
+  Simulator_startCapture_result& operator=(const Simulator_startCapture_result&);
+  Simulator_startCapture_result() {
+  }
+
+  virtual ~Simulator_startCapture_result() throw();
+  CaptureException ce;
+
+  _Simulator_startCapture_result__isset __isset;
+
+  void __set_ce(const CaptureException& val);
+
+  bool operator == (const Simulator_startCapture_result & rhs) const
+  {
+    if (!(ce == rhs.ce))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_startCapture_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_startCapture_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_startCapture_presult__isset {
+  _Simulator_startCapture_presult__isset() : ce(false) {}
+  bool ce :1;
+} _Simulator_startCapture_presult__isset;
+
+class Simulator_startCapture_presult {
+ public:
+
+
+  virtual ~Simulator_startCapture_presult() throw();
+  CaptureException ce;
+
+  _Simulator_startCapture_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+
+class Simulator_stopCapture_args {
+ public:
+
+  Simulator_stopCapture_args(const Simulator_stopCapture_args&);
+  Simulator_stopCapture_args& operator=(const Simulator_stopCapture_args&);
+  Simulator_stopCapture_args() {
+  }
+
+  virtual ~Simulator_stopCapture_args() throw();
+
+  bool operator == (const Simulator_stopCapture_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_stopCapture_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_stopCapture_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_stopCapture_pargs {
+ public:
+
+
+  virtual ~Simulator_stopCapture_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_stopCapture_result {
+ public:
+
+  Simulator_stopCapture_result(const Simulator_stopCapture_result&);
+  Simulator_stopCapture_result& operator=(const Simulator_stopCapture_result&);
+  Simulator_stopCapture_result() {
+  }
+
+  virtual ~Simulator_stopCapture_result() throw();
+
+  bool operator == (const Simulator_stopCapture_result & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_stopCapture_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_stopCapture_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_stopCapture_presult {
+ public:
+
+
+  virtual ~Simulator_stopCapture_presult() throw();
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+
+class Simulator_getDmaHealth_args {
+ public:
+
+  Simulator_getDmaHealth_args(const Simulator_getDmaHealth_args&);
+  Simulator_getDmaHealth_args& operator=(const Simulator_getDmaHealth_args&);
+  Simulator_getDmaHealth_args() {
+  }
+
+  virtual ~Simulator_getDmaHealth_args() throw();
+
+  bool operator == (const Simulator_getDmaHealth_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Simulator_getDmaHealth_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_getDmaHealth_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Simulator_getDmaHealth_pargs {
+ public:
+
+
+  virtual ~Simulator_getDmaHealth_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_getDmaHealth_result__isset {
+  _Simulator_getDmaHealth_result__isset() : success(false) {}
+  bool success :1;
+} _Simulator_getDmaHealth_result__isset;
+
+class Simulator_getDmaHealth_result {
+ public:
+
+  Simulator_getDmaHealth_result(const Simulator_getDmaHealth_result&);
+  Simulator_getDmaHealth_result& operator=(const Simulator_getDmaHealth_result&);
+  Simulator_getDmaHealth_result() {
+  }
+
+  virtual ~Simulator_getDmaHealth_result() throw();
+  std::vector<DmaHealth>  success;
+
+  _Simulator_getDmaHealth_result__isset __isset;
+
+  void __set_success(const std::vector<DmaHealth> & val);
+
+  bool operator == (const Simulator_getDmaHealth_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const Simulator_getDmaHealth_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Simulator_getDmaHealth_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Simulator_getDmaHealth_presult__isset {
+  _Simulator_getDmaHealth_presult__isset() : success(false) {}
+  bool success :1;
+} _Simulator_getDmaHealth_presult__isset;
+
+class Simulator_getDmaHealth_presult {
+ public:
+
+
+  virtual ~Simulator_getDmaHealth_presult() throw();
+  std::vector<DmaHealth> * success;
+
+  _Simulator_getDmaHealth_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+class SimulatorClient : virtual public SimulatorIf {
+ public:
+  SimulatorClient(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
+    setProtocol(prot);
+  }
+  SimulatorClient(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, boost::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
+    setProtocol(iprot,oprot);
+  }
+ private:
+  void setProtocol(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
+  setProtocol(prot,prot);
+  }
+  void setProtocol(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, boost::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
+    piprot_=iprot;
+    poprot_=oprot;
+    iprot_ = iprot.get();
+    oprot_ = oprot.get();
+  }
+ public:
+  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
+    return piprot_;
+  }
+  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
+    return poprot_;
+  }
+  void reset();
+  void send_reset();
+  void recv_reset();
+  void calibrate();
+  void send_calibrate();
+  void recv_calibrate();
+  void enable();
+  void send_enable();
+  void recv_enable();
+  void enableMti();
+  void send_enableMti();
+  void recv_enableMti();
+  void enableNorm();
+  void send_enableNorm();
+  void recv_enableNorm();
+  void disable();
+  void send_disable();
+  void recv_disable();
+  void disableMti();
+  void send_disableMti();
+  void recv_disableMti();
+  void disableNorm();
+  void send_disableNorm();
+  void recv_disableNorm();
+  void loadMap(const int32_t arpPosition, const int32_t acpOffset);
+  void send_loadMap(const int32_t arpPosition, const int32_t acpOffset);
+  void recv_loadMap();
+  void getState(SimState& _return);
+  void send_getState();
+  void recv_getState(SimState& _return);
+  void listScenarios(std::vector<ScenarioInfo> & _return);
+  void send_listScenarios();
+  void recv_listScenarios(std::vector<ScenarioInfo> & _return);
+  void preloadScenario(const std::string& name);
+  void send_preloadScenario(const std::string& name);
+  void recv_preloadScenario();
+  void activateScenario(const std::string& name, const int32_t arpPosition);
+  void send_activateScenario(const std::string& name, const int32_t arpPosition);
+  void recv_activateScenario();
+  void evictScenario(const std::string& name);
+  void send_evictScenario(const std::string& name);
+  void recv_evictScenario();
+  void beginUpload(std::vector<int32_t> & _return, const std::string& name, const SubSystem::type subSystem, const std::string& header, const std::vector<int64_t> & rotationHashes);
+  void send_beginUpload(const std::string& name, const SubSystem::type subSystem, const std::string& header, const std::vector<int64_t> & rotationHashes);
+  void recv_beginUpload(std::vector<int32_t> & _return);
+  void uploadRotation(const std::string& name, const SubSystem::type subSystem, const int32_t rotation, const std::string& data);
+  void send_uploadRotation(const std::string& name, const SubSystem::type subSystem, const int32_t rotation, const std::string& data);
+  void recv_uploadRotation();
+  void commitUpload(const std::string& name, const SubSystem::type subSystem);
+  void send_commitUpload(const std::string& name, const SubSystem::type subSystem);
+  void recv_commitUpload();
+  void beginIngest(IngestState& _return, const std::string& name, const SubSystem::type subSystem, const int64_t fileByteSize, const int32_t chunkByteSize);
+  void send_beginIngest(const std::string& name, const SubSystem::type subSystem, const int64_t fileByteSize, const int32_t chunkByteSize);
+  void recv_beginIngest(IngestState& _return);
+  void getIngestState(IngestState& _return, const std::string& name, const SubSystem::type subSystem);
+  void send_getIngestState(const std::string& name, const SubSystem::type subSystem);
+  void recv_getIngestState(IngestState& _return);
+  void addTarget(const LiveTarget& target);
+  void send_addTarget(const LiveTarget& target);
+  void recv_addTarget();
+  void modifyTarget(const LiveTarget& target);
+  void send_modifyTarget(const LiveTarget& target);
+  void recv_modifyTarget();
+  void removeTarget(const std::string& name);
+  void send_removeTarget(const std::string& name);
+  void recv_removeTarget();
+  void setWeatherCells(const std::vector<WeatherCell> & cells);
+  void send_setWeatherCells(const std::vector<WeatherCell> & cells);
+  void recv_setWeatherCells();
+  void setNoise(const int64_t seed, const std::vector<NoiseRegion> & regions);
+  void send_setNoise(const int64_t seed, const std::vector<NoiseRegion> & regions);
+  void recv_setNoise();
+  void setSeaClutter(const SeaClutter& seaClutter);
+  void send_setSeaClutter(const SeaClutter& seaClutter);
+  void recv_setSeaClutter();
+  void listTargetLayers(std::vector<TargetLayer> & _return);
+  void send_listTargetLayers();
+  void recv_listTargetLayers(std::vector<TargetLayer> & _return);
+  void addTargetLayer(const TargetLayer& layer);
+  void send_addTargetLayer(const TargetLayer& layer);
+  void recv_addTargetLayer();
+  void enableTargetLayer(const std::string& scenario, const bool enabled);
+  void send_enableTargetLayer(const std::string& scenario, const bool enabled);
+  void recv_enableTargetLayer();
+  void removeTargetLayer(const std::string& scenario);
+  void send_removeTargetLayer(const std::string& scenario);
+  void recv_removeTargetLayer();
+  void setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> & sectors);
+  void send_setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> & sectors);
+  void recv_setBlanking();
+  void scheduleCommands(const std::vector<ScheduledCommand> & commands);
+  void send_scheduleCommands(const std::vector<ScheduledCommand> & commands);
+  void recv_scheduleCommands();
+  void listScheduledCommands(std::vector<ScheduledCommand> & _return);
+  void send_listScheduledCommands();
+  void recv_listScheduledCommands(std::vector<ScheduledCommand> & _return);
+  void clearSchedule();
+  void send_clearSchedule();
+  void recv_clearSchedule();
+  void startCapture(const std::string& name, const bool rowPayloads);
+  void send_startCapture(const std::string& name, const bool rowPayloads);
+  void recv_startCapture();
+  void stopCapture();
+  void send_stopCapture();
+  void recv_stopCapture();
+  void getDmaHealth(std::vector<DmaHealth> & _return);
+  void send_getDmaHealth();
+  void recv_getDmaHealth(std::vector<DmaHealth> & _return);
+ protected:
+  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
+  boost::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
+  ::apache::thrift::protocol::TProtocol* iprot_;
+  ::apache::thrift::protocol::TProtocol* oprot_;
+};
+
+class SimulatorProcessor : public ::apache::thrift::TDispatchProcessor {
+ protected:
+  boost::shared_ptr<SimulatorIf> iface_;
+  virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
  private:
   typedef  void (SimulatorProcessor::*ProcessFunction)(int32_t, ::apache::thrift::protocol::TProtocol*, ::apache::thrift::protocol::TProtocol*, void*);
   typedef std::map<std::string, ProcessFunction> ProcessMap;
@@ -1038,6 +4087,32 @@ class SimulatorProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_disableNorm(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_loadMap(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_getState(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_listScenarios(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_preloadScenario(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_activateScenario(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_evictScenario(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_beginUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_uploadRotation(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_commitUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_beginIngest(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getIngestState(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_addTarget(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_modifyTarget(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_removeTarget(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_setWeatherCells(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_setNoise(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_setSeaClutter(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_listTargetLayers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_addTargetLayer(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_enableTargetLayer(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_removeTargetLayer(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_setBlanking(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_scheduleCommands(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_listScheduledCommands(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_clearSchedule(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_startCapture(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_stopCapture(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getDmaHealth(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   SimulatorProcessor(boost::shared_ptr<SimulatorIf> iface) :
     iface_(iface) {
@@ -1051,6 +4126,32 @@ class SimulatorProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["disableNorm"] = &SimulatorProcessor::process_disableNorm;
     processMap_["loadMap"] = &SimulatorProcessor::process_loadMap;
     processMap_["getState"] = &SimulatorProcessor::process_getState;
+    processMap_["listScenarios"] = &SimulatorProcessor::process_listScenarios;
+    processMap_["preloadScenario"] = &SimulatorProcessor::process_preloadScenario;
+    processMap_["activateScenario"] = &SimulatorProcessor::process_activateScenario;
+    processMap_["evictScenario"] = &SimulatorProcessor::process_evictScenario;
+    processMap_["beginUpload"] = &SimulatorProcessor::process_beginUpload;
+    processMap_["uploadRotation"] = &SimulatorProcessor::process_uploadRotation;
+    processMap_["commitUpload"] = &SimulatorProcessor::process_commitUpload;
+    processMap_["beginIngest"] = &SimulatorProcessor::process_beginIngest;
+    processMap_["getIngestState"] = &SimulatorProcessor::process_getIngestState;
+    processMap_["addTarget"] = &SimulatorProcessor::process_addTarget;
+    processMap_["modifyTarget"] = &SimulatorProcessor::process_modifyTarget;
+    processMap_["removeTarget"] = &SimulatorProcessor::process_removeTarget;
+    processMap_["setWeatherCells"] = &SimulatorProcessor::process_setWeatherCells;
+    processMap_["setNoise"] = &SimulatorProcessor::process_setNoise;
+    processMap_["setSeaClutter"] = &SimulatorProcessor::process_setSeaClutter;
+    processMap_["listTargetLayers"] = &SimulatorProcessor::process_listTargetLayers;
+    processMap_["addTargetLayer"] = &SimulatorProcessor::process_addTargetLayer;
+    processMap_["enableTargetLayer"] = &SimulatorProcessor::process_enableTargetLayer;
+    processMap_["removeTargetLayer"] = &SimulatorProcessor::process_removeTargetLayer;
+    processMap_["setBlanking"] = &SimulatorProcessor::process_setBlanking;
+    processMap_["scheduleCommands"] = &SimulatorProcessor::process_scheduleCommands;
+    processMap_["listScheduledCommands"] = &SimulatorProcessor::process_listScheduledCommands;
+    processMap_["clearSchedule"] = &SimulatorProcessor::process_clearSchedule;
+    processMap_["startCapture"] = &SimulatorProcessor::process_startCapture;
+    processMap_["stopCapture"] = &SimulatorProcessor::process_stopCapture;
+    processMap_["getDmaHealth"] = &SimulatorProcessor::process_getDmaHealth;
   }
 
   virtual ~SimulatorProcessor() {}
@@ -1151,13 +4252,13 @@ class SimulatorMultiface : virtual public SimulatorIf {
     ifaces_[i]->disableNorm();
   }
 
-  void loadMap(const int32_t arpPosition) {
+  void loadMap(const int32_t arpPosition, const int32_t acpOffset) {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
-      ifaces_[i]->loadMap(arpPosition);
+      ifaces_[i]->loadMap(arpPosition, acpOffset);
     }
-    ifaces_[i]->loadMap(arpPosition);
+    ifaces_[i]->loadMap(arpPosition, acpOffset);
   }
 
   void getState(SimState& _return) {
@@ -1170,6 +4271,247 @@ class SimulatorMultiface : virtual public SimulatorIf {
     return;
   }
 
+  void listScenarios(std::vector<ScenarioInfo> & _return) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->listScenarios(_return);
+    }
+    ifaces_[i]->listScenarios(_return);
+    return;
+  }
+
+  void preloadScenario(const std::string& name) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->preloadScenario(name);
+    }
+    ifaces_[i]->preloadScenario(name);
+  }
+
+  void activateScenario(const std::string& name, const int32_t arpPosition) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->activateScenario(name, arpPosition);
+    }
+    ifaces_[i]->activateScenario(name, arpPosition);
+  }
+
+  void evictScenario(const std::string& name) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->evictScenario(name);
+    }
+    ifaces_[i]->evictScenario(name);
+  }
+
+  void beginUpload(std::vector<int32_t> & _return, const std::string& name, const SubSystem::type subSystem, const std::string& header, const std::vector<int64_t> & rotationHashes) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->beginUpload(_return, name, subSystem, header, rotationHashes);
+    }
+    ifaces_[i]->beginUpload(_return, name, subSystem, header, rotationHashes);
+    return;
+  }
+
+  void uploadRotation(const std::string& name, const SubSystem::type subSystem, const int32_t rotation, const std::string& data) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->uploadRotation(name, subSystem, rotation, data);
+    }
+    ifaces_[i]->uploadRotation(name, subSystem, rotation, data);
+  }
+
+  void commitUpload(const std::string& name, const SubSystem::type subSystem) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->commitUpload(name, subSystem);
+    }
+    ifaces_[i]->commitUpload(name, subSystem);
+  }
+
+  void beginIngest(IngestState& _return, const std::string& name, const SubSystem::type subSystem, const int64_t fileByteSize, const int32_t chunkByteSize) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->beginIngest(_return, name, subSystem, fileByteSize, chunkByteSize);
+    }
+    ifaces_[i]->beginIngest(_return, name, subSystem, fileByteSize, chunkByteSize);
+    return;
+  }
+
+  void getIngestState(IngestState& _return, const std::string& name, const SubSystem::type subSystem) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getIngestState(_return, name, subSystem);
+    }
+    ifaces_[i]->getIngestState(_return, name, subSystem);
+    return;
+  }
+
+  void addTarget(const LiveTarget& target) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->addTarget(target);
+    }
+    ifaces_[i]->addTarget(target);
+  }
+
+  void modifyTarget(const LiveTarget& target) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->modifyTarget(target);
+    }
+    ifaces_[i]->modifyTarget(target);
+  }
+
+  void removeTarget(const std::string& name) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->removeTarget(name);
+    }
+    ifaces_[i]->removeTarget(name);
+  }
+
+  void setWeatherCells(const std::vector<WeatherCell> & cells) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->setWeatherCells(cells);
+    }
+    ifaces_[i]->setWeatherCells(cells);
+  }
+
+  void setNoise(const int64_t seed, const std::vector<NoiseRegion> & regions) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->setNoise(seed, regions);
+    }
+    ifaces_[i]->setNoise(seed, regions);
+  }
+
+  void setSeaClutter(const SeaClutter& seaClutter) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->setSeaClutter(seaClutter);
+    }
+    ifaces_[i]->setSeaClutter(seaClutter);
+  }
+
+  void listTargetLayers(std::vector<TargetLayer> & _return) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->listTargetLayers(_return);
+    }
+    ifaces_[i]->listTargetLayers(_return);
+    return;
+  }
+
+  void addTargetLayer(const TargetLayer& layer) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->addTargetLayer(layer);
+    }
+    ifaces_[i]->addTargetLayer(layer);
+  }
+
+  void enableTargetLayer(const std::string& scenario, const bool enabled) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->enableTargetLayer(scenario, enabled);
+    }
+    ifaces_[i]->enableTargetLayer(scenario, enabled);
+  }
+
+  void removeTargetLayer(const std::string& scenario) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->removeTargetLayer(scenario);
+    }
+    ifaces_[i]->removeTargetLayer(scenario);
+  }
+
+  void setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> & sectors) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->setBlanking(subSystem, sectors);
+    }
+    ifaces_[i]->setBlanking(subSystem, sectors);
+  }
+
+  void scheduleCommands(const std::vector<ScheduledCommand> & commands) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->scheduleCommands(commands);
+    }
+    ifaces_[i]->scheduleCommands(commands);
+  }
+
+  void listScheduledCommands(std::vector<ScheduledCommand> & _return) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->listScheduledCommands(_return);
+    }
+    ifaces_[i]->listScheduledCommands(_return);
+    return;
+  }
+
+  void clearSchedule() {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->clearSchedule();
+    }
+    ifaces_[i]->clearSchedule();
+  }
+
+  void startCapture(const std::string& name, const bool rowPayloads) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->startCapture(name, rowPayloads);
+    }
+    ifaces_[i]->startCapture(name, rowPayloads);
+  }
+
+  void stopCapture() {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->stopCapture();
+    }
+    ifaces_[i]->stopCapture();
+  }
+
+  void getDmaHealth(std::vector<DmaHealth> & _return) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getDmaHealth(_return);
+    }
+    ifaces_[i]->getDmaHealth(_return);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -1224,12 +4566,90 @@ class SimulatorConcurrentClient : virtual public SimulatorIf {
   void disableNorm();
   int32_t send_disableNorm();
   void recv_disableNorm(const int32_t seqid);
-  void loadMap(const int32_t arpPosition);
-  int32_t send_loadMap(const int32_t arpPosition);
+  void loadMap(const int32_t arpPosition, const int32_t acpOffset);
+  int32_t send_loadMap(const int32_t arpPosition, const int32_t acpOffset);
   void recv_loadMap(const int32_t seqid);
   void getState(SimState& _return);
   int32_t send_getState();
   void recv_getState(SimState& _return, const int32_t seqid);
+  void listScenarios(std::vector<ScenarioInfo> & _return);
+  int32_t send_listScenarios();
+  void recv_listScenarios(std::vector<ScenarioInfo> & _return, const int32_t seqid);
+  void preloadScenario(const std::string& name);
+  int32_t send_preloadScenario(const std::string& name);
+  void recv_preloadScenario(const int32_t seqid);
+  void activateScenario(const std::string& name, const int32_t arpPosition);
+  int32_t send_activateScenario(const std::string& name, const int32_t arpPosition);
+  void recv_activateScenario(const int32_t seqid);
+  void evictScenario(const std::string& name);
+  int32_t send_evictScenario(const std::string& name);
+  void recv_evictScenario(const int32_t seqid);
+  void beginUpload(std::vector<int32_t> & _return, const std::string& name, const SubSystem::type subSystem, const std::string& header, const std::vector<int64_t> & rotationHashes);
+  int32_t send_beginUpload(const std::string& name, const SubSystem::type subSystem, const std::string& header, const std::vector<int64_t> & rotationHashes);
+  void recv_beginUpload(std::vector<int32_t> & _return, const int32_t seqid);
+  void uploadRotation(const std::string& name, const SubSystem::type subSystem, const int32_t rotation, const std::string& data);
+  int32_t send_uploadRotation(const std::string& name, const SubSystem::type subSystem, const int32_t rotation, const std::string& data);
+  void recv_uploadRotation(const int32_t seqid);
+  void commitUpload(const std::string& name, const SubSystem::type subSystem);
+  int32_t send_commitUpload(const std::string& name, const SubSystem::type subSystem);
+  void recv_commitUpload(const int32_t seqid);
+  void beginIngest(IngestState& _return, const std::string& name, const SubSystem::type subSystem, const int64_t fileByteSize, const int32_t chunkByteSize);
+  int32_t send_beginIngest(const std::string& name, const SubSystem::type subSystem, const int64_t fileByteSize, const int32_t chunkByteSize);
+  void recv_beginIngest(IngestState& _return, const int32_t seqid);
+  void getIngestState(IngestState& _return, const std::string& name, const SubSystem::type subSystem);
+  int32_t send_getIngestState(const std::string& name, const SubSystem::type subSystem);
+  void recv_getIngestState(IngestState& _return, const int32_t seqid);
+  void addTarget(const LiveTarget& target);
+  int32_t send_addTarget(const LiveTarget& target);
+  void recv_addTarget(const int32_t seqid);
+  void modifyTarget(const LiveTarget& target);
+  int32_t send_modifyTarget(const LiveTarget& target);
+  void recv_modifyTarget(const int32_t seqid);
+  void removeTarget(const std::string& name);
+  int32_t send_removeTarget(const std::string& name);
+  void recv_removeTarget(const int32_t seqid);
+  void setWeatherCells(const std::vector<WeatherCell> & cells);
+  int32_t send_setWeatherCells(const std::vector<WeatherCell> & cells);
+  void recv_setWeatherCells(const int32_t seqid);
+  void setNoise(const int64_t seed, const std::vector<NoiseRegion> & regions);
+  int32_t send_setNoise(const int64_t seed, const std::vector<NoiseRegion> & regions);
+  void recv_setNoise(const int32_t seqid);
+  void setSeaClutter(const SeaClutter& seaClutter);
+  int32_t send_setSeaClutter(const SeaClutter& seaClutter);
+  void recv_setSeaClutter(const int32_t seqid);
+  void listTargetLayers(std::vector<TargetLayer> & _return);
+  int32_t send_listTargetLayers();
+  void recv_listTargetLayers(std::vector<TargetLayer> & _return, const int32_t seqid);
+  void addTargetLayer(const TargetLayer& layer);
+  int32_t send_addTargetLayer(const TargetLayer& layer);
+  void recv_addTargetLayer(const int32_t seqid);
+  void enableTargetLayer(const std::string& scenario, const bool enabled);
+  int32_t send_enableTargetLayer(const std::string& scenario, const bool enabled);
+  void recv_enableTargetLayer(const int32_t seqid);
+  void removeTargetLayer(const std::string& scenario);
+  int32_t send_removeTargetLayer(const std::string& scenario);
+  void recv_removeTargetLayer(const int32_t seqid);
+  void setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> & sectors);
+  int32_t send_setBlanking(const SubSystem::type subSystem, const std::vector<BlankingSector> & sectors);
+  void recv_setBlanking(const int32_t seqid);
+  void scheduleCommands(const std::vector<ScheduledCommand> & commands);
+  int32_t send_scheduleCommands(const std::vector<ScheduledCommand> & commands);
+  void recv_scheduleCommands(const int32_t seqid);
+  void listScheduledCommands(std::vector<ScheduledCommand> & _return);
+  int32_t send_listScheduledCommands();
+  void recv_listScheduledCommands(std::vector<ScheduledCommand> & _return, const int32_t seqid);
+  void clearSchedule();
+  int32_t send_clearSchedule();
+  void recv_clearSchedule(const int32_t seqid);
+  void startCapture(const std::string& name, const bool rowPayloads);
+  int32_t send_startCapture(const std::string& name, const bool rowPayloads);
+  void recv_startCapture(const int32_t seqid);
+  void stopCapture();
+  int32_t send_stopCapture();
+  void recv_stopCapture(const int32_t seqid);
+  void getDmaHealth(std::vector<DmaHealth> & _return);
+  int32_t send_getDmaHealth();
+  void recv_getDmaHealth(std::vector<DmaHealth> & _return, const int32_t seqid);
  protected:
   boost::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   boost::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -23,6 +23,30 @@ const char* _kSubSystemNames[] = {
 };
 const std::map<int, const char*> _SubSystem_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(2, _kSubSystemValues, _kSubSystemNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
 
+int _kCommandActionValues[] = {
+  CommandAction::ENABLE,
+  CommandAction::DISABLE,
+  CommandAction::ENABLE_MTI,
+  CommandAction::DISABLE_MTI,
+  CommandAction::ENABLE_NORM,
+  CommandAction::DISABLE_NORM,
+  CommandAction::SEEK,
+  CommandAction::ENABLE_TARGET_LAYER,
+  CommandAction::DISABLE_TARGET_LAYER
+};
+const char* _kCommandActionNames[] = {
+  "ENABLE",
+  "DISABLE",
+  "ENABLE_MTI",
+  "DISABLE_MTI",
+  "ENABLE_NORM",
+  "DISABLE_NORM",
+  "SEEK",
+  "ENABLE_TARGET_LAYER",
+  "DISABLE_TARGET_LAYER"
+};
+const std::map<int, const char*> _CommandAction_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(9, _kCommandActionValues, _kCommandActionNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+
 
 SimState::~SimState() throw() {
 }
@@ -84,6 +108,18 @@ void SimState::__set_loadedTargetAcp(const int32_t val) {
   this->loadedTargetAcp = val;
 }
 
+void SimState::__set_refillWakeupP99Us(const int32_t val) {
+  this->refillWakeupP99Us = val;
+}
+
+void SimState::__set_refillWakeupMaxUs(const int32_t val) {
+  this->refillWakeupMaxUs = val;
+}
+
+void SimState::__set_liveTargetLatencyMs(const int32_t val) {
+  this->liveTargetLatencyMs = val;
+}
+
 uint32_t SimState::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -217,6 +253,30 @@ uint32_t SimState::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 16:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->refillWakeupP99Us);
+          this->__isset.refillWakeupP99Us = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 17:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->refillWakeupMaxUs);
+          this->__isset.refillWakeupMaxUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 18:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->liveTargetLatencyMs);
+          this->__isset.liveTargetLatencyMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -290,6 +350,18 @@ uint32_t SimState::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeI32(this->loadedTargetAcp);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("refillWakeupP99Us", ::apache::thrift::protocol::T_I32, 16);
+  xfer += oprot->writeI32(this->refillWakeupP99Us);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("refillWakeupMaxUs", ::apache::thrift::protocol::T_I32, 17);
+  xfer += oprot->writeI32(this->refillWakeupMaxUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("liveTargetLatencyMs", ::apache::thrift::protocol::T_I32, 18);
+  xfer += oprot->writeI32(this->liveTargetLatencyMs);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -311,6 +383,9 @@ void swap(SimState &a, SimState &b) {
   swap(a.loadedTargetAcpIndex, b.loadedTargetAcpIndex);
   swap(a.loadedClutterAcp, b.loadedClutterAcp);
   swap(a.loadedTargetAcp, b.loadedTargetAcp);
+  swap(a.refillWakeupP99Us, b.refillWakeupP99Us);
+  swap(a.refillWakeupMaxUs, b.refillWakeupMaxUs);
+  swap(a.liveTargetLatencyMs, b.liveTargetLatencyMs);
   swap(a.__isset, b.__isset);
 }
 
@@ -329,6 +404,9 @@ SimState::SimState(const SimState& other0) {
   loadedTargetAcpIndex = other0.loadedTargetAcpIndex;
   loadedClutterAcp = other0.loadedClutterAcp;
   loadedTargetAcp = other0.loadedTargetAcp;
+  refillWakeupP99Us = other0.refillWakeupP99Us;
+  refillWakeupMaxUs = other0.refillWakeupMaxUs;
+  liveTargetLatencyMs = other0.liveTargetLatencyMs;
   __isset = other0.__isset;
 }
 SimState& SimState::operator=(const SimState& other1) {
@@ -346,6 +424,9 @@ SimState& SimState::operator=(const SimState& other1) {
   loadedTargetAcpIndex = other1.loadedTargetAcpIndex;
   loadedClutterAcp = other1.loadedClutterAcp;
   loadedTargetAcp = other1.loadedTargetAcp;
+  refillWakeupP99Us = other1.refillWakeupP99Us;
+  refillWakeupMaxUs = other1.refillWakeupMaxUs;
+  liveTargetLatencyMs = other1.liveTargetLatencyMs;
   __isset = other1.__isset;
   return *this;
 }
@@ -366,15 +447,42 @@ void SimState::printTo(std::ostream& out) const {
   out << ", " << "loadedTargetAcpIndex=" << to_string(loadedTargetAcpIndex);
   out << ", " << "loadedClutterAcp=" << to_string(loadedClutterAcp);
   out << ", " << "loadedTargetAcp=" << to_string(loadedTargetAcp);
+  out << ", " << "refillWakeupP99Us=" << to_string(refillWakeupP99Us);
+  out << ", " << "refillWakeupMaxUs=" << to_string(refillWakeupMaxUs);
+  out << ", " << "liveTargetLatencyMs=" << to_string(liveTargetLatencyMs);
   out << ")";
 }
 
 
-RadarSignalNotCalibratedException::~RadarSignalNotCalibratedException() throw() {
+ScenarioInfo::~ScenarioInfo() throw() {
 }
 
 
-uint32_t RadarSignalNotCalibratedException::read(::apache::thrift::protocol::TProtocol* iprot) {
+void ScenarioInfo::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void ScenarioInfo::__set_resident(const bool val) {
+  this->resident = val;
+}
+
+void ScenarioInfo::__set_active(const bool val) {
+  this->active = val;
+}
+
+void ScenarioInfo::__set_rotations(const int32_t val) {
+  this->rotations = val;
+}
+
+void ScenarioInfo::__set_fileByteSize(const int64_t val) {
+  this->fileByteSize = val;
+}
+
+void ScenarioInfo::__set_residentByteSize(const int64_t val) {
+  this->residentByteSize = val;
+}
+
+uint32_t ScenarioInfo::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -393,7 +501,60 @@ uint32_t RadarSignalNotCalibratedException::read(::apache::thrift::protocol::TPr
     if (ftype == ::apache::thrift::protocol::T_STOP) {
       break;
     }
-    xfer += iprot->skip(ftype);
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->resident);
+          this->__isset.resident = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->active);
+          this->__isset.active = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->rotations);
+          this->__isset.rotations = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->fileByteSize);
+          this->__isset.fileByteSize = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->residentByteSize);
+          this->__isset.residentByteSize = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
     xfer += iprot->readFieldEnd();
   }
 
@@ -402,56 +563,120 @@ uint32_t RadarSignalNotCalibratedException::read(::apache::thrift::protocol::TPr
   return xfer;
 }
 
-uint32_t RadarSignalNotCalibratedException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ScenarioInfo::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("RadarSignalNotCalibratedException");
+  xfer += oprot->writeStructBegin("ScenarioInfo");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("resident", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->resident);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("active", ::apache::thrift::protocol::T_BOOL, 3);
+  xfer += oprot->writeBool(this->active);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rotations", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->rotations);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("fileByteSize", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->fileByteSize);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("residentByteSize", ::apache::thrift::protocol::T_I64, 6);
+  xfer += oprot->writeI64(this->residentByteSize);
+  xfer += oprot->writeFieldEnd();
 
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-void swap(RadarSignalNotCalibratedException &a, RadarSignalNotCalibratedException &b) {
+void swap(ScenarioInfo &a, ScenarioInfo &b) {
   using ::std::swap;
-  (void) a;
-  (void) b;
+  swap(a.name, b.name);
+  swap(a.resident, b.resident);
+  swap(a.active, b.active);
+  swap(a.rotations, b.rotations);
+  swap(a.fileByteSize, b.fileByteSize);
+  swap(a.residentByteSize, b.residentByteSize);
+  swap(a.__isset, b.__isset);
 }
 
-RadarSignalNotCalibratedException::RadarSignalNotCalibratedException(const RadarSignalNotCalibratedException& other2) : TException() {
-  (void) other2;
+ScenarioInfo::ScenarioInfo(const ScenarioInfo& other2) {
+  name = other2.name;
+  resident = other2.resident;
+  active = other2.active;
+  rotations = other2.rotations;
+  fileByteSize = other2.fileByteSize;
+  residentByteSize = other2.residentByteSize;
+  __isset = other2.__isset;
 }
-RadarSignalNotCalibratedException& RadarSignalNotCalibratedException::operator=(const RadarSignalNotCalibratedException& other3) {
-  (void) other3;
+ScenarioInfo& ScenarioInfo::operator=(const ScenarioInfo& other3) {
+  name = other3.name;
+  resident = other3.resident;
+  active = other3.active;
+  rotations = other3.rotations;
+  fileByteSize = other3.fileByteSize;
+  residentByteSize = other3.residentByteSize;
+  __isset = other3.__isset;
   return *this;
 }
-void RadarSignalNotCalibratedException::printTo(std::ostream& out) const {
+void ScenarioInfo::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "RadarSignalNotCalibratedException(";
+  out << "ScenarioInfo(";
+  out << "name=" << to_string(name);
+  out << ", " << "resident=" << to_string(resident);
+  out << ", " << "active=" << to_string(active);
+  out << ", " << "rotations=" << to_string(rotations);
+  out << ", " << "fileByteSize=" << to_string(fileByteSize);
+  out << ", " << "residentByteSize=" << to_string(residentByteSize);
   out << ")";
 }
 
-const char* RadarSignalNotCalibratedException::what() const throw() {
-  try {
-    std::stringstream ss;
-    ss << "TException - service has thrown: " << *this;
-    this->thriftTExceptionMessageHolder_ = ss.str();
-    return this->thriftTExceptionMessageHolder_.c_str();
-  } catch (const std::exception&) {
-    return "TException - service has thrown: RadarSignalNotCalibratedException";
-  }
+
+IngestState::~IngestState() throw() {
 }
 
 
-IncompatibleFileException::~IncompatibleFileException() throw() {
+void IngestState::__set_name(const std::string& val) {
+  this->name = val;
 }
 
-
-void IncompatibleFileException::__set_subSystem(const SubSystem::type val) {
+void IngestState::__set_subSystem(const SubSystem::type val) {
   this->subSystem = val;
 }
 
-uint32_t IncompatibleFileException::read(::apache::thrift::protocol::TProtocol* iprot) {
+void IngestState::__set_fileByteSize(const int64_t val) {
+  this->fileByteSize = val;
+}
+
+void IngestState::__set_chunkByteSize(const int32_t val) {
+  this->chunkByteSize = val;
+}
+
+void IngestState::__set_receivedChunks(const int32_t val) {
+  this->receivedChunks = val;
+}
+
+void IngestState::__set_missingChunks(const std::vector<int32_t> & val) {
+  this->missingChunks = val;
+}
+
+void IngestState::__set_complete(const bool val) {
+  this->complete = val;
+}
+
+void IngestState::__set_port(const int32_t val) {
+  this->port = val;
+}
+
+uint32_t IngestState::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -473,6 +698,14 @@ uint32_t IncompatibleFileException::read(::apache::thrift::protocol::TProtocol*
     switch (fid)
     {
       case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
         if (ftype == ::apache::thrift::protocol::T_I32) {
           int32_t ecast4;
           xfer += iprot->readI32(ecast4);
@@ -482,6 +715,66 @@ uint32_t IncompatibleFileException::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->fileByteSize);
+          this->__isset.fileByteSize = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->chunkByteSize);
+          this->__isset.chunkByteSize = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->receivedChunks);
+          this->__isset.receivedChunks = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->missingChunks.clear();
+            uint32_t _size5;
+            ::apache::thrift::protocol::TType _etype8;
+            xfer += iprot->readListBegin(_etype8, _size5);
+            this->missingChunks.resize(_size5);
+            uint32_t _i9;
+            for (_i9 = 0; _i9 < _size5; ++_i9)
+            {
+              xfer += iprot->readI32(this->missingChunks[_i9]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.missingChunks = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->complete);
+          this->__isset.complete = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->port);
+          this->__isset.port = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -494,63 +787,124 @@ uint32_t IncompatibleFileException::read(::apache::thrift::protocol::TProtocol*
   return xfer;
 }
 
-uint32_t IncompatibleFileException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t IngestState::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("IncompatibleFileException");
+  xfer += oprot->writeStructBegin("IngestState");
 
-  xfer += oprot->writeFieldBegin("subSystem", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("subSystem", ::apache::thrift::protocol::T_I32, 2);
   xfer += oprot->writeI32((int32_t)this->subSystem);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("fileByteSize", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->fileByteSize);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("chunkByteSize", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->chunkByteSize);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("receivedChunks", ::apache::thrift::protocol::T_I32, 5);
+  xfer += oprot->writeI32(this->receivedChunks);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("missingChunks", ::apache::thrift::protocol::T_LIST, 6);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->missingChunks.size()));
+    std::vector<int32_t> ::const_iterator _iter10;
+    for (_iter10 = this->missingChunks.begin(); _iter10 != this->missingChunks.end(); ++_iter10)
+    {
+      xfer += oprot->writeI32((*_iter10));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("complete", ::apache::thrift::protocol::T_BOOL, 7);
+  xfer += oprot->writeBool(this->complete);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("port", ::apache::thrift::protocol::T_I32, 8);
+  xfer += oprot->writeI32(this->port);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-void swap(IncompatibleFileException &a, IncompatibleFileException &b) {
+void swap(IngestState &a, IngestState &b) {
   using ::std::swap;
+  swap(a.name, b.name);
   swap(a.subSystem, b.subSystem);
+  swap(a.fileByteSize, b.fileByteSize);
+  swap(a.chunkByteSize, b.chunkByteSize);
+  swap(a.receivedChunks, b.receivedChunks);
+  swap(a.missingChunks, b.missingChunks);
+  swap(a.complete, b.complete);
+  swap(a.port, b.port);
   swap(a.__isset, b.__isset);
 }
 
-IncompatibleFileException::IncompatibleFileException(const IncompatibleFileException& other5) : TException() {
-  subSystem = other5.subSystem;
-  __isset = other5.__isset;
+IngestState::IngestState(const IngestState& other11) {
+  name = other11.name;
+  subSystem = other11.subSystem;
+  fileByteSize = other11.fileByteSize;
+  chunkByteSize = other11.chunkByteSize;
+  receivedChunks = other11.receivedChunks;
+  missingChunks = other11.missingChunks;
+  complete = other11.complete;
+  port = other11.port;
+  __isset = other11.__isset;
 }
-IncompatibleFileException& IncompatibleFileException::operator=(const IncompatibleFileException& other6) {
-  subSystem = other6.subSystem;
-  __isset = other6.__isset;
+IngestState& IngestState::operator=(const IngestState& other12) {
+  name = other12.name;
+  subSystem = other12.subSystem;
+  fileByteSize = other12.fileByteSize;
+  chunkByteSize = other12.chunkByteSize;
+  receivedChunks = other12.receivedChunks;
+  missingChunks = other12.missingChunks;
+  complete = other12.complete;
+  port = other12.port;
+  __isset = other12.__isset;
   return *this;
 }
-void IncompatibleFileException::printTo(std::ostream& out) const {
+void IngestState::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "IncompatibleFileException(";
-  out << "subSystem=" << to_string(subSystem);
+  out << "IngestState(";
+  out << "name=" << to_string(name);
+  out << ", " << "subSystem=" << to_string(subSystem);
+  out << ", " << "fileByteSize=" << to_string(fileByteSize);
+  out << ", " << "chunkByteSize=" << to_string(chunkByteSize);
+  out << ", " << "receivedChunks=" << to_string(receivedChunks);
+  out << ", " << "missingChunks=" << to_string(missingChunks);
+  out << ", " << "complete=" << to_string(complete);
+  out << ", " << "port=" << to_string(port);
   out << ")";
 }
 
-const char* IncompatibleFileException::what() const throw() {
-  try {
-    std::stringstream ss;
-    ss << "TException - service has thrown: " << *this;
-    this->thriftTExceptionMessageHolder_ = ss.str();
-    return this->thriftTExceptionMessageHolder_.c_str();
-  } catch (const std::exception&) {
-    return "TException - service has thrown: IncompatibleFileException";
-  }
+
+LiveTargetLeg::~LiveTargetLeg() throw() {
 }
 
 
-DmaNotInitializedException::~DmaNotInitializedException() throw() {
+void LiveTargetLeg::__set_rKm(const double val) {
+  this->rKm = val;
 }
 
+void LiveTargetLeg::__set_azDeg(const double val) {
+  this->azDeg = val;
+}
 
-void DmaNotInitializedException::__set_subSystem(const SubSystem::type val) {
-  this->subSystem = val;
+void LiveTargetLeg::__set_speedKmh(const double val) {
+  this->speedKmh = val;
 }
 
-uint32_t DmaNotInitializedException::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t LiveTargetLeg::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -572,11 +926,25 @@ uint32_t DmaNotInitializedException::read(::apache::thrift::protocol::TProtocol*
     switch (fid)
     {
       case 1:
-        if (ftype == ::apache::thrift::protocol::T_I32) {
-          int32_t ecast7;
-          xfer += iprot->readI32(ecast7);
-          this->subSystem = (SubSystem::type)ecast7;
-          this->__isset.subSystem = true;
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->rKm);
+          this->__isset.rKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->azDeg);
+          this->__isset.azDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->speedKmh);
+          this->__isset.speedKmh = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -593,13 +961,21 @@ uint32_t DmaNotInitializedException::read(::apache::thrift::protocol::TProtocol*
   return xfer;
 }
 
-uint32_t DmaNotInitializedException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t LiveTargetLeg::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("DmaNotInitializedException");
+  xfer += oprot->writeStructBegin("LiveTargetLeg");
 
-  xfer += oprot->writeFieldBegin("subSystem", ::apache::thrift::protocol::T_I32, 1);
-  xfer += oprot->writeI32((int32_t)this->subSystem);
+  xfer += oprot->writeFieldBegin("rKm", ::apache::thrift::protocol::T_DOUBLE, 1);
+  xfer += oprot->writeDouble(this->rKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("azDeg", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->azDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("speedKmh", ::apache::thrift::protocol::T_DOUBLE, 3);
+  xfer += oprot->writeDouble(this->speedKmh);
   xfer += oprot->writeFieldEnd();
 
   xfer += oprot->writeFieldStop();
@@ -607,36 +983,2516 @@ uint32_t DmaNotInitializedException::write(::apache::thrift::protocol::TProtocol
   return xfer;
 }
 
-void swap(DmaNotInitializedException &a, DmaNotInitializedException &b) {
+void swap(LiveTargetLeg &a, LiveTargetLeg &b) {
   using ::std::swap;
-  swap(a.subSystem, b.subSystem);
+  swap(a.rKm, b.rKm);
+  swap(a.azDeg, b.azDeg);
+  swap(a.speedKmh, b.speedKmh);
   swap(a.__isset, b.__isset);
 }
 
-DmaNotInitializedException::DmaNotInitializedException(const DmaNotInitializedException& other8) : TException() {
-  subSystem = other8.subSystem;
-  __isset = other8.__isset;
+LiveTargetLeg::LiveTargetLeg(const LiveTargetLeg& other13) {
+  rKm = other13.rKm;
+  azDeg = other13.azDeg;
+  speedKmh = other13.speedKmh;
+  __isset = other13.__isset;
 }
-DmaNotInitializedException& DmaNotInitializedException::operator=(const DmaNotInitializedException& other9) {
-  subSystem = other9.subSystem;
-  __isset = other9.__isset;
+LiveTargetLeg& LiveTargetLeg::operator=(const LiveTargetLeg& other14) {
+  rKm = other14.rKm;
+  azDeg = other14.azDeg;
+  speedKmh = other14.speedKmh;
+  __isset = other14.__isset;
   return *this;
 }
-void DmaNotInitializedException::printTo(std::ostream& out) const {
+void LiveTargetLeg::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "DmaNotInitializedException(";
-  out << "subSystem=" << to_string(subSystem);
+  out << "LiveTargetLeg(";
+  out << "rKm=" << to_string(rKm);
+  out << ", " << "azDeg=" << to_string(azDeg);
+  out << ", " << "speedKmh=" << to_string(speedKmh);
   out << ")";
 }
 
-const char* DmaNotInitializedException::what() const throw() {
-  try {
-    std::stringstream ss;
-    ss << "TException - service has thrown: " << *this;
-    this->thriftTExceptionMessageHolder_ = ss.str();
-    return this->thriftTExceptionMessageHolder_.c_str();
-  } catch (const std::exception&) {
-    return "TException - service has thrown: DmaNotInitializedException";
+
+HitShape::~HitShape() throw() {
+}
+
+
+void HitShape::__set_acpSpread(const int32_t val) {
+  this->acpSpread = val;
+}
+
+void HitShape::__set_lengthUs(const int32_t val) {
+  this->lengthUs = val;
+}
+
+void HitShape::__set_minSignalUs(const int32_t val) {
+  this->minSignalUs = val;
+}
+
+void HitShape::__set_maxSignalUs(const int32_t val) {
+  this->maxSignalUs = val;
+}
+
+uint32_t HitShape::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->acpSpread);
+          this->__isset.acpSpread = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->lengthUs);
+          this->__isset.lengthUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->minSignalUs);
+          this->__isset.minSignalUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->maxSignalUs);
+          this->__isset.maxSignalUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t HitShape::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("HitShape");
+
+  xfer += oprot->writeFieldBegin("acpSpread", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->acpSpread);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("lengthUs", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->lengthUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("minSignalUs", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->minSignalUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("maxSignalUs", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->maxSignalUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(HitShape &a, HitShape &b) {
+  using ::std::swap;
+  swap(a.acpSpread, b.acpSpread);
+  swap(a.lengthUs, b.lengthUs);
+  swap(a.minSignalUs, b.minSignalUs);
+  swap(a.maxSignalUs, b.maxSignalUs);
+  swap(a.__isset, b.__isset);
+}
+
+HitShape::HitShape(const HitShape& other15) {
+  acpSpread = other15.acpSpread;
+  lengthUs = other15.lengthUs;
+  minSignalUs = other15.minSignalUs;
+  maxSignalUs = other15.maxSignalUs;
+  __isset = other15.__isset;
+}
+HitShape& HitShape::operator=(const HitShape& other16) {
+  acpSpread = other16.acpSpread;
+  lengthUs = other16.lengthUs;
+  minSignalUs = other16.minSignalUs;
+  maxSignalUs = other16.maxSignalUs;
+  __isset = other16.__isset;
+  return *this;
+}
+void HitShape::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "HitShape(";
+  out << "acpSpread=" << to_string(acpSpread);
+  out << ", " << "lengthUs=" << to_string(lengthUs);
+  out << ", " << "minSignalUs=" << to_string(minSignalUs);
+  out << ", " << "maxSignalUs=" << to_string(maxSignalUs);
+  out << ")";
+}
+
+
+LiveTarget::~LiveTarget() throw() {
+}
+
+
+void LiveTarget::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void LiveTarget::__set_rKm(const double val) {
+  this->rKm = val;
+}
+
+void LiveTarget::__set_azDeg(const double val) {
+  this->azDeg = val;
+}
+
+void LiveTarget::__set_legs(const std::vector<LiveTargetLeg> & val) {
+  this->legs = val;
+}
+
+void LiveTarget::__set_jammingSource(const bool val) {
+  this->jammingSource = val;
+}
+
+void LiveTarget::__set_synchroPulseDelayM(const double val) {
+  this->synchroPulseDelayM = val;
+}
+
+void LiveTarget::__set_hitShape(const HitShape& val) {
+  this->hitShape = val;
+}
+
+uint32_t LiveTarget::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->rKm);
+          this->__isset.rKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->azDeg);
+          this->__isset.azDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->legs.clear();
+            uint32_t _size17;
+            ::apache::thrift::protocol::TType _etype20;
+            xfer += iprot->readListBegin(_etype20, _size17);
+            this->legs.resize(_size17);
+            uint32_t _i21;
+            for (_i21 = 0; _i21 < _size17; ++_i21)
+            {
+              xfer += this->legs[_i21].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.legs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->jammingSource);
+          this->__isset.jammingSource = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->synchroPulseDelayM);
+          this->__isset.synchroPulseDelayM = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->hitShape.read(iprot);
+          this->__isset.hitShape = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t LiveTarget::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("LiveTarget");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rKm", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->rKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("azDeg", ::apache::thrift::protocol::T_DOUBLE, 3);
+  xfer += oprot->writeDouble(this->azDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("legs", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->legs.size()));
+    std::vector<LiveTargetLeg> ::const_iterator _iter22;
+    for (_iter22 = this->legs.begin(); _iter22 != this->legs.end(); ++_iter22)
+    {
+      xfer += (*_iter22).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("jammingSource", ::apache::thrift::protocol::T_BOOL, 5);
+  xfer += oprot->writeBool(this->jammingSource);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("synchroPulseDelayM", ::apache::thrift::protocol::T_DOUBLE, 6);
+  xfer += oprot->writeDouble(this->synchroPulseDelayM);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("hitShape", ::apache::thrift::protocol::T_STRUCT, 7);
+  xfer += this->hitShape.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(LiveTarget &a, LiveTarget &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.rKm, b.rKm);
+  swap(a.azDeg, b.azDeg);
+  swap(a.legs, b.legs);
+  swap(a.jammingSource, b.jammingSource);
+  swap(a.synchroPulseDelayM, b.synchroPulseDelayM);
+  swap(a.hitShape, b.hitShape);
+  swap(a.__isset, b.__isset);
+}
+
+LiveTarget::LiveTarget(const LiveTarget& other23) {
+  name = other23.name;
+  rKm = other23.rKm;
+  azDeg = other23.azDeg;
+  legs = other23.legs;
+  jammingSource = other23.jammingSource;
+  synchroPulseDelayM = other23.synchroPulseDelayM;
+  hitShape = other23.hitShape;
+  __isset = other23.__isset;
+}
+LiveTarget& LiveTarget::operator=(const LiveTarget& other24) {
+  name = other24.name;
+  rKm = other24.rKm;
+  azDeg = other24.azDeg;
+  legs = other24.legs;
+  jammingSource = other24.jammingSource;
+  synchroPulseDelayM = other24.synchroPulseDelayM;
+  hitShape = other24.hitShape;
+  __isset = other24.__isset;
+  return *this;
+}
+void LiveTarget::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "LiveTarget(";
+  out << "name=" << to_string(name);
+  out << ", " << "rKm=" << to_string(rKm);
+  out << ", " << "azDeg=" << to_string(azDeg);
+  out << ", " << "legs=" << to_string(legs);
+  out << ", " << "jammingSource=" << to_string(jammingSource);
+  out << ", " << "synchroPulseDelayM=" << to_string(synchroPulseDelayM);
+  out << ", " << "hitShape=" << to_string(hitShape);
+  out << ")";
+}
+
+
+MaskPoint::~MaskPoint() throw() {
+}
+
+
+void MaskPoint::__set_rKm(const double val) {
+  this->rKm = val;
+}
+
+void MaskPoint::__set_azDeg(const double val) {
+  this->azDeg = val;
+}
+
+uint32_t MaskPoint::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->rKm);
+          this->__isset.rKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->azDeg);
+          this->__isset.azDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t MaskPoint::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("MaskPoint");
+
+  xfer += oprot->writeFieldBegin("rKm", ::apache::thrift::protocol::T_DOUBLE, 1);
+  xfer += oprot->writeDouble(this->rKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("azDeg", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->azDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(MaskPoint &a, MaskPoint &b) {
+  using ::std::swap;
+  swap(a.rKm, b.rKm);
+  swap(a.azDeg, b.azDeg);
+  swap(a.__isset, b.__isset);
+}
+
+MaskPoint::MaskPoint(const MaskPoint& other25) {
+  rKm = other25.rKm;
+  azDeg = other25.azDeg;
+  __isset = other25.__isset;
+}
+MaskPoint& MaskPoint::operator=(const MaskPoint& other26) {
+  rKm = other26.rKm;
+  azDeg = other26.azDeg;
+  __isset = other26.__isset;
+  return *this;
+}
+void MaskPoint::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "MaskPoint(";
+  out << "rKm=" << to_string(rKm);
+  out << ", " << "azDeg=" << to_string(azDeg);
+  out << ")";
+}
+
+
+WeatherCell::~WeatherCell() throw() {
+}
+
+
+void WeatherCell::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void WeatherCell::__set_rKm(const double val) {
+  this->rKm = val;
+}
+
+void WeatherCell::__set_azDeg(const double val) {
+  this->azDeg = val;
+}
+
+void WeatherCell::__set_legs(const std::vector<LiveTargetLeg> & val) {
+  this->legs = val;
+}
+
+void WeatherCell::__set_mask(const std::vector<MaskPoint> & val) {
+  this->mask = val;
+}
+
+void WeatherCell::__set_hitShape(const HitShape& val) {
+  this->hitShape = val;
+}
+
+uint32_t WeatherCell::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->rKm);
+          this->__isset.rKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->azDeg);
+          this->__isset.azDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->legs.clear();
+            uint32_t _size27;
+            ::apache::thrift::protocol::TType _etype30;
+            xfer += iprot->readListBegin(_etype30, _size27);
+            this->legs.resize(_size27);
+            uint32_t _i31;
+            for (_i31 = 0; _i31 < _size27; ++_i31)
+            {
+              xfer += this->legs[_i31].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.legs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->mask.clear();
+            uint32_t _size32;
+            ::apache::thrift::protocol::TType _etype35;
+            xfer += iprot->readListBegin(_etype35, _size32);
+            this->mask.resize(_size32);
+            uint32_t _i36;
+            for (_i36 = 0; _i36 < _size32; ++_i36)
+            {
+              xfer += this->mask[_i36].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.mask = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->hitShape.read(iprot);
+          this->__isset.hitShape = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t WeatherCell::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("WeatherCell");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rKm", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->rKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("azDeg", ::apache::thrift::protocol::T_DOUBLE, 3);
+  xfer += oprot->writeDouble(this->azDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("legs", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->legs.size()));
+    std::vector<LiveTargetLeg> ::const_iterator _iter37;
+    for (_iter37 = this->legs.begin(); _iter37 != this->legs.end(); ++_iter37)
+    {
+      xfer += (*_iter37).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("mask", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->mask.size()));
+    std::vector<MaskPoint> ::const_iterator _iter38;
+    for (_iter38 = this->mask.begin(); _iter38 != this->mask.end(); ++_iter38)
+    {
+      xfer += (*_iter38).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("hitShape", ::apache::thrift::protocol::T_STRUCT, 6);
+  xfer += this->hitShape.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(WeatherCell &a, WeatherCell &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.rKm, b.rKm);
+  swap(a.azDeg, b.azDeg);
+  swap(a.legs, b.legs);
+  swap(a.mask, b.mask);
+  swap(a.hitShape, b.hitShape);
+  swap(a.__isset, b.__isset);
+}
+
+WeatherCell::WeatherCell(const WeatherCell& other39) {
+  name = other39.name;
+  rKm = other39.rKm;
+  azDeg = other39.azDeg;
+  legs = other39.legs;
+  mask = other39.mask;
+  hitShape = other39.hitShape;
+  __isset = other39.__isset;
+}
+WeatherCell& WeatherCell::operator=(const WeatherCell& other40) {
+  name = other40.name;
+  rKm = other40.rKm;
+  azDeg = other40.azDeg;
+  legs = other40.legs;
+  mask = other40.mask;
+  hitShape = other40.hitShape;
+  __isset = other40.__isset;
+  return *this;
+}
+void WeatherCell::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "WeatherCell(";
+  out << "name=" << to_string(name);
+  out << ", " << "rKm=" << to_string(rKm);
+  out << ", " << "azDeg=" << to_string(azDeg);
+  out << ", " << "legs=" << to_string(legs);
+  out << ", " << "mask=" << to_string(mask);
+  out << ", " << "hitShape=" << to_string(hitShape);
+  out << ")";
+}
+
+
+NoiseRegion::~NoiseRegion() throw() {
+}
+
+
+void NoiseRegion::__set_fromAzDeg(const double val) {
+  this->fromAzDeg = val;
+}
+
+void NoiseRegion::__set_toAzDeg(const double val) {
+  this->toAzDeg = val;
+}
+
+void NoiseRegion::__set_fromSignalUs(const int32_t val) {
+  this->fromSignalUs = val;
+}
+
+void NoiseRegion::__set_toSignalUs(const int32_t val) {
+  this->toSignalUs = val;
+}
+
+void NoiseRegion::__set_density(const double val) {
+  this->density = val;
+}
+
+uint32_t NoiseRegion::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->fromAzDeg);
+          this->__isset.fromAzDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->toAzDeg);
+          this->__isset.toAzDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->fromSignalUs);
+          this->__isset.fromSignalUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->toSignalUs);
+          this->__isset.toSignalUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->density);
+          this->__isset.density = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t NoiseRegion::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("NoiseRegion");
+
+  xfer += oprot->writeFieldBegin("fromAzDeg", ::apache::thrift::protocol::T_DOUBLE, 1);
+  xfer += oprot->writeDouble(this->fromAzDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("toAzDeg", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->toAzDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("fromSignalUs", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->fromSignalUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("toSignalUs", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->toSignalUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("density", ::apache::thrift::protocol::T_DOUBLE, 5);
+  xfer += oprot->writeDouble(this->density);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(NoiseRegion &a, NoiseRegion &b) {
+  using ::std::swap;
+  swap(a.fromAzDeg, b.fromAzDeg);
+  swap(a.toAzDeg, b.toAzDeg);
+  swap(a.fromSignalUs, b.fromSignalUs);
+  swap(a.toSignalUs, b.toSignalUs);
+  swap(a.density, b.density);
+  swap(a.__isset, b.__isset);
+}
+
+NoiseRegion::NoiseRegion(const NoiseRegion& other41) {
+  fromAzDeg = other41.fromAzDeg;
+  toAzDeg = other41.toAzDeg;
+  fromSignalUs = other41.fromSignalUs;
+  toSignalUs = other41.toSignalUs;
+  density = other41.density;
+  __isset = other41.__isset;
+}
+NoiseRegion& NoiseRegion::operator=(const NoiseRegion& other42) {
+  fromAzDeg = other42.fromAzDeg;
+  toAzDeg = other42.toAzDeg;
+  fromSignalUs = other42.fromSignalUs;
+  toSignalUs = other42.toSignalUs;
+  density = other42.density;
+  __isset = other42.__isset;
+  return *this;
+}
+void NoiseRegion::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "NoiseRegion(";
+  out << "fromAzDeg=" << to_string(fromAzDeg);
+  out << ", " << "toAzDeg=" << to_string(toAzDeg);
+  out << ", " << "fromSignalUs=" << to_string(fromSignalUs);
+  out << ", " << "toSignalUs=" << to_string(toSignalUs);
+  out << ", " << "density=" << to_string(density);
+  out << ")";
+}
+
+
+SeaClutter::~SeaClutter() throw() {
+}
+
+
+void SeaClutter::__set_seaState(const int32_t val) {
+  this->seaState = val;
+}
+
+void SeaClutter::__set_windFromDeg(const double val) {
+  this->windFromDeg = val;
+}
+
+void SeaClutter::__set_maxRangeKm(const double val) {
+  this->maxRangeKm = val;
+}
+
+void SeaClutter::__set_seed(const int64_t val) {
+  this->seed = val;
+}
+
+uint32_t SeaClutter::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->seaState);
+          this->__isset.seaState = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->windFromDeg);
+          this->__isset.windFromDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->maxRangeKm);
+          this->__isset.maxRangeKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->seed);
+          this->__isset.seed = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SeaClutter::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SeaClutter");
+
+  xfer += oprot->writeFieldBegin("seaState", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->seaState);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("windFromDeg", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->windFromDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("maxRangeKm", ::apache::thrift::protocol::T_DOUBLE, 3);
+  xfer += oprot->writeDouble(this->maxRangeKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("seed", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->seed);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(SeaClutter &a, SeaClutter &b) {
+  using ::std::swap;
+  swap(a.seaState, b.seaState);
+  swap(a.windFromDeg, b.windFromDeg);
+  swap(a.maxRangeKm, b.maxRangeKm);
+  swap(a.seed, b.seed);
+  swap(a.__isset, b.__isset);
+}
+
+SeaClutter::SeaClutter(const SeaClutter& other43) {
+  seaState = other43.seaState;
+  windFromDeg = other43.windFromDeg;
+  maxRangeKm = other43.maxRangeKm;
+  seed = other43.seed;
+  __isset = other43.__isset;
+}
+SeaClutter& SeaClutter::operator=(const SeaClutter& other44) {
+  seaState = other44.seaState;
+  windFromDeg = other44.windFromDeg;
+  maxRangeKm = other44.maxRangeKm;
+  seed = other44.seed;
+  __isset = other44.__isset;
+  return *this;
+}
+void SeaClutter::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "SeaClutter(";
+  out << "seaState=" << to_string(seaState);
+  out << ", " << "windFromDeg=" << to_string(windFromDeg);
+  out << ", " << "maxRangeKm=" << to_string(maxRangeKm);
+  out << ", " << "seed=" << to_string(seed);
+  out << ")";
+}
+
+
+TargetLayer::~TargetLayer() throw() {
+}
+
+
+void TargetLayer::__set_scenario(const std::string& val) {
+  this->scenario = val;
+}
+
+void TargetLayer::__set_startArp(const int32_t val) {
+  this->startArp = val;
+}
+
+void TargetLayer::__set_enabled(const bool val) {
+  this->enabled = val;
+}
+
+uint32_t TargetLayer::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->scenario);
+          this->__isset.scenario = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->startArp);
+          this->__isset.startArp = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->enabled);
+          this->__isset.enabled = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TargetLayer::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TargetLayer");
+
+  xfer += oprot->writeFieldBegin("scenario", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->scenario);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("startArp", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->startArp);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("enabled", ::apache::thrift::protocol::T_BOOL, 3);
+  xfer += oprot->writeBool(this->enabled);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(TargetLayer &a, TargetLayer &b) {
+  using ::std::swap;
+  swap(a.scenario, b.scenario);
+  swap(a.startArp, b.startArp);
+  swap(a.enabled, b.enabled);
+  swap(a.__isset, b.__isset);
+}
+
+TargetLayer::TargetLayer(const TargetLayer& other45) {
+  scenario = other45.scenario;
+  startArp = other45.startArp;
+  enabled = other45.enabled;
+  __isset = other45.__isset;
+}
+TargetLayer& TargetLayer::operator=(const TargetLayer& other46) {
+  scenario = other46.scenario;
+  startArp = other46.startArp;
+  enabled = other46.enabled;
+  __isset = other46.__isset;
+  return *this;
+}
+void TargetLayer::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "TargetLayer(";
+  out << "scenario=" << to_string(scenario);
+  out << ", " << "startArp=" << to_string(startArp);
+  out << ", " << "enabled=" << to_string(enabled);
+  out << ")";
+}
+
+
+BlankingSector::~BlankingSector() throw() {
+}
+
+
+void BlankingSector::__set_fromAzDeg(const double val) {
+  this->fromAzDeg = val;
+}
+
+void BlankingSector::__set_toAzDeg(const double val) {
+  this->toAzDeg = val;
+}
+
+void BlankingSector::__set_fromRangeKm(const double val) {
+  this->fromRangeKm = val;
+}
+
+void BlankingSector::__set_toRangeKm(const double val) {
+  this->toRangeKm = val;
+}
+
+uint32_t BlankingSector::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->fromAzDeg);
+          this->__isset.fromAzDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->toAzDeg);
+          this->__isset.toAzDeg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->fromRangeKm);
+          this->__isset.fromRangeKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->toRangeKm);
+          this->__isset.toRangeKm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t BlankingSector::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("BlankingSector");
+
+  xfer += oprot->writeFieldBegin("fromAzDeg", ::apache::thrift::protocol::T_DOUBLE, 1);
+  xfer += oprot->writeDouble(this->fromAzDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("toAzDeg", ::apache::thrift::protocol::T_DOUBLE, 2);
+  xfer += oprot->writeDouble(this->toAzDeg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("fromRangeKm", ::apache::thrift::protocol::T_DOUBLE, 3);
+  xfer += oprot->writeDouble(this->fromRangeKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("toRangeKm", ::apache::thrift::protocol::T_DOUBLE, 4);
+  xfer += oprot->writeDouble(this->toRangeKm);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(BlankingSector &a, BlankingSector &b) {
+  using ::std::swap;
+  swap(a.fromAzDeg, b.fromAzDeg);
+  swap(a.toAzDeg, b.toAzDeg);
+  swap(a.fromRangeKm, b.fromRangeKm);
+  swap(a.toRangeKm, b.toRangeKm);
+  swap(a.__isset, b.__isset);
+}
+
+BlankingSector::BlankingSector(const BlankingSector& other47) {
+  fromAzDeg = other47.fromAzDeg;
+  toAzDeg = other47.toAzDeg;
+  fromRangeKm = other47.fromRangeKm;
+  toRangeKm = other47.toRangeKm;
+  __isset = other47.__isset;
+}
+BlankingSector& BlankingSector::operator=(const BlankingSector& other48) {
+  fromAzDeg = other48.fromAzDeg;
+  toAzDeg = other48.toAzDeg;
+  fromRangeKm = other48.fromRangeKm;
+  toRangeKm = other48.toRangeKm;
+  __isset = other48.__isset;
+  return *this;
+}
+void BlankingSector::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "BlankingSector(";
+  out << "fromAzDeg=" << to_string(fromAzDeg);
+  out << ", " << "toAzDeg=" << to_string(toAzDeg);
+  out << ", " << "fromRangeKm=" << to_string(fromRangeKm);
+  out << ", " << "toRangeKm=" << to_string(toRangeKm);
+  out << ")";
+}
+
+
+ScheduledCommand::~ScheduledCommand() throw() {
+}
+
+
+void ScheduledCommand::__set_acpIdx(const int64_t val) {
+  this->acpIdx = val;
+}
+
+void ScheduledCommand::__set_action(const CommandAction::type val) {
+  this->action = val;
+}
+
+void ScheduledCommand::__set_arpPosition(const int32_t val) {
+  this->arpPosition = val;
+}
+
+void ScheduledCommand::__set_scenario(const std::string& val) {
+  this->scenario = val;
+}
+
+uint32_t ScheduledCommand::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->acpIdx);
+          this->__isset.acpIdx = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast49;
+          xfer += iprot->readI32(ecast49);
+          this->action = (CommandAction::type)ecast49;
+          this->__isset.action = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->arpPosition);
+          this->__isset.arpPosition = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->scenario);
+          this->__isset.scenario = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ScheduledCommand::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ScheduledCommand");
+
+  xfer += oprot->writeFieldBegin("acpIdx", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->acpIdx);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("action", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((int32_t)this->action);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("arpPosition", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->arpPosition);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("scenario", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString(this->scenario);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ScheduledCommand &a, ScheduledCommand &b) {
+  using ::std::swap;
+  swap(a.acpIdx, b.acpIdx);
+  swap(a.action, b.action);
+  swap(a.arpPosition, b.arpPosition);
+  swap(a.scenario, b.scenario);
+  swap(a.__isset, b.__isset);
+}
+
+ScheduledCommand::ScheduledCommand(const ScheduledCommand& other50) {
+  acpIdx = other50.acpIdx;
+  action = other50.action;
+  arpPosition = other50.arpPosition;
+  scenario = other50.scenario;
+  __isset = other50.__isset;
+}
+ScheduledCommand& ScheduledCommand::operator=(const ScheduledCommand& other51) {
+  acpIdx = other51.acpIdx;
+  action = other51.action;
+  arpPosition = other51.arpPosition;
+  scenario = other51.scenario;
+  __isset = other51.__isset;
+  return *this;
+}
+void ScheduledCommand::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ScheduledCommand(";
+  out << "acpIdx=" << to_string(acpIdx);
+  out << ", " << "action=" << to_string(action);
+  out << ", " << "arpPosition=" << to_string(arpPosition);
+  out << ", " << "scenario=" << to_string(scenario);
+  out << ")";
+}
+
+
+DmaHealth::~DmaHealth() throw() {
+}
+
+
+void DmaHealth::__set_subSystem(const SubSystem::type val) {
+  this->subSystem = val;
+}
+
+void DmaHealth::__set_running(const bool val) {
+  this->running = val;
+}
+
+void DmaHealth::__set_status(const int32_t val) {
+  this->status = val;
+}
+
+void DmaHealth::__set_halts(const int64_t val) {
+  this->halts = val;
+}
+
+void DmaHealth::__set_internalErrors(const int64_t val) {
+  this->internalErrors = val;
+}
+
+void DmaHealth::__set_slaveErrors(const int64_t val) {
+  this->slaveErrors = val;
+}
+
+void DmaHealth::__set_decodeErrors(const int64_t val) {
+  this->decodeErrors = val;
+}
+
+void DmaHealth::__set_sgErrors(const int64_t val) {
+  this->sgErrors = val;
+}
+
+void DmaHealth::__set_stalls(const int64_t val) {
+  this->stalls = val;
+}
+
+void DmaHealth::__set_recoveries(const int64_t val) {
+  this->recoveries = val;
+}
+
+void DmaHealth::__set_failedRecoveries(const int64_t val) {
+  this->failedRecoveries = val;
+}
+
+void DmaHealth::__set_lastRecoveryUs(const int32_t val) {
+  this->lastRecoveryUs = val;
+}
+
+uint32_t DmaHealth::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast52;
+          xfer += iprot->readI32(ecast52);
+          this->subSystem = (SubSystem::type)ecast52;
+          this->__isset.subSystem = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->running);
+          this->__isset.running = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->status);
+          this->__isset.status = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->halts);
+          this->__isset.halts = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->internalErrors);
+          this->__isset.internalErrors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->slaveErrors);
+          this->__isset.slaveErrors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->decodeErrors);
+          this->__isset.decodeErrors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->sgErrors);
+          this->__isset.sgErrors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->stalls);
+          this->__isset.stalls = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 10:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->recoveries);
+          this->__isset.recoveries = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 11:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->failedRecoveries);
+          this->__isset.failedRecoveries = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 12:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->lastRecoveryUs);
+          this->__isset.lastRecoveryUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DmaHealth::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("DmaHealth");
+
+  xfer += oprot->writeFieldBegin("subSystem", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)this->subSystem);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("running", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->running);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("status", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->status);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("halts", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->halts);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("internalErrors", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->internalErrors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("slaveErrors", ::apache::thrift::protocol::T_I64, 6);
+  xfer += oprot->writeI64(this->slaveErrors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("decodeErrors", ::apache::thrift::protocol::T_I64, 7);
+  xfer += oprot->writeI64(this->decodeErrors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sgErrors", ::apache::thrift::protocol::T_I64, 8);
+  xfer += oprot->writeI64(this->sgErrors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("stalls", ::apache::thrift::protocol::T_I64, 9);
+  xfer += oprot->writeI64(this->stalls);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("recoveries", ::apache::thrift::protocol::T_I64, 10);
+  xfer += oprot->writeI64(this->recoveries);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("failedRecoveries", ::apache::thrift::protocol::T_I64, 11);
+  xfer += oprot->writeI64(this->failedRecoveries);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("lastRecoveryUs", ::apache::thrift::protocol::T_I32, 12);
+  xfer += oprot->writeI32(this->lastRecoveryUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(DmaHealth &a, DmaHealth &b) {
+  using ::std::swap;
+  swap(a.subSystem, b.subSystem);
+  swap(a.running, b.running);
+  swap(a.status, b.status);
+  swap(a.halts, b.halts);
+  swap(a.internalErrors, b.internalErrors);
+  swap(a.slaveErrors, b.slaveErrors);
+  swap(a.decodeErrors, b.decodeErrors);
+  swap(a.sgErrors, b.sgErrors);
+  swap(a.stalls, b.stalls);
+  swap(a.recoveries, b.recoveries);
+  swap(a.failedRecoveries, b.failedRecoveries);
+  swap(a.lastRecoveryUs, b.lastRecoveryUs);
+  swap(a.__isset, b.__isset);
+}
+
+DmaHealth::DmaHealth(const DmaHealth& other53) {
+  subSystem = other53.subSystem;
+  running = other53.running;
+  status = other53.status;
+  halts = other53.halts;
+  internalErrors = other53.internalErrors;
+  slaveErrors = other53.slaveErrors;
+  decodeErrors = other53.decodeErrors;
+  sgErrors = other53.sgErrors;
+  stalls = other53.stalls;
+  recoveries = other53.recoveries;
+  failedRecoveries = other53.failedRecoveries;
+  lastRecoveryUs = other53.lastRecoveryUs;
+  __isset = other53.__isset;
+}
+DmaHealth& DmaHealth::operator=(const DmaHealth& other54) {
+  subSystem = other54.subSystem;
+  running = other54.running;
+  status = other54.status;
+  halts = other54.halts;
+  internalErrors = other54.internalErrors;
+  slaveErrors = other54.slaveErrors;
+  decodeErrors = other54.decodeErrors;
+  sgErrors = other54.sgErrors;
+  stalls = other54.stalls;
+  recoveries = other54.recoveries;
+  failedRecoveries = other54.failedRecoveries;
+  lastRecoveryUs = other54.lastRecoveryUs;
+  __isset = other54.__isset;
+  return *this;
+}
+void DmaHealth::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "DmaHealth(";
+  out << "subSystem=" << to_string(subSystem);
+  out << ", " << "running=" << to_string(running);
+  out << ", " << "status=" << to_string(status);
+  out << ", " << "halts=" << to_string(halts);
+  out << ", " << "internalErrors=" << to_string(internalErrors);
+  out << ", " << "slaveErrors=" << to_string(slaveErrors);
+  out << ", " << "decodeErrors=" << to_string(decodeErrors);
+  out << ", " << "sgErrors=" << to_string(sgErrors);
+  out << ", " << "stalls=" << to_string(stalls);
+  out << ", " << "recoveries=" << to_string(recoveries);
+  out << ", " << "failedRecoveries=" << to_string(failedRecoveries);
+  out << ", " << "lastRecoveryUs=" << to_string(lastRecoveryUs);
+  out << ")";
+}
+
+
+RadarSignalNotCalibratedException::~RadarSignalNotCalibratedException() throw() {
+}
+
+
+uint32_t RadarSignalNotCalibratedException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    xfer += iprot->skip(ftype);
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t RadarSignalNotCalibratedException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("RadarSignalNotCalibratedException");
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(RadarSignalNotCalibratedException &a, RadarSignalNotCalibratedException &b) {
+  using ::std::swap;
+  (void) a;
+  (void) b;
+}
+
+RadarSignalNotCalibratedException::RadarSignalNotCalibratedException(const RadarSignalNotCalibratedException& other55) : TException() {
+  (void) other55;
+}
+RadarSignalNotCalibratedException& RadarSignalNotCalibratedException::operator=(const RadarSignalNotCalibratedException& other56) {
+  (void) other56;
+  return *this;
+}
+void RadarSignalNotCalibratedException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "RadarSignalNotCalibratedException(";
+  out << ")";
+}
+
+const char* RadarSignalNotCalibratedException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: RadarSignalNotCalibratedException";
+  }
+}
+
+
+IncompatibleFileException::~IncompatibleFileException() throw() {
+}
+
+
+void IncompatibleFileException::__set_subSystem(const SubSystem::type val) {
+  this->subSystem = val;
+}
+
+uint32_t IncompatibleFileException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast57;
+          xfer += iprot->readI32(ecast57);
+          this->subSystem = (SubSystem::type)ecast57;
+          this->__isset.subSystem = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t IncompatibleFileException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("IncompatibleFileException");
+
+  xfer += oprot->writeFieldBegin("subSystem", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)this->subSystem);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(IncompatibleFileException &a, IncompatibleFileException &b) {
+  using ::std::swap;
+  swap(a.subSystem, b.subSystem);
+  swap(a.__isset, b.__isset);
+}
+
+IncompatibleFileException::IncompatibleFileException(const IncompatibleFileException& other58) : TException() {
+  subSystem = other58.subSystem;
+  __isset = other58.__isset;
+}
+IncompatibleFileException& IncompatibleFileException::operator=(const IncompatibleFileException& other59) {
+  subSystem = other59.subSystem;
+  __isset = other59.__isset;
+  return *this;
+}
+void IncompatibleFileException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "IncompatibleFileException(";
+  out << "subSystem=" << to_string(subSystem);
+  out << ")";
+}
+
+const char* IncompatibleFileException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: IncompatibleFileException";
+  }
+}
+
+
+DmaNotInitializedException::~DmaNotInitializedException() throw() {
+}
+
+
+void DmaNotInitializedException::__set_subSystem(const SubSystem::type val) {
+  this->subSystem = val;
+}
+
+uint32_t DmaNotInitializedException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast60;
+          xfer += iprot->readI32(ecast60);
+          this->subSystem = (SubSystem::type)ecast60;
+          this->__isset.subSystem = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DmaNotInitializedException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("DmaNotInitializedException");
+
+  xfer += oprot->writeFieldBegin("subSystem", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)this->subSystem);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(DmaNotInitializedException &a, DmaNotInitializedException &b) {
+  using ::std::swap;
+  swap(a.subSystem, b.subSystem);
+  swap(a.__isset, b.__isset);
+}
+
+DmaNotInitializedException::DmaNotInitializedException(const DmaNotInitializedException& other61) : TException() {
+  subSystem = other61.subSystem;
+  __isset = other61.__isset;
+}
+DmaNotInitializedException& DmaNotInitializedException::operator=(const DmaNotInitializedException& other62) {
+  subSystem = other62.subSystem;
+  __isset = other62.__isset;
+  return *this;
+}
+void DmaNotInitializedException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "DmaNotInitializedException(";
+  out << "subSystem=" << to_string(subSystem);
+  out << ")";
+}
+
+const char* DmaNotInitializedException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: DmaNotInitializedException";
+  }
+}
+
+
+ScenarioException::~ScenarioException() throw() {
+}
+
+
+void ScenarioException::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void ScenarioException::__set_reason(const std::string& val) {
+  this->reason = val;
+}
+
+uint32_t ScenarioException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->reason);
+          this->__isset.reason = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ScenarioException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ScenarioException");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("reason", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->reason);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ScenarioException &a, ScenarioException &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.reason, b.reason);
+  swap(a.__isset, b.__isset);
+}
+
+ScenarioException::ScenarioException(const ScenarioException& other63) : TException() {
+  name = other63.name;
+  reason = other63.reason;
+  __isset = other63.__isset;
+}
+ScenarioException& ScenarioException::operator=(const ScenarioException& other64) {
+  name = other64.name;
+  reason = other64.reason;
+  __isset = other64.__isset;
+  return *this;
+}
+void ScenarioException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ScenarioException(";
+  out << "name=" << to_string(name);
+  out << ", " << "reason=" << to_string(reason);
+  out << ")";
+}
+
+const char* ScenarioException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: ScenarioException";
+  }
+}
+
+
+LiveTargetException::~LiveTargetException() throw() {
+}
+
+
+void LiveTargetException::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void LiveTargetException::__set_reason(const std::string& val) {
+  this->reason = val;
+}
+
+uint32_t LiveTargetException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->reason);
+          this->__isset.reason = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t LiveTargetException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("LiveTargetException");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("reason", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->reason);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(LiveTargetException &a, LiveTargetException &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.reason, b.reason);
+  swap(a.__isset, b.__isset);
+}
+
+LiveTargetException::LiveTargetException(const LiveTargetException& other65) : TException() {
+  name = other65.name;
+  reason = other65.reason;
+  __isset = other65.__isset;
+}
+LiveTargetException& LiveTargetException::operator=(const LiveTargetException& other66) {
+  name = other66.name;
+  reason = other66.reason;
+  __isset = other66.__isset;
+  return *this;
+}
+void LiveTargetException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "LiveTargetException(";
+  out << "name=" << to_string(name);
+  out << ", " << "reason=" << to_string(reason);
+  out << ")";
+}
+
+const char* LiveTargetException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: LiveTargetException";
+  }
+}
+
+
+ScheduleException::~ScheduleException() throw() {
+}
+
+
+void ScheduleException::__set_acpIdx(const int64_t val) {
+  this->acpIdx = val;
+}
+
+void ScheduleException::__set_reason(const std::string& val) {
+  this->reason = val;
+}
+
+uint32_t ScheduleException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->acpIdx);
+          this->__isset.acpIdx = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->reason);
+          this->__isset.reason = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ScheduleException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ScheduleException");
+
+  xfer += oprot->writeFieldBegin("acpIdx", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->acpIdx);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("reason", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->reason);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ScheduleException &a, ScheduleException &b) {
+  using ::std::swap;
+  swap(a.acpIdx, b.acpIdx);
+  swap(a.reason, b.reason);
+  swap(a.__isset, b.__isset);
+}
+
+ScheduleException::ScheduleException(const ScheduleException& other67) : TException() {
+  acpIdx = other67.acpIdx;
+  reason = other67.reason;
+  __isset = other67.__isset;
+}
+ScheduleException& ScheduleException::operator=(const ScheduleException& other68) {
+  acpIdx = other68.acpIdx;
+  reason = other68.reason;
+  __isset = other68.__isset;
+  return *this;
+}
+void ScheduleException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ScheduleException(";
+  out << "acpIdx=" << to_string(acpIdx);
+  out << ", " << "reason=" << to_string(reason);
+  out << ")";
+}
+
+const char* ScheduleException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: ScheduleException";
+  }
+}
+
+
+CaptureException::~CaptureException() throw() {
+}
+
+
+void CaptureException::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void CaptureException::__set_reason(const std::string& val) {
+  this->reason = val;
+}
+
+uint32_t CaptureException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->reason);
+          this->__isset.reason = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t CaptureException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("CaptureException");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("reason", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->reason);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(CaptureException &a, CaptureException &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.reason, b.reason);
+  swap(a.__isset, b.__isset);
+}
+
+CaptureException::CaptureException(const CaptureException& other69) : TException() {
+  name = other69.name;
+  reason = other69.reason;
+  __isset = other69.__isset;
+}
+CaptureException& CaptureException::operator=(const CaptureException& other70) {
+  name = other70.name;
+  reason = other70.reason;
+  __isset = other70.__isset;
+  return *this;
+}
+void CaptureException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "CaptureException(";
+  out << "name=" << to_string(name);
+  out << ", " << "reason=" << to_string(reason);
+  out << ")";
+}
+
+const char* CaptureException::what() const throw() {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: CaptureException";
   }
 }
 
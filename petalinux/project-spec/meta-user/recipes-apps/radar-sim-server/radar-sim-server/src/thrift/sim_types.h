@@ -28,16 +28,66 @@ struct SubSystem {
 
 extern const std::map<int, const char*> _SubSystem_VALUES_TO_NAMES;
 
+struct CommandAction {
+  enum type {
+    ENABLE = 0,
+    DISABLE = 1,
+    ENABLE_MTI = 2,
+    DISABLE_MTI = 3,
+    ENABLE_NORM = 4,
+    DISABLE_NORM = 5,
+    SEEK = 6,
+    ENABLE_TARGET_LAYER = 7,
+    DISABLE_TARGET_LAYER = 8
+  };
+};
+
+extern const std::map<int, const char*> _CommandAction_VALUES_TO_NAMES;
+
 class SimState;
 
+class ScenarioInfo;
+
+class IngestState;
+
+class LiveTargetLeg;
+
+class HitShape;
+
+class LiveTarget;
+
+class MaskPoint;
+
+class WeatherCell;
+
+class NoiseRegion;
+
+class SeaClutter;
+
+class TargetLayer;
+
+class BlankingSector;
+
+class ScheduledCommand;
+
+class DmaHealth;
+
 class RadarSignalNotCalibratedException;
 
 class IncompatibleFileException;
 
 class DmaNotInitializedException;
 
+class ScenarioException;
+
+class LiveTargetException;
+
+class ScheduleException;
+
+class CaptureException;
+
 typedef struct _SimState__isset {
-  _SimState__isset() : time(false), enabled(false), mtiEnabled(false), normEnabled(false), calibrated(false), arpUs(false), acpCnt(false), trigUs(false), simAcpIdx(false), currAcpIdx(false), loadedClutterAcpIndex(false), loadedTargetAcpIndex(false), loadedClutterAcp(false), loadedTargetAcp(false) {}
+  _SimState__isset() : time(false), enabled(false), mtiEnabled(false), normEnabled(false), calibrated(false), arpUs(false), acpCnt(false), trigUs(false), simAcpIdx(false), currAcpIdx(false), loadedClutterAcpIndex(false), loadedTargetAcpIndex(false), loadedClutterAcp(false), loadedTargetAcp(false), refillWakeupP99Us(false), refillWakeupMaxUs(false), liveTargetLatencyMs(false) {}
   bool time :1;
   bool enabled :1;
   bool mtiEnabled :1;
@@ -52,6 +102,9 @@ typedef struct _SimState__isset {
   bool loadedTargetAcpIndex :1;
   bool loadedClutterAcp :1;
   bool loadedTargetAcp :1;
+  bool refillWakeupP99Us :1;
+  bool refillWakeupMaxUs :1;
+  bool liveTargetLatencyMs :1;
 } _SimState__isset;
 
 class SimState {
@@ -59,7 +112,7 @@ class SimState {
 
   SimState(const SimState&);
   SimState& operator=(const SimState&);
-  SimState() : time(0), enabled(0), mtiEnabled(0), normEnabled(0), calibrated(0), arpUs(0), acpCnt(0), trigUs(0), simAcpIdx(0), currAcpIdx(0), loadedClutterAcpIndex(0), loadedTargetAcpIndex(0), loadedClutterAcp(0), loadedTargetAcp(0) {
+  SimState() : time(0), enabled(0), mtiEnabled(0), normEnabled(0), calibrated(0), arpUs(0), acpCnt(0), trigUs(0), simAcpIdx(0), currAcpIdx(0), loadedClutterAcpIndex(0), loadedTargetAcpIndex(0), loadedClutterAcp(0), loadedTargetAcp(0), refillWakeupP99Us(0), refillWakeupMaxUs(0), liveTargetLatencyMs(0) {
   }
 
   virtual ~SimState() throw();
@@ -77,6 +130,9 @@ class SimState {
   int32_t loadedTargetAcpIndex;
   int32_t loadedClutterAcp;
   int32_t loadedTargetAcp;
+  int32_t refillWakeupP99Us;
+  int32_t refillWakeupMaxUs;
+  int32_t liveTargetLatencyMs;
 
   _SimState__isset __isset;
 
@@ -108,6 +164,12 @@ class SimState {
 
   void __set_loadedTargetAcp(const int32_t val);
 
+  void __set_refillWakeupP99Us(const int32_t val);
+
+  void __set_refillWakeupMaxUs(const int32_t val);
+
+  void __set_liveTargetLatencyMs(const int32_t val);
+
   bool operator == (const SimState & rhs) const
   {
     if (!(time == rhs.time))
@@ -138,6 +200,12 @@ class SimState {
       return false;
     if (!(loadedTargetAcp == rhs.loadedTargetAcp))
       return false;
+    if (!(refillWakeupP99Us == rhs.refillWakeupP99Us))
+      return false;
+    if (!(refillWakeupMaxUs == rhs.refillWakeupMaxUs))
+      return false;
+    if (!(liveTargetLatencyMs == rhs.liveTargetLatencyMs))
+      return false;
     return true;
   }
   bool operator != (const SimState &rhs) const {
@@ -160,134 +228,1278 @@ inline std::ostream& operator<<(std::ostream& out, const SimState& obj)
   return out;
 }
 
-
-class RadarSignalNotCalibratedException : public ::apache::thrift::TException {
+typedef struct _ScenarioInfo__isset {
+  _ScenarioInfo__isset() : name(false), resident(false), active(false), rotations(false), fileByteSize(false), residentByteSize(false) {}
+  bool name :1;
+  bool resident :1;
+  bool active :1;
+  bool rotations :1;
+  bool fileByteSize :1;
+  bool residentByteSize :1;
+} _ScenarioInfo__isset;
+
+class ScenarioInfo {
  public:
 
-  RadarSignalNotCalibratedException(const RadarSignalNotCalibratedException&);
-  RadarSignalNotCalibratedException& operator=(const RadarSignalNotCalibratedException&);
-  RadarSignalNotCalibratedException() {
+  ScenarioInfo(const ScenarioInfo&);
+  ScenarioInfo& operator=(const ScenarioInfo&);
+  ScenarioInfo() : name(), resident(0), active(0), rotations(0), fileByteSize(0), residentByteSize(0) {
   }
 
-  virtual ~RadarSignalNotCalibratedException() throw();
+  virtual ~ScenarioInfo() throw();
+  std::string name;
+  bool resident;
+  bool active;
+  int32_t rotations;
+  int64_t fileByteSize;
+  int64_t residentByteSize;
 
-  bool operator == (const RadarSignalNotCalibratedException & /* rhs */) const
+  _ScenarioInfo__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_resident(const bool val);
+
+  void __set_active(const bool val);
+
+  void __set_rotations(const int32_t val);
+
+  void __set_fileByteSize(const int64_t val);
+
+  void __set_residentByteSize(const int64_t val);
+
+  bool operator == (const ScenarioInfo & rhs) const
   {
+    if (!(name == rhs.name))
+      return false;
+    if (!(resident == rhs.resident))
+      return false;
+    if (!(active == rhs.active))
+      return false;
+    if (!(rotations == rhs.rotations))
+      return false;
+    if (!(fileByteSize == rhs.fileByteSize))
+      return false;
+    if (!(residentByteSize == rhs.residentByteSize))
+      return false;
     return true;
   }
-  bool operator != (const RadarSignalNotCalibratedException &rhs) const {
+  bool operator != (const ScenarioInfo &rhs) const {
     return !(*this == rhs);
   }
 
-  bool operator < (const RadarSignalNotCalibratedException & ) const;
+  bool operator < (const ScenarioInfo & ) const;
 
   uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
-  mutable std::string thriftTExceptionMessageHolder_;
-  const char* what() const throw();
 };
 
-void swap(RadarSignalNotCalibratedException &a, RadarSignalNotCalibratedException &b);
+void swap(ScenarioInfo &a, ScenarioInfo &b);
 
-inline std::ostream& operator<<(std::ostream& out, const RadarSignalNotCalibratedException& obj)
+inline std::ostream& operator<<(std::ostream& out, const ScenarioInfo& obj)
 {
   obj.printTo(out);
   return out;
 }
 
-typedef struct _IncompatibleFileException__isset {
-  _IncompatibleFileException__isset() : subSystem(false) {}
+typedef struct _IngestState__isset {
+  _IngestState__isset() : name(false), subSystem(false), fileByteSize(false), chunkByteSize(false), receivedChunks(false), missingChunks(false), complete(false), port(false) {}
+  bool name :1;
   bool subSystem :1;
-} _IncompatibleFileException__isset;
-
-class IncompatibleFileException : public ::apache::thrift::TException {
+  bool fileByteSize :1;
+  bool chunkByteSize :1;
+  bool receivedChunks :1;
+  bool missingChunks :1;
+  bool complete :1;
+  bool port :1;
+} _IngestState__isset;
+
+class IngestState {
  public:
 
-  IncompatibleFileException(const IncompatibleFileException&);
-  IncompatibleFileException& operator=(const IncompatibleFileException&);
-  IncompatibleFileException() : subSystem((SubSystem::type)0) {
+  IngestState(const IngestState&);
+  IngestState& operator=(const IngestState&);
+  IngestState() : name(), subSystem((SubSystem::type)0), fileByteSize(0), chunkByteSize(0), receivedChunks(0), complete(0), port(0) {
   }
 
-  virtual ~IncompatibleFileException() throw();
+  virtual ~IngestState() throw();
+  std::string name;
   SubSystem::type subSystem;
+  int64_t fileByteSize;
+  int32_t chunkByteSize;
+  int32_t receivedChunks;
+  std::vector<int32_t>  missingChunks;
+  bool complete;
+  int32_t port;
 
-  _IncompatibleFileException__isset __isset;
+  _IngestState__isset __isset;
+
+  void __set_name(const std::string& val);
 
   void __set_subSystem(const SubSystem::type val);
 
-  bool operator == (const IncompatibleFileException & rhs) const
+  void __set_fileByteSize(const int64_t val);
+
+  void __set_chunkByteSize(const int32_t val);
+
+  void __set_receivedChunks(const int32_t val);
+
+  void __set_missingChunks(const std::vector<int32_t> & val);
+
+  void __set_complete(const bool val);
+
+  void __set_port(const int32_t val);
+
+  bool operator == (const IngestState & rhs) const
   {
+    if (!(name == rhs.name))
+      return false;
     if (!(subSystem == rhs.subSystem))
       return false;
+    if (!(fileByteSize == rhs.fileByteSize))
+      return false;
+    if (!(chunkByteSize == rhs.chunkByteSize))
+      return false;
+    if (!(receivedChunks == rhs.receivedChunks))
+      return false;
+    if (!(missingChunks == rhs.missingChunks))
+      return false;
+    if (!(complete == rhs.complete))
+      return false;
+    if (!(port == rhs.port))
+      return false;
     return true;
   }
-  bool operator != (const IncompatibleFileException &rhs) const {
+  bool operator != (const IngestState &rhs) const {
     return !(*this == rhs);
   }
 
-  bool operator < (const IncompatibleFileException & ) const;
+  bool operator < (const IngestState & ) const;
 
   uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
-  mutable std::string thriftTExceptionMessageHolder_;
-  const char* what() const throw();
 };
 
-void swap(IncompatibleFileException &a, IncompatibleFileException &b);
+void swap(IngestState &a, IngestState &b);
 
-inline std::ostream& operator<<(std::ostream& out, const IncompatibleFileException& obj)
+inline std::ostream& operator<<(std::ostream& out, const IngestState& obj)
 {
   obj.printTo(out);
   return out;
 }
 
-typedef struct _DmaNotInitializedException__isset {
-  _DmaNotInitializedException__isset() : subSystem(false) {}
-  bool subSystem :1;
-} _DmaNotInitializedException__isset;
+typedef struct _LiveTargetLeg__isset {
+  _LiveTargetLeg__isset() : rKm(false), azDeg(false), speedKmh(false) {}
+  bool rKm :1;
+  bool azDeg :1;
+  bool speedKmh :1;
+} _LiveTargetLeg__isset;
 
-class DmaNotInitializedException : public ::apache::thrift::TException {
+class LiveTargetLeg {
  public:
 
-  DmaNotInitializedException(const DmaNotInitializedException&);
-  DmaNotInitializedException& operator=(const DmaNotInitializedException&);
-  DmaNotInitializedException() : subSystem((SubSystem::type)0) {
+  LiveTargetLeg(const LiveTargetLeg&);
+  LiveTargetLeg& operator=(const LiveTargetLeg&);
+  LiveTargetLeg() : rKm(0), azDeg(0), speedKmh(0) {
   }
 
-  virtual ~DmaNotInitializedException() throw();
-  SubSystem::type subSystem;
+  virtual ~LiveTargetLeg() throw();
+  double rKm;
+  double azDeg;
+  double speedKmh;
 
-  _DmaNotInitializedException__isset __isset;
+  _LiveTargetLeg__isset __isset;
 
-  void __set_subSystem(const SubSystem::type val);
+  void __set_rKm(const double val);
 
-  bool operator == (const DmaNotInitializedException & rhs) const
+  void __set_azDeg(const double val);
+
+  void __set_speedKmh(const double val);
+
+  bool operator == (const LiveTargetLeg & rhs) const
   {
-    if (!(subSystem == rhs.subSystem))
+    if (!(rKm == rhs.rKm))
+      return false;
+    if (!(azDeg == rhs.azDeg))
+      return false;
+    if (!(speedKmh == rhs.speedKmh))
       return false;
     return true;
   }
-  bool operator != (const DmaNotInitializedException &rhs) const {
+  bool operator != (const LiveTargetLeg &rhs) const {
     return !(*this == rhs);
   }
 
-  bool operator < (const DmaNotInitializedException & ) const;
+  bool operator < (const LiveTargetLeg & ) const;
 
   uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
-  mutable std::string thriftTExceptionMessageHolder_;
-  const char* what() const throw();
 };
 
-void swap(DmaNotInitializedException &a, DmaNotInitializedException &b);
+void swap(LiveTargetLeg &a, LiveTargetLeg &b);
 
-inline std::ostream& operator<<(std::ostream& out, const DmaNotInitializedException& obj)
+inline std::ostream& operator<<(std::ostream& out, const LiveTargetLeg& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _HitShape__isset {
+  _HitShape__isset() : acpSpread(false), lengthUs(false), minSignalUs(false), maxSignalUs(false) {}
+  bool acpSpread :1;
+  bool lengthUs :1;
+  bool minSignalUs :1;
+  bool maxSignalUs :1;
+} _HitShape__isset;
+
+class HitShape {
+ public:
+
+  HitShape(const HitShape&);
+  HitShape& operator=(const HitShape&);
+  HitShape() : acpSpread(0), lengthUs(0), minSignalUs(0), maxSignalUs(0) {
+  }
+
+  virtual ~HitShape() throw();
+  int32_t acpSpread;
+  int32_t lengthUs;
+  int32_t minSignalUs;
+  int32_t maxSignalUs;
+
+  _HitShape__isset __isset;
+
+  void __set_acpSpread(const int32_t val);
+
+  void __set_lengthUs(const int32_t val);
+
+  void __set_minSignalUs(const int32_t val);
+
+  void __set_maxSignalUs(const int32_t val);
+
+  bool operator == (const HitShape & rhs) const
+  {
+    if (!(acpSpread == rhs.acpSpread))
+      return false;
+    if (!(lengthUs == rhs.lengthUs))
+      return false;
+    if (!(minSignalUs == rhs.minSignalUs))
+      return false;
+    if (!(maxSignalUs == rhs.maxSignalUs))
+      return false;
+    return true;
+  }
+  bool operator != (const HitShape &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const HitShape & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(HitShape &a, HitShape &b);
+
+inline std::ostream& operator<<(std::ostream& out, const HitShape& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _LiveTarget__isset {
+  _LiveTarget__isset() : name(false), rKm(false), azDeg(false), legs(false), jammingSource(false), synchroPulseDelayM(false), hitShape(false) {}
+  bool name :1;
+  bool rKm :1;
+  bool azDeg :1;
+  bool legs :1;
+  bool jammingSource :1;
+  bool synchroPulseDelayM :1;
+  bool hitShape :1;
+} _LiveTarget__isset;
+
+class LiveTarget {
+ public:
+
+  LiveTarget(const LiveTarget&);
+  LiveTarget& operator=(const LiveTarget&);
+  LiveTarget() : name(), rKm(0), azDeg(0), jammingSource(0), synchroPulseDelayM(0) {
+  }
+
+  virtual ~LiveTarget() throw();
+  std::string name;
+  double rKm;
+  double azDeg;
+  std::vector<LiveTargetLeg>  legs;
+  bool jammingSource;
+  double synchroPulseDelayM;
+  HitShape hitShape;
+
+  _LiveTarget__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_rKm(const double val);
+
+  void __set_azDeg(const double val);
+
+  void __set_legs(const std::vector<LiveTargetLeg> & val);
+
+  void __set_jammingSource(const bool val);
+
+  void __set_synchroPulseDelayM(const double val);
+
+  void __set_hitShape(const HitShape& val);
+
+  bool operator == (const LiveTarget & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(rKm == rhs.rKm))
+      return false;
+    if (!(azDeg == rhs.azDeg))
+      return false;
+    if (!(legs == rhs.legs))
+      return false;
+    if (!(jammingSource == rhs.jammingSource))
+      return false;
+    if (!(synchroPulseDelayM == rhs.synchroPulseDelayM))
+      return false;
+    if (!(hitShape == rhs.hitShape))
+      return false;
+    return true;
+  }
+  bool operator != (const LiveTarget &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const LiveTarget & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(LiveTarget &a, LiveTarget &b);
+
+inline std::ostream& operator<<(std::ostream& out, const LiveTarget& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _MaskPoint__isset {
+  _MaskPoint__isset() : rKm(false), azDeg(false) {}
+  bool rKm :1;
+  bool azDeg :1;
+} _MaskPoint__isset;
+
+class MaskPoint {
+ public:
+
+  MaskPoint(const MaskPoint&);
+  MaskPoint& operator=(const MaskPoint&);
+  MaskPoint() : rKm(0), azDeg(0) {
+  }
+
+  virtual ~MaskPoint() throw();
+  double rKm;
+  double azDeg;
+
+  _MaskPoint__isset __isset;
+
+  void __set_rKm(const double val);
+
+  void __set_azDeg(const double val);
+
+  bool operator == (const MaskPoint & rhs) const
+  {
+    if (!(rKm == rhs.rKm))
+      return false;
+    if (!(azDeg == rhs.azDeg))
+      return false;
+    return true;
+  }
+  bool operator != (const MaskPoint &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const MaskPoint & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(MaskPoint &a, MaskPoint &b);
+
+inline std::ostream& operator<<(std::ostream& out, const MaskPoint& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _WeatherCell__isset {
+  _WeatherCell__isset() : name(false), rKm(false), azDeg(false), legs(false), mask(false), hitShape(false) {}
+  bool name :1;
+  bool rKm :1;
+  bool azDeg :1;
+  bool legs :1;
+  bool mask :1;
+  bool hitShape :1;
+} _WeatherCell__isset;
+
+class WeatherCell {
+ public:
+
+  WeatherCell(const WeatherCell&);
+  WeatherCell& operator=(const WeatherCell&);
+  WeatherCell() : name(), rKm(0), azDeg(0) {
+  }
+
+  virtual ~WeatherCell() throw();
+  std::string name;
+  double rKm;
+  double azDeg;
+  std::vector<LiveTargetLeg>  legs;
+  std::vector<MaskPoint>  mask;
+  HitShape hitShape;
+
+  _WeatherCell__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_rKm(const double val);
+
+  void __set_azDeg(const double val);
+
+  void __set_legs(const std::vector<LiveTargetLeg> & val);
+
+  void __set_mask(const std::vector<MaskPoint> & val);
+
+  void __set_hitShape(const HitShape& val);
+
+  bool operator == (const WeatherCell & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(rKm == rhs.rKm))
+      return false;
+    if (!(azDeg == rhs.azDeg))
+      return false;
+    if (!(legs == rhs.legs))
+      return false;
+    if (!(mask == rhs.mask))
+      return false;
+    if (!(hitShape == rhs.hitShape))
+      return false;
+    return true;
+  }
+  bool operator != (const WeatherCell &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const WeatherCell & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(WeatherCell &a, WeatherCell &b);
+
+inline std::ostream& operator<<(std::ostream& out, const WeatherCell& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _NoiseRegion__isset {
+  _NoiseRegion__isset() : fromAzDeg(false), toAzDeg(false), fromSignalUs(false), toSignalUs(false), density(false) {}
+  bool fromAzDeg :1;
+  bool toAzDeg :1;
+  bool fromSignalUs :1;
+  bool toSignalUs :1;
+  bool density :1;
+} _NoiseRegion__isset;
+
+class NoiseRegion {
+ public:
+
+  NoiseRegion(const NoiseRegion&);
+  NoiseRegion& operator=(const NoiseRegion&);
+  NoiseRegion() : fromAzDeg(0), toAzDeg(0), fromSignalUs(0), toSignalUs(0), density(0) {
+  }
+
+  virtual ~NoiseRegion() throw();
+  double fromAzDeg;
+  double toAzDeg;
+  int32_t fromSignalUs;
+  int32_t toSignalUs;
+  double density;
+
+  _NoiseRegion__isset __isset;
+
+  void __set_fromAzDeg(const double val);
+
+  void __set_toAzDeg(const double val);
+
+  void __set_fromSignalUs(const int32_t val);
+
+  void __set_toSignalUs(const int32_t val);
+
+  void __set_density(const double val);
+
+  bool operator == (const NoiseRegion & rhs) const
+  {
+    if (!(fromAzDeg == rhs.fromAzDeg))
+      return false;
+    if (!(toAzDeg == rhs.toAzDeg))
+      return false;
+    if (!(fromSignalUs == rhs.fromSignalUs))
+      return false;
+    if (!(toSignalUs == rhs.toSignalUs))
+      return false;
+    if (!(density == rhs.density))
+      return false;
+    return true;
+  }
+  bool operator != (const NoiseRegion &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const NoiseRegion & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(NoiseRegion &a, NoiseRegion &b);
+
+inline std::ostream& operator<<(std::ostream& out, const NoiseRegion& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _SeaClutter__isset {
+  _SeaClutter__isset() : seaState(false), windFromDeg(false), maxRangeKm(false), seed(false) {}
+  bool seaState :1;
+  bool windFromDeg :1;
+  bool maxRangeKm :1;
+  bool seed :1;
+} _SeaClutter__isset;
+
+class SeaClutter {
+ public:
+
+  SeaClutter(const SeaClutter&);
+  SeaClutter& operator=(const SeaClutter&);
+  SeaClutter() : seaState(0), windFromDeg(0), maxRangeKm(0), seed(0) {
+  }
+
+  virtual ~SeaClutter() throw();
+  int32_t seaState;
+  double windFromDeg;
+  double maxRangeKm;
+  int64_t seed;
+
+  _SeaClutter__isset __isset;
+
+  void __set_seaState(const int32_t val);
+
+  void __set_windFromDeg(const double val);
+
+  void __set_maxRangeKm(const double val);
+
+  void __set_seed(const int64_t val);
+
+  bool operator == (const SeaClutter & rhs) const
+  {
+    if (!(seaState == rhs.seaState))
+      return false;
+    if (!(windFromDeg == rhs.windFromDeg))
+      return false;
+    if (!(maxRangeKm == rhs.maxRangeKm))
+      return false;
+    if (!(seed == rhs.seed))
+      return false;
+    return true;
+  }
+  bool operator != (const SeaClutter &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SeaClutter & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(SeaClutter &a, SeaClutter &b);
+
+inline std::ostream& operator<<(std::ostream& out, const SeaClutter& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _TargetLayer__isset {
+  _TargetLayer__isset() : scenario(false), startArp(false), enabled(false) {}
+  bool scenario :1;
+  bool startArp :1;
+  bool enabled :1;
+} _TargetLayer__isset;
+
+class TargetLayer {
+ public:
+
+  TargetLayer(const TargetLayer&);
+  TargetLayer& operator=(const TargetLayer&);
+  TargetLayer() : scenario(), startArp(0), enabled(0) {
+  }
+
+  virtual ~TargetLayer() throw();
+  std::string scenario;
+  int32_t startArp;
+  bool enabled;
+
+  _TargetLayer__isset __isset;
+
+  void __set_scenario(const std::string& val);
+
+  void __set_startArp(const int32_t val);
+
+  void __set_enabled(const bool val);
+
+  bool operator == (const TargetLayer & rhs) const
+  {
+    if (!(scenario == rhs.scenario))
+      return false;
+    if (!(startArp == rhs.startArp))
+      return false;
+    if (!(enabled == rhs.enabled))
+      return false;
+    return true;
+  }
+  bool operator != (const TargetLayer &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TargetLayer & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(TargetLayer &a, TargetLayer &b);
+
+inline std::ostream& operator<<(std::ostream& out, const TargetLayer& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _BlankingSector__isset {
+  _BlankingSector__isset() : fromAzDeg(false), toAzDeg(false), fromRangeKm(false), toRangeKm(false) {}
+  bool fromAzDeg :1;
+  bool toAzDeg :1;
+  bool fromRangeKm :1;
+  bool toRangeKm :1;
+} _BlankingSector__isset;
+
+class BlankingSector {
+ public:
+
+  BlankingSector(const BlankingSector&);
+  BlankingSector& operator=(const BlankingSector&);
+  BlankingSector() : fromAzDeg(0), toAzDeg(0), fromRangeKm(0), toRangeKm(0) {
+  }
+
+  virtual ~BlankingSector() throw();
+  double fromAzDeg;
+  double toAzDeg;
+  double fromRangeKm;
+  double toRangeKm;
+
+  _BlankingSector__isset __isset;
+
+  void __set_fromAzDeg(const double val);
+
+  void __set_toAzDeg(const double val);
+
+  void __set_fromRangeKm(const double val);
+
+  void __set_toRangeKm(const double val);
+
+  bool operator == (const BlankingSector & rhs) const
+  {
+    if (!(fromAzDeg == rhs.fromAzDeg))
+      return false;
+    if (!(toAzDeg == rhs.toAzDeg))
+      return false;
+    if (!(fromRangeKm == rhs.fromRangeKm))
+      return false;
+    if (!(toRangeKm == rhs.toRangeKm))
+      return false;
+    return true;
+  }
+  bool operator != (const BlankingSector &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const BlankingSector & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(BlankingSector &a, BlankingSector &b);
+
+inline std::ostream& operator<<(std::ostream& out, const BlankingSector& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _ScheduledCommand__isset {
+  _ScheduledCommand__isset() : acpIdx(false), action(false), arpPosition(false), scenario(false) {}
+  bool acpIdx :1;
+  bool action :1;
+  bool arpPosition :1;
+  bool scenario :1;
+} _ScheduledCommand__isset;
+
+class ScheduledCommand {
+ public:
+
+  ScheduledCommand(const ScheduledCommand&);
+  ScheduledCommand& operator=(const ScheduledCommand&);
+  ScheduledCommand() : acpIdx(0), action((CommandAction::type)0), arpPosition(0), scenario() {
+  }
+
+  virtual ~ScheduledCommand() throw();
+  int64_t acpIdx;
+  CommandAction::type action;
+  int32_t arpPosition;
+  std::string scenario;
+
+  _ScheduledCommand__isset __isset;
+
+  void __set_acpIdx(const int64_t val);
+
+  void __set_action(const CommandAction::type val);
+
+  void __set_arpPosition(const int32_t val);
+
+  void __set_scenario(const std::string& val);
+
+  bool operator == (const ScheduledCommand & rhs) const
+  {
+    if (!(acpIdx == rhs.acpIdx))
+      return false;
+    if (!(action == rhs.action))
+      return false;
+    if (!(arpPosition == rhs.arpPosition))
+      return false;
+    if (!(scenario == rhs.scenario))
+      return false;
+    return true;
+  }
+  bool operator != (const ScheduledCommand &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ScheduledCommand & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ScheduledCommand &a, ScheduledCommand &b);
+
+inline std::ostream& operator<<(std::ostream& out, const ScheduledCommand& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _DmaHealth__isset {
+  _DmaHealth__isset() : subSystem(false), running(false), status(false), halts(false), internalErrors(false), slaveErrors(false), decodeErrors(false), sgErrors(false), stalls(false), recoveries(false), failedRecoveries(false), lastRecoveryUs(false) {}
+  bool subSystem :1;
+  bool running :1;
+  bool status :1;
+  bool halts :1;
+  bool internalErrors :1;
+  bool slaveErrors :1;
+  bool decodeErrors :1;
+  bool sgErrors :1;
+  bool stalls :1;
+  bool recoveries :1;
+  bool failedRecoveries :1;
+  bool lastRecoveryUs :1;
+} _DmaHealth__isset;
+
+class DmaHealth {
+ public:
+
+  DmaHealth(const DmaHealth&);
+  DmaHealth& operator=(const DmaHealth&);
+  DmaHealth() : subSystem((SubSystem::type)0), running(0), status(0), halts(0), internalErrors(0), slaveErrors(0), decodeErrors(0), sgErrors(0), stalls(0), recoveries(0), failedRecoveries(0), lastRecoveryUs(0) {
+  }
+
+  virtual ~DmaHealth() throw();
+  SubSystem::type subSystem;
+  bool running;
+  int32_t status;
+  int64_t halts;
+  int64_t internalErrors;
+  int64_t slaveErrors;
+  int64_t decodeErrors;
+  int64_t sgErrors;
+  int64_t stalls;
+  int64_t recoveries;
+  int64_t failedRecoveries;
+  int32_t lastRecoveryUs;
+
+  _DmaHealth__isset __isset;
+
+  void __set_subSystem(const SubSystem::type val);
+
+  void __set_running(const bool val);
+
+  void __set_status(const int32_t val);
+
+  void __set_halts(const int64_t val);
+
+  void __set_internalErrors(const int64_t val);
+
+  void __set_slaveErrors(const int64_t val);
+
+  void __set_decodeErrors(const int64_t val);
+
+  void __set_sgErrors(const int64_t val);
+
+  void __set_stalls(const int64_t val);
+
+  void __set_recoveries(const int64_t val);
+
+  void __set_failedRecoveries(const int64_t val);
+
+  void __set_lastRecoveryUs(const int32_t val);
+
+  bool operator == (const DmaHealth & rhs) const
+  {
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    if (!(running == rhs.running))
+      return false;
+    if (!(status == rhs.status))
+      return false;
+    if (!(halts == rhs.halts))
+      return false;
+    if (!(internalErrors == rhs.internalErrors))
+      return false;
+    if (!(slaveErrors == rhs.slaveErrors))
+      return false;
+    if (!(decodeErrors == rhs.decodeErrors))
+      return false;
+    if (!(sgErrors == rhs.sgErrors))
+      return false;
+    if (!(stalls == rhs.stalls))
+      return false;
+    if (!(recoveries == rhs.recoveries))
+      return false;
+    if (!(failedRecoveries == rhs.failedRecoveries))
+      return false;
+    if (!(lastRecoveryUs == rhs.lastRecoveryUs))
+      return false;
+    return true;
+  }
+  bool operator != (const DmaHealth &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DmaHealth & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(DmaHealth &a, DmaHealth &b);
+
+inline std::ostream& operator<<(std::ostream& out, const DmaHealth& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+class RadarSignalNotCalibratedException : public ::apache::thrift::TException {
+ public:
+
+  RadarSignalNotCalibratedException(const RadarSignalNotCalibratedException&);
+  RadarSignalNotCalibratedException& operator=(const RadarSignalNotCalibratedException&);
+  RadarSignalNotCalibratedException() {
+  }
+
+  virtual ~RadarSignalNotCalibratedException() throw();
+
+  bool operator == (const RadarSignalNotCalibratedException & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const RadarSignalNotCalibratedException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const RadarSignalNotCalibratedException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(RadarSignalNotCalibratedException &a, RadarSignalNotCalibratedException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const RadarSignalNotCalibratedException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _IncompatibleFileException__isset {
+  _IncompatibleFileException__isset() : subSystem(false) {}
+  bool subSystem :1;
+} _IncompatibleFileException__isset;
+
+class IncompatibleFileException : public ::apache::thrift::TException {
+ public:
+
+  IncompatibleFileException(const IncompatibleFileException&);
+  IncompatibleFileException& operator=(const IncompatibleFileException&);
+  IncompatibleFileException() : subSystem((SubSystem::type)0) {
+  }
+
+  virtual ~IncompatibleFileException() throw();
+  SubSystem::type subSystem;
+
+  _IncompatibleFileException__isset __isset;
+
+  void __set_subSystem(const SubSystem::type val);
+
+  bool operator == (const IncompatibleFileException & rhs) const
+  {
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    return true;
+  }
+  bool operator != (const IncompatibleFileException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const IncompatibleFileException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(IncompatibleFileException &a, IncompatibleFileException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const IncompatibleFileException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _DmaNotInitializedException__isset {
+  _DmaNotInitializedException__isset() : subSystem(false) {}
+  bool subSystem :1;
+} _DmaNotInitializedException__isset;
+
+class DmaNotInitializedException : public ::apache::thrift::TException {
+ public:
+
+  DmaNotInitializedException(const DmaNotInitializedException&);
+  DmaNotInitializedException& operator=(const DmaNotInitializedException&);
+  DmaNotInitializedException() : subSystem((SubSystem::type)0) {
+  }
+
+  virtual ~DmaNotInitializedException() throw();
+  SubSystem::type subSystem;
+
+  _DmaNotInitializedException__isset __isset;
+
+  void __set_subSystem(const SubSystem::type val);
+
+  bool operator == (const DmaNotInitializedException & rhs) const
+  {
+    if (!(subSystem == rhs.subSystem))
+      return false;
+    return true;
+  }
+  bool operator != (const DmaNotInitializedException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DmaNotInitializedException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(DmaNotInitializedException &a, DmaNotInitializedException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const DmaNotInitializedException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _ScenarioException__isset {
+  _ScenarioException__isset() : name(false), reason(false) {}
+  bool name :1;
+  bool reason :1;
+} _ScenarioException__isset;
+
+class ScenarioException : public ::apache::thrift::TException {
+ public:
+
+  ScenarioException(const ScenarioException&);
+  ScenarioException& operator=(const ScenarioException&);
+  ScenarioException() : name(), reason() {
+  }
+
+  virtual ~ScenarioException() throw();
+  std::string name;
+  std::string reason;
+
+  _ScenarioException__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_reason(const std::string& val);
+
+  bool operator == (const ScenarioException & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(reason == rhs.reason))
+      return false;
+    return true;
+  }
+  bool operator != (const ScenarioException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ScenarioException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(ScenarioException &a, ScenarioException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const ScenarioException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _LiveTargetException__isset {
+  _LiveTargetException__isset() : name(false), reason(false) {}
+  bool name :1;
+  bool reason :1;
+} _LiveTargetException__isset;
+
+class LiveTargetException : public ::apache::thrift::TException {
+ public:
+
+  LiveTargetException(const LiveTargetException&);
+  LiveTargetException& operator=(const LiveTargetException&);
+  LiveTargetException() : name(), reason() {
+  }
+
+  virtual ~LiveTargetException() throw();
+  std::string name;
+  std::string reason;
+
+  _LiveTargetException__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_reason(const std::string& val);
+
+  bool operator == (const LiveTargetException & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(reason == rhs.reason))
+      return false;
+    return true;
+  }
+  bool operator != (const LiveTargetException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const LiveTargetException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(LiveTargetException &a, LiveTargetException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const LiveTargetException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _ScheduleException__isset {
+  _ScheduleException__isset() : acpIdx(false), reason(false) {}
+  bool acpIdx :1;
+  bool reason :1;
+} _ScheduleException__isset;
+
+class ScheduleException : public ::apache::thrift::TException {
+ public:
+
+  ScheduleException(const ScheduleException&);
+  ScheduleException& operator=(const ScheduleException&);
+  ScheduleException() : acpIdx(0), reason() {
+  }
+
+  virtual ~ScheduleException() throw();
+  int64_t acpIdx;
+  std::string reason;
+
+  _ScheduleException__isset __isset;
+
+  void __set_acpIdx(const int64_t val);
+
+  void __set_reason(const std::string& val);
+
+  bool operator == (const ScheduleException & rhs) const
+  {
+    if (!(acpIdx == rhs.acpIdx))
+      return false;
+    if (!(reason == rhs.reason))
+      return false;
+    return true;
+  }
+  bool operator != (const ScheduleException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ScheduleException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(ScheduleException &a, ScheduleException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const ScheduleException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+typedef struct _CaptureException__isset {
+  _CaptureException__isset() : name(false), reason(false) {}
+  bool name :1;
+  bool reason :1;
+} _CaptureException__isset;
+
+class CaptureException : public ::apache::thrift::TException {
+ public:
+
+  CaptureException(const CaptureException&);
+  CaptureException& operator=(const CaptureException&);
+  CaptureException() : name(), reason() {
+  }
+
+  virtual ~CaptureException() throw();
+  std::string name;
+  std::string reason;
+
+  _CaptureException__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_reason(const std::string& val);
+
+  bool operator == (const CaptureException & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(reason == rhs.reason))
+      return false;
+    return true;
+  }
+  bool operator != (const CaptureException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const CaptureException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const throw();
+};
+
+void swap(CaptureException &a, CaptureException &b);
+
+inline std::ostream& operator<<(std::ostream& out, const CaptureException& obj)
 {
   obj.printTo(out);
   return out;
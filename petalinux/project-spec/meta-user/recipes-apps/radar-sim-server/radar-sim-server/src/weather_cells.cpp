@@ -0,0 +1,211 @@
+/*
+ * weather_cells.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <math.h>
+
+#include <iostream>
+
+#include "weather_cells.hpp"
+#include "live_targets.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+#define HOUR_TO_US              3600000000.0
+
+/**
+ * ORs the row shifted by the given number of bits towards the longer signal times into itself.
+ * Runs from the last word down, so every word is read before it is written.
+ */
+static void shiftOrRow(u32 *row, u32 shift) {
+    auto wordShift = (s32) (shift / WORD_BITS);
+    auto bitShift = shift % WORD_BITS;
+
+    for (auto w = (s32) TRIG_WORD_CNT - 1; w >= wordShift; w--) {
+        auto src = w - wordShift;
+        auto bits = row[src] << bitShift;
+        if (bitShift > 0 && src > 0) {
+            bits |= row[src - 1] >> (WORD_BITS - bitShift);
+        }
+        row[w] |= bits;
+    }
+}
+
+/**
+ * Stretches every hit of the row to lengthUs bits, doubling the stretch with each pass,
+ * and clears what ends up past maxSignalUs.
+ */
+static void stretchHits(u32 *row, s32 lengthUs, s32 maxSignalUs) {
+    for (s32 covered = 1; covered < lengthUs; ) {
+        auto shift = MIN(covered, lengthUs - covered);
+        shiftOrRow(row, (u32) shift);
+        covered += shift;
+    }
+
+    auto firstCleared = (u32) MAX(maxSignalUs + 1, (s32) WORD_BITS);
+    if (firstCleared < MAX_TRIG_BITS) {
+        row[firstCleared / WORD_BITS] &= (1u << (firstCleared % WORD_BITS)) - 1;
+        for (auto w = firstCleared / WORD_BITS + 1; w < TRIG_WORD_CNT; w++) {
+            row[w] = 0;
+        }
+    }
+}
+
+WeatherCells::~WeatherCells() {
+    freeStaging(layer);
+}
+
+void WeatherCells::set(const vector<WeatherCell> &definitions) {
+    vector<Cell> prepared;
+    size_t points = 0;
+    for (auto &definition : definitions) {
+        prepared.push_back(makeCell(definition));
+        points += definition.mask.size();
+    }
+
+    lock_guard<mutex> lock(cellsMutex);
+    cells.swap(prepared);
+    cout << "WEATHER_CELLS=" << cells.size() << "/" << points << endl;
+}
+
+void WeatherCells::render(u32 rotation, double arpUs, u32 acpCnt, u32 *rows) {
+    lock_guard<mutex> lock(cellsMutex);
+    if (cells.empty()) {
+        return;
+    }
+
+    if (layerRowCount != acpCnt) {
+        freeStaging(layer);
+        layer = allocStaging((size_t) acpCnt * ROW_BYTE_SIZE);
+        layerRowCount = layer != NULL ? acpCnt : 0;
+        occupancy.resize(acpCnt);
+    }
+    if (layer == NULL) {
+        cerr << "ERR=Weather cell layer allocation failed" << endl;
+        return;
+    }
+
+    auto tUs = rotation * arpUs;
+
+    for (auto &cell : cells) {
+        auto &shape = cell.shape;
+
+        double cx, cy, turnRad;
+        position(cell, tUs, cx, cy, turnRad);
+
+        // plot the mask, one bit per point
+        for (auto &point : cell.mask) {
+            auto bearingRad = point.bearingRad + turnRad;
+            auto x = cx + point.rKm * sin(bearingRad);
+            auto y = cy + point.rKm * cos(bearingRad);
+
+            auto signalUs = (s32) round(sqrt(x * x + y * y) * LIVE_SIGNAL_US_PER_KM);
+            if (!(signalUs > shape.minSignalUs && signalUs < shape.maxSignalUs) || signalUs < (s32) WORD_BITS) {
+                continue;
+            }
+
+            auto acp = azimuthAcp(x, y, acpCnt);
+            layer[acp * TRIG_WORD_CNT + signalUs / WORD_BITS] |= 1u << (signalUs % WORD_BITS);
+            occupancy.set(acp);
+        }
+
+        // spread each plotted row over the beam width, leaving the layer clear for the next cell
+        for (u32 acp = 0; acp < acpCnt; acp++) {
+            if (!occupancy.test(acp)) {
+                continue;
+            }
+
+            auto src = layer + acp * TRIG_WORD_CNT;
+            stretchHits(src, shape.lengthUs, shape.maxSignalUs);
+            for (auto d = -shape.acpSpread; d <= shape.acpSpread; d++) {
+                auto row = (u32) ((((s64) acp + d) % acpCnt + acpCnt) % acpCnt);
+                orRows(rows + row * TRIG_WORD_CNT, src, ROW_BYTE_SIZE);
+            }
+            clearRows(src, ROW_BYTE_SIZE);
+        }
+        occupancy.clear();
+    }
+}
+
+WeatherCells::Cell WeatherCells::makeCell(const WeatherCell &definition) {
+
+    if (definition.name.empty()) {
+        raiseLiveTargetException(definition.name, "missing name");
+    }
+
+    auto &shape = definition.hitShape;
+    if (shape.acpSpread < 0 || shape.lengthUs <= 0 || shape.maxSignalUs <= shape.minSignalUs) {
+        raiseLiveTargetException(definition.name, "invalid hit shape");
+    }
+
+    if (definition.mask.size() > WEATHER_MAX_MASK_POINTS) {
+        raiseLiveTargetException(definition.name, "mask too large");
+    }
+
+    Cell cell;
+    cell.name = definition.name;
+    cell.shape = shape;
+
+    for (auto &point : definition.mask) {
+        cell.mask.push_back(PolarPoint {(float) point.rKm, (float) (point.azDeg * M_PI / 180)});
+    }
+
+    auto azRad = definition.azDeg * M_PI / 180;
+    auto x = definition.rKm * sin(azRad);
+    auto y = definition.rKm * cos(azRad);
+
+    // the mask is drawn for the heading of the first leg, later legs turn it
+    double t = 0;
+    auto headingKnown = false;
+    double firstHeadingRad = 0;
+    double turnRad = 0;
+    for (auto &leg : definition.legs) {
+        if (leg.speedKmh <= 0) {
+            raiseLiveTargetException(definition.name, "leg speed must be positive");
+        }
+
+        auto legAzRad = leg.azDeg * M_PI / 180;
+        auto x2 = leg.rKm * sin(legAzRad);
+        auto y2 = leg.rKm * cos(legAzRad);
+        auto distanceKm = sqrt((x2 - x) * (x2 - x) + (y2 - y) * (y2 - y));
+        auto dt = distanceKm / (leg.speedKmh / HOUR_TO_US);
+
+        if (distanceKm > 0) {
+            auto headingRad = atan2(x2 - x, y2 - y);
+            if (!headingKnown) {
+                firstHeadingRad = headingRad;
+                headingKnown = true;
+            }
+            turnRad = headingRad - firstHeadingRad;
+        }
+
+        cell.legs.push_back(Leg {x, y, x2, y2, t, t + dt, turnRad});
+
+        x = x2;
+        y = y2;
+        t += dt;
+    }
+
+    // standing still, or resting where the last leg ends
+    cell.legs.push_back(Leg {x, y, x, y, t, INFINITY, turnRad});
+
+    return cell;
+}
+
+void WeatherCells::position(const Cell &cell, double tUs, double &xKm, double &yKm, double &turnRad) {
+    for (auto &leg : cell.legs) {
+        if (tUs < leg.t2Us || isinf(leg.t2Us)) {
+            auto f = isinf(leg.t2Us) ? 0 : MAX(0.0, (tUs - leg.t1Us) / (leg.t2Us - leg.t1Us));
+            xKm = leg.x1 + f * (leg.x2 - leg.x1);
+            yKm = leg.y1 + f * (leg.y2 - leg.y1);
+            turnRad = leg.turnRad;
+            return;
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * weather_cells.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef WEATHER_CELLS_
+#define WEATHER_CELLS_
+
+#include "thrift/sim_types.h"
+
+#include "radar_map.hpp"
+#include "commit_kernels.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**  CONSTANTS **/
+
+/** Largest mask accepted per cell, a cloud image of the designer is about 100x100 km **/
+#define WEATHER_MAX_MASK_POINTS     65536
+
+/**  CLASSES **/
+
+/**
+ * Clouds drifting over the clutter, rendered into every clutter rotation as it is refilled
+ * instead of being rasterized into the clutter map by the designer.
+ *
+ * A cell is a compact polar mask around its center, flown along its legs in scenario time and
+ * turned as the legs turn. The hits of a rotation are plotted into a side layer, stretched to
+ * the impulse length and spread to the beam width there, and ORed into the rows with the wide
+ * row kernels.
+ */
+class WeatherCells {
+public:
+    ~WeatherCells();
+
+    /**
+     * Replaces all cells, raises LiveTargetException naming the first invalid one.
+     */
+    void set(const std::vector<::hr::franp::rsim::WeatherCell> &cells);
+
+    /**
+     * ORs the cells, where they are at the start of the given scenario rotation, into the
+     * acpCnt rows of the rotation.
+     */
+    void render(u32 rotation, double arpUs, u32 acpCnt, u32 *rows);
+
+private:
+    struct PolarPoint {
+        float rKm;
+        float bearingRad;
+    };
+
+    /**
+     * Straight leg of a path in cartesian km, flown from t1Us to t2Us, the mask turned by turnRad.
+     */
+    struct Leg {
+        double x1;
+        double y1;
+        double x2;
+        double y2;
+        double t1Us;
+        double t2Us;
+        double turnRad;
+    };
+
+    struct Cell {
+        std::string name;
+
+        std::vector<Leg> legs;
+
+        std::vector<PolarPoint> mask;
+
+        ::hr::franp::rsim::HitShape shape;
+    };
+
+    std::mutex cellsMutex;
+
+    std::vector<Cell> cells;
+
+    /** Hits of one cell in one rotation, before they are spread **/
+    u32 *layer = NULL;
+
+    u32 layerRowCount = 0;
+
+    RowBitmap occupancy;
+
+    /**
+     * Validates the cell and prepares its mask and path.
+     */
+    static Cell makeCell(const ::hr::franp::rsim::WeatherCell &definition);
+
+    /**
+     * Center and turn of the cell the given time into the scenario, a cell stays where its last leg ends.
+     */
+    static void position(const Cell &cell, double tUs, double &xKm, double &yKm, double &turnRad);
+};
+
+#endif /* WEATHER_CELLS_ */
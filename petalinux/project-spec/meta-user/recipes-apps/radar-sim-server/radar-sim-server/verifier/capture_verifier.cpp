@@ -0,0 +1,338 @@
+/*
+ * capture_verifier.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include <map>
+#include <tuple>
+
+#include "capture_verifier.hpp"
+#include "map_resampling.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+static const u8 *mapFile(const string &path, size_t &byteSize) {
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        RAISE(VerifyException, "Unable to open " << path << ": " << strerror(errno));
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+        close(fd);
+        RAISE(VerifyException, "Unable to map empty file " << path);
+    }
+
+    byteSize = (size_t) fileStat.st_size;
+    auto data = mmap(NULL, byteSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        RAISE(VerifyException, "Unable to map " << path << ": " << strerror(errno));
+    }
+
+    // both files are streamed front to back once
+    madvise(data, byteSize, MADV_SEQUENTIAL);
+    return (const u8 *) data;
+}
+
+void compareRows(const u32 *captured, const u32 *expected, u32 rowCount, RowDiff &diff) {
+
+    u64 extraHits = 0;
+    u64 missingHits = 0;
+
+#ifdef __ARM_NEON
+    uint32x4_t extraCnt = vdupq_n_u32(0);
+    uint32x4_t missingCnt = vdupq_n_u32(0);
+#endif
+
+    for (u32 row = 0; row < rowCount; row++) {
+
+        // the ACP index is no hit, it is counted as a wrong row on its own
+        auto acpDiff = (captured[0] ^ expected[0]) & ACP_IDX_MASK;
+        if (acpDiff != 0) {
+            diff.wrongAcpRows++;
+            extraHits -= __builtin_popcount(captured[0] & ~expected[0] & ACP_IDX_MASK);
+            missingHits -= __builtin_popcount(expected[0] & ~captured[0] & ACP_IDX_MASK);
+        }
+
+#ifdef __ARM_NEON
+        uint16x8_t extraRow = vdupq_n_u16(0);
+        uint16x8_t missingRow = vdupq_n_u16(0);
+        for (u32 w = 0; w < TRIG_WORD_CNT; w += 4) {
+            uint32x4_t c = vld1q_u32(captured + w);
+            uint32x4_t e = vld1q_u32(expected + w);
+            extraRow = vpadalq_u8(extraRow, vcntq_u8(vreinterpretq_u8_u32(vbicq_u32(c, e))));
+            missingRow = vpadalq_u8(missingRow, vcntq_u8(vreinterpretq_u8_u32(vbicq_u32(e, c))));
+        }
+        extraCnt = vpadalq_u16(extraCnt, extraRow);
+        missingCnt = vpadalq_u16(missingCnt, missingRow);
+#else
+        for (u32 w = 0; w < TRIG_WORD_CNT; w += 2) {
+            u64 c, e;
+            memcpy(&c, captured + w, sizeof(u64));
+            memcpy(&e, expected + w, sizeof(u64));
+            extraHits += __builtin_popcountll(c & ~e);
+            missingHits += __builtin_popcountll(e & ~c);
+        }
+#endif
+
+        captured += TRIG_WORD_CNT;
+        expected += TRIG_WORD_CNT;
+    }
+
+#ifdef __ARM_NEON
+    uint64x2_t extraSum = vpaddlq_u32(extraCnt);
+    uint64x2_t missingSum = vpaddlq_u32(missingCnt);
+    extraHits += vgetq_lane_u64(extraSum, 0) + vgetq_lane_u64(extraSum, 1);
+    missingHits += vgetq_lane_u64(missingSum, 0) + vgetq_lane_u64(missingSum, 1);
+#endif
+
+    diff.extraHits += extraHits;
+    diff.missingHits += missingHits;
+}
+
+MappedMapSource::MappedMapSource(const string &fileName) {
+    data = mapFile(fileName, byteSize);
+    if (byteSize < MAP_HEADER_BYTE_SIZE) {
+        munmap((void *) data, byteSize);
+        RAISE(VerifyException, "No map header in " << fileName);
+    }
+    memcpy(&mapHeader, data, MAP_HEADER_BYTE_SIZE);
+
+    u64 trailerByteSize;
+    try {
+        trailerByteSize = readSegments();
+    } catch (...) {
+        munmap((void *) data, byteSize);
+        throw;
+    }
+    storedRowCount = MIN((byteSize - MAP_HEADER_BYTE_SIZE - trailerByteSize) / ROW_BYTE_SIZE, MapSource::rowCount());
+}
+
+MappedMapSource::~MappedMapSource() {
+    munmap((void *) data, byteSize);
+}
+
+u64 MappedMapSource::readSegments() {
+    if (byteSize < MAP_HEADER_BYTE_SIZE + MAP_TRAILER_BYTE_SIZE) {
+        return 0;
+    }
+
+    u32 trailer[2];
+    memcpy(trailer, data + byteSize - MAP_TRAILER_BYTE_SIZE, MAP_TRAILER_BYTE_SIZE);
+    if (trailer[1] != MAP_SEGMENT_MAGIC) {
+        return 0;
+    }
+
+    // the same rules as FileMapSource, plain rows that merely end like a table are rows
+    auto segmentCnt = trailer[0];
+    auto rowsByteSize = (u64) byteSize - MAP_HEADER_BYTE_SIZE;
+    auto tableByteSize = (u64) segmentCnt * MAP_SEGMENT_BYTE_SIZE + MAP_TRAILER_BYTE_SIZE;
+    if (segmentCnt == 0
+        || segmentCnt > MAP_MAX_SEGMENT_CNT
+        || tableByteSize > rowsByteSize
+        || (rowsByteSize - tableByteSize) % ROW_BYTE_SIZE != 0) {
+        return 0;
+    }
+
+    mapSegments.resize(segmentCnt);
+    memcpy(mapSegments.data(), data + byteSize - tableByteSize, segmentCnt * MAP_SEGMENT_BYTE_SIZE);
+
+    auto storedRotations = mapHeader.acpCnt > 0 ? (rowsByteSize - tableByteSize) / ROW_BYTE_SIZE / mapHeader.acpCnt : 0;
+    if (!isValidSegmentTable(mapSegments, (u32) MIN(storedRotations, (u64) mapHeader.blockCount))) {
+        RAISE(VerifyException, "Corrupted segment table");
+    }
+    return tableByteSize;
+}
+
+u64 MappedMapSource::rowCount() const {
+    return storedRowCount;
+}
+
+void MappedMapSource::readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst) {
+    auto firstStoredRow = (u64) rotation * mapHeader.acpCnt + firstRow;
+    auto storedRows = firstStoredRow < storedRowCount ? MIN((u64) rowCount, storedRowCount - firstStoredRow) : 0;
+
+    memcpy(dst, data + MAP_HEADER_BYTE_SIZE + firstStoredRow * ROW_BYTE_SIZE, storedRows * ROW_BYTE_SIZE);
+
+    // the server plays zero rows past the end of the map
+    memset(dst + storedRows * TRIG_WORD_CNT, 0x0, (rowCount - storedRows) * ROW_BYTE_SIZE);
+}
+
+CaptureVerifier::CaptureVerifier(const string &capturePath,
+                                 const string &clutterPath,
+                                 const string &targetPath,
+                                 s32 acpOffset) {
+    data = mapFile(capturePath, byteSize);
+    if (byteSize < sizeof(CaptureHeader)) {
+        munmap((void *) data, byteSize);
+        RAISE(VerifyException, "No capture header in " << capturePath);
+    }
+
+    memcpy(&captureHeader, data, sizeof(CaptureHeader));
+    if (captureHeader.magic != CAPTURE_FILE_MAGIC
+        || captureHeader.version != CAPTURE_VERSION
+        || captureHeader.acpCnt == 0) {
+        munmap((void *) data, byteSize);
+        RAISE(VerifyException, "Not a capture or not calibrated: " << capturePath);
+    }
+
+    try {
+        if (!clutterPath.empty()) {
+            clutterSource = playedSource(clutterPath, acpOffset);
+        }
+        if (!targetPath.empty()) {
+            targetSource = playedSource(targetPath, acpOffset);
+        }
+    } catch (...) {
+        munmap((void *) data, byteSize);
+        throw;
+    }
+}
+
+CaptureVerifier::~CaptureVerifier() {
+    munmap((void *) data, byteSize);
+}
+
+shared_ptr<MapSource> CaptureVerifier::playedSource(const string &path, s32 acpOffset) {
+
+    // played exactly as SimulatorHandler::playedSource does with the calibration of the capture
+    shared_ptr<MapSource> played = make_shared<MappedMapSource>(path);
+    played = playbackSource(played);
+    played = azimuthResampledSource(played, captureHeader.acpCnt, acpOffset);
+    return rangeResampledSource(played, captureHeader.trigUs);
+}
+
+VerifySummary CaptureVerifier::verify(const ReportFunc &report) {
+    VerifySummary summary {0, 0, 0, 0, false};
+
+    // rotations in the order they were first committed
+    vector<RotationReport> reports;
+    map<tuple<u32, u32, u32>, size_t> reportsByRotation;
+
+    size_t offset = sizeof(CaptureHeader);
+    while (offset < byteSize) {
+        if (byteSize - offset < sizeof(CaptureRecord)) {
+            summary.truncated = true;
+            break;
+        }
+
+        CaptureRecord record;
+        memcpy(&record, data + offset, sizeof(CaptureRecord));
+        if (record.magic != CAPTURE_RECORD_MAGIC
+            || record.rowCount == 0
+            || (u64) record.firstAcp + record.rowCount > captureHeader.acpCnt) {
+            RAISE(VerifyException, "Corrupted record at offset " << offset);
+        }
+        offset += sizeof(CaptureRecord);
+
+        if (byteSize - offset < record.payloadByteSize) {
+            summary.truncated = true;
+            break;
+        }
+        auto payload = record.payloadByteSize > 0 ? data + offset : NULL;
+        offset += record.payloadByteSize;
+        summary.records++;
+
+        auto &source = record.subSystem == SubSystem::CLUTTER ? clutterSource : targetSource;
+        if (!source) {
+            continue;
+        }
+
+        auto rotation = recordRotation(record);
+        auto key = make_tuple(record.subSystem, record.fromArpIdx, rotation);
+        auto it = reportsByRotation.find(key);
+        if (it == reportsByRotation.end()) {
+            RotationReport rotationReport = RotationReport();
+            rotationReport.subSystem = record.subSystem;
+            rotationReport.fromArpIdx = record.fromArpIdx;
+            rotationReport.rotation = rotation;
+            reports.push_back(rotationReport);
+            it = reportsByRotation.insert(make_pair(key, reports.size() - 1)).first;
+        }
+
+        verifyRecord(record, payload, *source, reports[it->second], summary);
+    }
+
+    for (auto &rotationReport : reports) {
+        summary.rotations++;
+        if (!rotationReport.matches()) {
+            summary.mismatchingRotations++;
+        }
+        report(rotationReport);
+    }
+    return summary;
+}
+
+u32 CaptureVerifier::recordRotation(const CaptureRecord &record) const {
+    if (record.subSystem == SubSystem::CLUTTER) {
+        return record.loadIdx;
+    }
+
+    // the target sectors count on over the rotations, only the last slot may be shorter
+    auto slotRowCnt = record.slot > 0 ? record.firstAcp / record.slot : record.rowCount;
+    auto sectorCnt = (captureHeader.acpCnt + slotRowCnt - 1) / MAX(slotRowCnt, (u32) 1);
+    return record.loadIdx / MAX(sectorCnt, (u32) 1);
+}
+
+void CaptureVerifier::verifyRecord(const CaptureRecord &record, const u8 *payload, MapSource &source,
+                                   RotationReport &report, VerifySummary &summary) {
+    auto rowBytes = (size_t) record.rowCount * ROW_BYTE_SIZE;
+
+    expected.resize(record.rowCount * TRIG_WORD_CNT);
+    source.readRows(record.mapRotation, record.firstAcp, record.rowCount, expected.data());
+
+    report.records++;
+    report.mapRotation = record.mapRotation;
+
+    if (record.flags & CAPTURE_OVERLAID) {
+        // the committed rows are not the map's, check that the right map rows were read
+        if (rowsHash(expected.data(), record.rowCount) != record.mapHash) {
+            report.hashMismatches++;
+        }
+        report.overlaidSlots++;
+        summary.comparedBytes += rowBytes;
+    } else if (payload != NULL) {
+        captured.resize(record.rowCount * TRIG_WORD_CNT);
+        uLongf capturedBytes = rowBytes;
+        if (uncompress((Bytef *) captured.data(), &capturedBytes, payload, record.payloadByteSize) != Z_OK
+            || capturedBytes != rowBytes) {
+            RAISE(VerifyException, "Corrupted rows of slot " << record.slot << " of rotation " << report.rotation);
+        }
+
+        // most slots match, the rows are only counted through when they do not
+        if (memcmp(captured.data(), expected.data(), rowBytes) != 0) {
+            compareRows(captured.data(), expected.data(), record.rowCount, report.diff);
+        }
+        summary.comparedBytes += 2 * rowBytes;
+    } else {
+        if (rowsHash(expected.data(), record.rowCount) != record.hash) {
+            report.hashMismatches++;
+        }
+        summary.comparedBytes += rowBytes;
+    }
+
+    // the beam counts from the first ARP after the enable, 0 meaning it is not running yet
+    auto playAcp = (u64) recordRotation(record) * captureHeader.acpCnt + record.firstAcp;
+    if (record.beamAcp > 0 && record.beamAcp >= playAcp) {
+        report.staleSlots++;
+        report.maxLateAcps = MAX(report.maxLateAcps, (u32) (record.beamAcp - playAcp));
+    }
+}
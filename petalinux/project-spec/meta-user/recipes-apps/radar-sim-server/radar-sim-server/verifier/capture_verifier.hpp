@@ -0,0 +1,182 @@
+/*
+ * capture_verifier.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CAPTURE_VERIFIER_
+#define CAPTURE_VERIFIER_
+
+#include "inc/exceptions.hpp"
+#include "capture_recorder.hpp"
+#include "radar_map.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** STRUCTS **/
+
+/**
+ * Hits of the committed rows that differ from the rows the scenario plays there.
+ */
+struct RowDiff {
+    /** Hits committed that the scenario does not have **/
+    u64 extraHits;
+
+    /** Hits of the scenario that were not committed **/
+    u64 missingHits;
+
+    /** Rows whose ACP index differs from the scenario's **/
+    u32 wrongAcpRows;
+};
+
+/**
+ * Mismatches of one rotation played after a load, summed over the records of its slots.
+ */
+struct RotationReport {
+    u32 subSystem;
+
+    /** ARP the map was loaded from and rotation played since **/
+    u32 fromArpIdx;
+    u32 rotation;
+
+    /** Rotation of the played map, of the last record **/
+    u32 mapRotation;
+
+    u32 records;
+
+    RowDiff diff;
+
+    /** Slots committed when the beam already was in them, i.e. partly played stale **/
+    u32 staleSlots;
+
+    /** Most ACPs a slot was committed late **/
+    u32 maxLateAcps;
+
+    /** Slots without rows, or overlaid ones, whose hash does not match the scenario **/
+    u32 hashMismatches;
+
+    /** Slots the overlays changed, only their map rows checked by hash **/
+    u32 overlaidSlots;
+
+    bool matches() const {
+        return diff.extraHits == 0 && diff.missingHits == 0 && diff.wrongAcpRows == 0
+               && staleSlots == 0 && hashMismatches == 0;
+    }
+};
+
+struct VerifySummary {
+    u64 records;
+
+    u64 rotations;
+
+    u64 mismatchingRotations;
+
+    /** Row bytes compared or hashed, captured and scenario side together **/
+    u64 comparedBytes;
+
+    /** The capture ends in a partially written record **/
+    bool truncated;
+};
+
+/***************** Functions Definitions *********************/
+
+/**
+ * Compares the rows, the hits with XOR and popcount in NEON wide steps and the ACP index of
+ * every row, adding the differences to diff.
+ */
+void compareRows(const u32 *captured, const u32 *expected, u32 rowCount, RowDiff &diff);
+
+/**  CLASSES **/
+
+EXCEPTION(Exception, VerifyException);
+
+/**
+ * Map file mapped into memory, read sequentially by the verifier.
+ */
+class MappedMapSource : public MapSource {
+public:
+    explicit MappedMapSource(const std::string &fileName);
+
+    ~MappedMapSource();
+
+    void readRows(u32 rotation, u32 firstRow, u32 rowCount, u32 *dst);
+
+    u64 rowCount() const;
+
+private:
+    const u8 *data = NULL;
+
+    size_t byteSize = 0;
+
+    u64 storedRowCount = 0;
+
+    /**
+     * Reads the segment table, if any, and returns the bytes it occupies at the end of the file.
+     */
+    u64 readSegments();
+};
+
+/**
+ * Checks a capture of the committed ring slots against the scenario maps it played.
+ *
+ * The maps are played the way the server plays them, through the playback segments and,
+ * if the capture was calibrated differently, resampled to the capture's ACP count and
+ * trigger period. Records with rows are compared row by row, records without only by hash.
+ * What the server merges in on top of the maps, weather, noise, sea clutter, target layers,
+ * live targets and blanking, is not replayed: records flagged CAPTURE_OVERLAID are checked
+ * by the hash of their map rows only and reported as overlaid.
+ */
+class CaptureVerifier {
+public:
+    typedef std::function<void(const RotationReport &)> ReportFunc;
+
+    /**
+     * Maps the capture and opens the maps, an empty path skipping the records of that
+     * subsystem. Raises VerifyException if a file is no capture or map file.
+     */
+    CaptureVerifier(const std::string &capturePath,
+                    const std::string &clutterPath,
+                    const std::string &targetPath,
+                    s32 acpOffset);
+
+    ~CaptureVerifier();
+
+    const CaptureHeader &header() const {
+        return captureHeader;
+    }
+
+    /**
+     * Verifies every record and reports the rotations in the order they were played.
+     */
+    VerifySummary verify(const ReportFunc &report);
+
+private:
+    const u8 *data = NULL;
+
+    size_t byteSize = 0;
+
+    CaptureHeader captureHeader;
+
+    std::shared_ptr<MapSource> clutterSource;
+
+    std::shared_ptr<MapSource> targetSource;
+
+    std::vector<u32> captured;
+
+    std::vector<u32> expected;
+
+    std::shared_ptr<MapSource> playedSource(const std::string &path, s32 acpOffset);
+
+    /**
+     * Rotation played since the load the slot of the record belongs to.
+     */
+    u32 recordRotation(const CaptureRecord &record) const;
+
+    void verifyRecord(const CaptureRecord &record, const u8 *payload, MapSource &source, RotationReport &report,
+                      VerifySummary &summary);
+};
+
+#endif /* CAPTURE_VERIFIER_ */
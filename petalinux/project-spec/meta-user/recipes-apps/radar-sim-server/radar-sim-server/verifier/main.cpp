@@ -0,0 +1,113 @@
+/*
+ * main.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <getopt.h>
+
+#include "capture_verifier.hpp"
+
+using namespace std;
+using namespace ::hr::franp::rsim;
+
+void usage(const char *name) {
+    cout << "Usage: " << name << " --capture FILE [--clutter FILE] [--targets FILE] [--acp-offset N] [--all]" << endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    string capturePath;
+    string clutterPath;
+    string targetPath;
+    s32 acpOffset = 0;
+    bool allRotations = false;
+
+    const struct option options[] = {
+        {"capture",    required_argument, NULL, 'p'},
+        {"clutter",    required_argument, NULL, 'c'},
+        {"targets",    required_argument, NULL, 't'},
+        {"acp-offset", required_argument, NULL, 'o'},
+        {"all",        no_argument,       NULL, 'a'},
+        {"help",       no_argument,       NULL, 'h'},
+        {NULL, 0,                         NULL, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "p:c:t:o:ah", options, NULL)) != -1) {
+        switch (opt) {
+            case 'p':
+                capturePath = optarg;
+                break;
+            case 'c':
+                clutterPath = optarg;
+                break;
+            case 't':
+                targetPath = optarg;
+                break;
+            case 'o':
+                acpOffset = (s32) atoi(optarg);
+                break;
+            case 'a':
+                allRotations = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (capturePath.empty() || (clutterPath.empty() && targetPath.empty())) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    auto startTime = chrono::steady_clock::now();
+
+    VerifySummary summary;
+    try {
+        CaptureVerifier verifier(capturePath, clutterPath, targetPath, acpOffset);
+
+        summary = verifier.verify([&](const RotationReport &report) {
+            if (!allRotations && report.matches()) {
+                return;
+            }
+            cout << "VERIFY_ROTATION="
+                 << (report.subSystem == SubSystem::CLUTTER ? "CL" : "MT") << "/"
+                 << report.fromArpIdx << "/"
+                 << report.rotation << "/"
+                 << report.mapRotation << "/"
+                 << report.records << "/"
+                 << report.diff.extraHits << "/"
+                 << report.diff.missingHits << "/"
+                 << report.diff.wrongAcpRows << "/"
+                 << report.staleSlots << "/"
+                 << report.maxLateAcps << "/"
+                 << report.hashMismatches << "/"
+                 << report.overlaidSlots
+                 << endl;
+        });
+    } catch (Exception &e) {
+        cerr << "ERR=" << e.what() << endl;
+        return 1;
+    }
+
+    auto elapsedMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count();
+
+    if (summary.truncated) {
+        cerr << "ERR=Capture ends in a partially written record" << endl;
+    }
+
+    cout << "VERIFY_SUMMARY="
+         << summary.records << "/"
+         << summary.rotations << "/"
+         << summary.mismatchingRotations << "/"
+         << summary.comparedBytes / (1024 * 1024) << "/"
+         << elapsedMs
+         << endl;
+
+    return summary.mismatchingRotations > 0 ? 2 : 0;
+}